@@ -0,0 +1,46 @@
+/**
+ * @file atomic_bitops.cpp
+ * @brief Ezamanl Bitmap: Boyutlandrma, Kilitsiz lk Bo Bit Sahiplenme ve Sayma.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "atomic_bitops.h"
+
+uint64_t AtomicBitmap::tail_padding() const {
+	const int tail = static_cast<int>(size_ % kWordBits);
+	return (tail == 0) ? 0 : static_cast<uint64_t>(~CreateMask<uint64_t>(tail, 0));
+}
+
+void AtomicBitmap::resize(size_t nbits) {
+	size_ = nbits;
+	word_count_ = (nbits + kWordBits - 1) / kWordBits;
+	words_.reset(word_count_ == 0 ? nullptr : new std::atomic<uint64_t>[word_count_]);
+	clear_all(std::memory_order_relaxed);
+}
+
+void AtomicBitmap::clear_all(std::memory_order order) {
+	if (word_count_ == 0) return;
+	for (size_t w = 0; w + 1 < word_count_; w++) words_[w].store(0, order);
+	// Kapasite tesindeki bitler kalc olarak '1'dir (claim_first_clear onlar asla semez).
+	// Son kelime tek yazmayla kurulur: Ezamanl bir claim_first_clear'n kuyruk bitlerini
+	// '0' grecei bir ara durum olumaz.
+	words_[word_count_ - 1].store(tail_padding(), order);
+}
+
+size_t AtomicBitmap::claim_first_clear(std::memory_order order) {
+	for (size_t w = 0; w < word_count_; w++) {
+		const int bit = atomic_claim_first_clear_bit(words_[w], order);
+		if (bit >= 0) return w * kWordBits + static_cast<size_t>(bit);
+	}
+	return npos;
+}
+
+size_t AtomicBitmap::count(std::memory_order order) const {
+	size_t total = 0;
+	for (size_t w = 0; w < word_count_; w++) total += static_cast<size_t>(count_set_bits(words_[w].load(order)));
+	return total - static_cast<size_t>(count_set_bits(tail_padding()));
+}
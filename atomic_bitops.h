@@ -0,0 +1,263 @@
+/**
+ * @file atomic_bitops.h
+ * @brief std::atomic<uintN_t> zerinde Atomik Bit lemleri ve Ezamanl Bitmap.
+ *
+ * bitops.h'deki SetRegBit/ClearRegBit/ToggleRegBit yeni deeri dndren saf fonksiyonlardr;
+ * paylalan bir kelimede "oku, deitir, yaz" olarak kullanlrsa iki i paracnn
+ * gncellemelerinden biri kaybolur. Bu dosya ayn ilemlerin atomik karlklarn sunar:
+ * - Fetch-set/clear/toggle: Tek fetch_or / fetch_and / fetch_xor; nceki deeri dndrr.
+ * - Test-and-set/clear/toggle: Bitin nceki durumunu dndrr (bayrak sahiplenme).
+ * - Alan gncelleme: set_bit_field zerine kurulu CAS dngs (dier alanlar korunur).
+ * - lk bo biti sahiplenme: find_first_set_bit(~word) + CAS (kilitsiz yuva ayrma).
+ * Tm ilemler ak bir std::memory_order parametresi alr (varsaylan, std::atomic'teki
+ * gibi seq_cst'dir).
+ *
+ * AtomicBitmap, bu ilemleri ok kelimeli paylalan durum bitmap'lerine tar ve mutex
+ * ile korunan bayrak kelimelerinin yerini alr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef ATOMIC_BITOPS_H
+#define ATOMIC_BITOPS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include "bitops.h" // SetRegBit, ClearRegBit, ToggleRegBit, set_bit_field, get_bit_field, find_first_set_bit
+
+// =========================================================================
+// I. TEK KELME ATOMK BT LEMLER
+// =========================================================================
+
+/**
+ * MHENDSLK NOTU (Tek komut): Maskeler, saf fonksiyonlarn sabit bir kelimeye
+ * uygulanmasyla retilir: SetRegBit(0, i) tek bitlik OR maskesi, ClearRegBit(~0, i) tek
+ * sfr bitlik AND maskesidir. Bylece her ilem tek bir atomik okuma-deitirme-yazmaya
+ * (x86'da LOCK OR / AND / XOR) iner. Dn deerinden yalnzca ayn bit test edildiinde
+ * (Test-and-set/clear/toggle) GCC/Clang bunu LOCK BTS / BTR / BTC + SETC komutlarna derler; eski
+ * deeri tam kelime olarak dndren srmler ise CAS dngsne inebilir, yalnzca gerekiyorsa
+ * kullanlmaldr.
+ */
+
+/**
+ * @brief Belirtilen biti atomik olarak '1' yapar (fetch-set).
+ *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
+ * @param reg Paylalan register.
+ * @param index Bitin konumu (0'dan (N-1)'e kadar).
+ * @param order Bellek sralamas.
+ * @return lemden NCEK register deeri.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T> AtomicSetRegBit(std::atomic<T>& reg, int index,
+                                                   std::memory_order order = std::memory_order_seq_cst) {
+    return reg.fetch_or(SetRegBit(static_cast<T>(0), index), order);
+}
+
+/**
+ * @brief Belirtilen biti atomik olarak '0' yapar (fetch-clear).
+ * @return lemden NCEK register deeri. Parametreler AtomicSetRegBit ile ayndr.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T> AtomicClearRegBit(std::atomic<T>& reg, int index,
+                                                     std::memory_order order = std::memory_order_seq_cst) {
+    return reg.fetch_and(ClearRegBit(static_cast<T>(~static_cast<T>(0)), index), order);
+}
+
+/**
+ * @brief Belirtilen biti atomik olarak tersine evirir (fetch-toggle).
+ * @return lemden NCEK register deeri. Parametreler AtomicSetRegBit ile ayndr.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T> AtomicToggleRegBit(std::atomic<T>& reg, int index,
+                                                      std::memory_order order = std::memory_order_seq_cst) {
+    return reg.fetch_xor(SetRegBit(static_cast<T>(0), index), order);
+}
+
+/**
+ * @brief Biti atomik olarak '1' yapar ve nceki durumunu dndrr (test-and-set).
+ *
+ * false dnen tek aran biti '0'dan '1'e eviren, yani bayra sahiplenen arandr.
+ *
+ * @return Bit ilemden nce '1' ise true.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T, bool> AtomicTestAndSetBit(std::atomic<T>& reg, int index,
+                                                             std::memory_order order = std::memory_order_seq_cst) {
+    const T mask = SetRegBit(static_cast<T>(0), index);
+    return (reg.fetch_or(mask, order) & mask) != 0;
+}
+
+/**
+ * @brief Biti atomik olarak '0' yapar ve nceki durumunu dndrr (test-and-clear).
+ * @return Bit ilemden nce '1' ise true (bekleyen bayra tketen aran).
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T, bool> AtomicTestAndClearBit(std::atomic<T>& reg, int index,
+                                                               std::memory_order order = std::memory_order_seq_cst) {
+    const T mask = SetRegBit(static_cast<T>(0), index);
+    return (reg.fetch_and(static_cast<T>(~mask), order) & mask) != 0;
+}
+
+/**
+ * @brief Biti atomik olarak tersine evirir ve nceki durumunu dndrr (test-and-toggle).
+ * @return Bit ilemden nce '1' ise true.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T, bool> AtomicTestAndToggleBit(std::atomic<T>& reg, int index,
+                                                                std::memory_order order = std::memory_order_seq_cst) {
+    const T mask = SetRegBit(static_cast<T>(0), index);
+    return (reg.fetch_xor(mask, order) & mask) != 0;
+}
+
+/// Bitin anlk durumunu okur (isBitSet'in atomik ykleme srm).
+template<typename T>
+bitops_detail::EnableIfRegister<T, bool> AtomicTestBit(const std::atomic<T>& reg, int index,
+                                                       std::memory_order order = std::memory_order_seq_cst) {
+    return isBitSet(reg.load(order), index);
+}
+
+/**
+ * @brief Bit alann atomik olarak okur.
+ * @param order Ykleme sralamas (seq_cst, acquire veya relaxed).
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T> atomic_get_bit_field(const std::atomic<T>& reg, int start_bit, int length,
+                                                        std::memory_order order = std::memory_order_seq_cst) {
+    return get_bit_field(reg.load(order), start_bit, length);
+}
+
+/**
+ * @brief Bit alanna atomik olarak yeni bir deer yazar; kelimenin dier bitleri korunur.
+ *
+ * MHENDSLK NOTU (CAS dngs): Alan yazma tek bir fetch_* ilemiyle ifade edilemez
+ * (nce temizle, sonra yaz). Deer set_bit_field ile hesaplanr ve compare_exchange_weak ile
+ * yazlr; baka bir i parac araya girerse gncel deerle yeniden hesaplanr. Baarsz
+ * denemeler hibir ey yaymlamad iin relaxed sraldr. Alan zaten istenen deerdeyse de
+ * yazma yaplr: Bylece 'order'n release anlam her arda geerlidir.
+ *
+ * @param order Baarl yazmann bellek sralamas.
+ * @return lemden NCEK register deeri.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T> atomic_set_bit_field(std::atomic<T>& reg, int start_bit, int length,
+                                                        typename bitops_detail::identity<T>::type new_value,
+                                                        std::memory_order order = std::memory_order_seq_cst) {
+    T cur = reg.load(std::memory_order_relaxed);
+    while (!reg.compare_exchange_weak(cur, set_bit_field(cur, start_bit, length, new_value), order,
+                                      std::memory_order_relaxed)) {
+        // cur, baarsz CAS tarafndan gncel deerle yeniden yklenmitir.
+    }
+    return cur;
+}
+
+/**
+ * @brief Kelimedeki en dk '0' biti atomik olarak '1' yapar (kilitsiz yuva sahiplenme).
+ *
+ * lk bo yuva find_first_set_bit(~word) ile bulunur ve SetRegBit ile CAS zerinden alnr.
+ * Ayn anda aran i paracklar asla ayn biti almaz.
+ *
+ * @param reg Doluluk kelimesi ('1' = dolu).
+ * @param order Baarl sahiplenmenin bellek sralamas (tipik olarak acquire).
+ * @return Sahiplenilen bitin indeksi; kelime doluysa -1.
+ */
+template<typename T>
+bitops_detail::EnableIfRegister<T, int> atomic_claim_first_clear_bit(std::atomic<T>& reg,
+                                                                     std::memory_order order = std::memory_order_seq_cst) {
+    const T full = static_cast<T>(~static_cast<T>(0));
+    T cur = reg.load(std::memory_order_relaxed);
+    while (cur != full) {
+        const int bit = find_first_set_bit(static_cast<T>(~cur));
+        if (reg.compare_exchange_weak(cur, SetRegBit(cur, bit), order, std::memory_order_relaxed)) return bit;
+    }
+    return -1;
+}
+
+
+// =========================================================================
+// II. EZAMANLI BITMAP
+// =========================================================================
+
+/**
+ * @brief ok i parackl, kilitsiz (lock-free) sabit boyutlu bitmap.
+ *
+ * Bit i, (i / 64). kelimenin (i % 64). bitidir (DynamicBitset dzeni). Tek bit ilemleri
+ * ve claim_first_clear() ayn anda farkl i paracklarndan arlabilir; resize()
+ * arlrken bitmap baka bir i paracnda kullanlmamaldr. Snr kontrol yaplmaz.
+ *
+ * MHENDSLK NOTU (Kuyruk bitleri): Son kelimenin size() tesindeki bitleri kalc olarak
+ * '1' tutulur (BlockPool doluluk kelimeleriyle ayn). Bylece claim_first_clear() kuyruk
+ * maskesi uygulamadan atomic_claim_first_clear_bit'i dorudan kullanr; count() bu bitleri
+ * karr. Her kelime ayr bir atomiktir: Kelimeler aras ilemler (count, clear_all) anlk
+ * bir grnt deil, kelime kelime tutarl bir taramadr.
+ */
+class AtomicBitmap {
+public:
+    static constexpr size_t kWordBits = 64;
+    /// claim_first_clear iin "bulunamad" deeri.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    AtomicBitmap() : size_(0), word_count_(0) {}
+
+    /// @param nbits Bit says; tm bitler '0' balar.
+    explicit AtomicBitmap(size_t nbits) : size_(0), word_count_(0) { resize(nbits); }
+
+    AtomicBitmap(const AtomicBitmap&) = delete;
+    AtomicBitmap& operator=(const AtomicBitmap&) = delete;
+
+    /// Boyutu deitirir ve tm bitleri '0' yapar (ezamanl deildir).
+    void resize(size_t nbits);
+
+    size_t size() const { return size_; }
+    size_t word_count() const { return word_count_; }
+
+    bool test(size_t pos, std::memory_order order = std::memory_order_seq_cst) const {
+        return AtomicTestBit(words_[pos / kWordBits], static_cast<int>(pos % kWordBits), order);
+    }
+
+    /// Biti '1' yapar; nceki durumunu dndrr (false ise bayra bu ar kaldrd).
+    bool set(size_t pos, std::memory_order order = std::memory_order_seq_cst) {
+        return AtomicTestAndSetBit(words_[pos / kWordBits], static_cast<int>(pos % kWordBits), order);
+    }
+
+    /// Biti '0' yapar; nceki durumunu dndrr.
+    bool clear(size_t pos, std::memory_order order = std::memory_order_seq_cst) {
+        return AtomicTestAndClearBit(words_[pos / kWordBits], static_cast<int>(pos % kWordBits), order);
+    }
+
+    /// Biti tersine evirir; nceki durumunu dndrr.
+    bool flip(size_t pos, std::memory_order order = std::memory_order_seq_cst) {
+        return AtomicTestAndToggleBit(words_[pos / kWordBits], static_cast<int>(pos % kWordBits), order);
+    }
+
+    /**
+     * @brief En dk indeksli '0' biti bulur ve kilitsiz olarak '1' yapar.
+     *
+     * Dolu kelimeler tek karlatrmayla geilir. Ayn anda aran i paracklar farkl
+     * bitler alr; clear() ile braklan bit yeniden sahiplenilebilir.
+     *
+     * @param order Baarl sahiplenmenin bellek sralamas (tipik olarak acquire).
+     * @return Sahiplenilen bitin indeksi; tm bitler '1' ise npos.
+     */
+    size_t claim_first_clear(std::memory_order order = std::memory_order_seq_cst);
+
+    /// '1' bit says (ezamanl kullanmda kelime kelime okunur). order bir ykleme sralamasdr.
+    size_t count(std::memory_order order = std::memory_order_seq_cst) const;
+
+    /// Tm bitleri '0' yapar (kelime bana bir atomik yazma). order bir saklama sralamasdr.
+    void clear_all(std::memory_order order = std::memory_order_seq_cst);
+
+private:
+    uint64_t tail_padding() const;
+
+    size_t size_;
+    size_t word_count_;
+    std::unique_ptr<std::atomic<uint64_t>[]> words_;
+};
+
+#endif // ATOMIC_BITOPS_H
@@ -0,0 +1,1333 @@
+/**
+ * @file benchmark.cpp
+ * @brief Buffer Library Performans lm (Benchmark) Uygulamas.
+ *
+ * Bu dosya, ktphane bileenlerinin verimini (throughput) alternatif standart
+ * zmlerle karlatrr. main.cpp'den bamsz ayr bir altrlabilir dosyadr:
+ *
+ *   g++ -std=c++17 -O3 -pthread benchmark.cpp bitops.cpp bitstream.cpp bitpack.cpp dynamic_bitset.cpp rank_select.cpp fir_filter.cpp iir_filter.cpp stream_filters.cpp predicate_filter.cpp crc.cpp bit_matrix.cpp mapped_bitmap.cpp thread_pool.cpp block_pool.cpp atomic_bitops.cpp hierarchical_bitmap.cpp compressed_bitmap.cpp bloom_filter.cpp -o bitbuf_bench
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "atomic_bitops.h"
+#include "bit_matrix.h"
+#include "bloom_filter.h"
+#include "block_pool.h"
+#include "bitops.h"
+#include "compressed_bitmap.h"
+#include "bitpack.h"
+#include "bitstream.h"
+#include "crc.h"
+#include "dynamic_bitset.h"
+#include "hierarchical_bitmap.h"
+#include "fir_filter.h"
+#include "iir_filter.h"
+#include "mapped_bitmap.h"
+#include "mpmc_queue.h"
+#include "predicate_filter.h"
+#include "rank_select.h"
+#include "stream_filters.h"
+#include "ring_buffer.h"
+#include "thread_pool.h"
+
+// =========================================================================
+// YARDIMCI FONKSYONLAR
+// =========================================================================
+
+using BenchClock = std::chrono::steady_clock;
+
+/**
+ * @brief Bir lm sonucunu tek satr olarak yazdrr.
+ * @param name lm ad.
+ * @param items lenen eleman says.
+ * @param seconds Geen sre (saniye).
+ * @param checksum Derleyicinin llen ii elemesini (dead code elimination) nleyen deer.
+ */
+void report(const std::string& name, uint64_t items, double seconds, uint64_t checksum) {
+    std::cout << std::left << std::setw(40) << name << std::right
+              << std::setw(10) << std::fixed << std::setprecision(2) << (items / seconds / 1e6) << " M eleman/s"
+              << std::setw(10) << std::setprecision(2) << (seconds * 1e9 / items) << " ns/eleman"
+              << "  (checksum " << checksum << ")" << std::endl;
+}
+
+/**
+ * @brief Bir retici ve bir tketici i parac ile kuyruk verimini ler.
+ * @param push retici taraf: Bir deeri eklemeyi dener, baarszsa false dndrr.
+ * @param pop Tketici taraf: Bir deer karmay dener, baarszsa false dndrr.
+ * @param items Aktarlacak toplam eleman says.
+ * @return Geen sre (saniye) ve tketicinin grd deerlerin toplam.
+ */
+template<typename PushFn, typename PopFn>
+std::pair<double, uint64_t> run_producer_consumer(PushFn push, PopFn pop, uint64_t items) {
+    uint64_t sum = 0;
+    auto start = BenchClock::now();
+    std::thread consumer([&] {
+        uint64_t value = 0;
+        for (uint64_t received = 0; received < items;) {
+            if (pop(value)) {
+                sum += value;
+                received++;
+            } else {
+                std::this_thread::yield();
+            }
+        }
+    });
+    for (uint64_t i = 0; i < items;) {
+        if (push(i)) {
+            i++;
+        } else {
+            std::this_thread::yield();
+        }
+    }
+    consumer.join();
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    return { elapsed.count(), sum };
+}
+
+/**
+ * @brief P retici ve C tketici i parac ile kuyruk verimini ler (fan-in/fan-out).
+ * @param producers retici i parac says.
+ * @param consumers Tketici i parac says.
+ * @param push Bir deeri eklemeyi dener, baarszsa false dndrr (thread-safe olmal).
+ * @param pop Bir deer karmay dener, baarszsa false dndrr (thread-safe olmal).
+ * @param items Aktarlacak toplam eleman says (reticilere eit blnr).
+ * @return Geen sre (saniye) ve tketicilerin grd deerlerin toplam.
+ */
+template<typename PushFn, typename PopFn>
+std::pair<double, uint64_t> run_multi_producer_consumer(int producers, int consumers,
+                                                        PushFn push, PopFn pop, uint64_t items) {
+    const uint64_t per_producer = items / producers;
+    std::atomic<int> producers_done(0);
+    std::atomic<uint64_t> sum(0);
+    std::vector<std::thread> threads;
+    auto start = BenchClock::now();
+    for (int c = 0; c < consumers; c++) {
+        threads.emplace_back([&] {
+            // Paylalan bir "alnan eleman" sayac lm kirletirdi; tketiciler bunun yerine
+            // tm reticiler bittikten sonra kuyruk boalana kadar alr.
+            uint64_t local_sum = 0;
+            uint64_t value = 0;
+            for (;;) {
+                if (pop(value)) {
+                    local_sum += value;
+                } else if (producers_done.load(std::memory_order_acquire) == producers) {
+                    if (!pop(value)) break;
+                    local_sum += value;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            sum.fetch_add(local_sum);
+        });
+    }
+    for (int p = 0; p < producers; p++) {
+        threads.emplace_back([&, p] {
+            const uint64_t base = p * per_producer;
+            for (uint64_t i = 0; i < per_producer;) {
+                if (push(base + i)) {
+                    i++;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            producers_done.fetch_add(1, std::memory_order_release);
+        });
+    }
+    for (std::thread& t : threads) t.join();
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    return { elapsed.count(), sum.load() };
+}
+
+// =========================================================================
+// LMLER
+// =========================================================================
+
+/**
+ * @brief SPSC dairesel tamponu, mutex korumal std::deque ile karlatrr.
+ */
+void bench_spsc_ring_buffer() {
+    std::cout << "=== SPSC RING BUFFER vs MUTEX + std::deque ===" << std::endl;
+    const uint64_t kItems = 20000000;
+
+    {
+        static SpscRingBuffer<uint64_t, 4096> ring;
+        auto result = run_producer_consumer(
+            [](uint64_t v) { return ring.push(v); },
+            [](uint64_t& v) { return ring.pop(v); }, kItems);
+        report("SpscRingBuffer push/pop", kItems, result.first, result.second);
+    }
+
+    {
+        // Toplu (batch) API: 64'lk bloklar, saya blok bana bir kez yaynlanr.
+        static SpscRingBuffer<uint64_t, 4096> ring;
+        const size_t kBatch = 64;
+        uint64_t sum = 0;
+        auto start = BenchClock::now();
+        std::thread consumer([&] {
+            uint64_t block[kBatch];
+            for (uint64_t received = 0; received < kItems;) {
+                size_t n = ring.pop_batch(block, kBatch);
+                if (n == 0) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                for (size_t i = 0; i < n; i++) sum += block[i];
+                received += n;
+            }
+        });
+        uint64_t block[kBatch];
+        for (uint64_t next = 0; next < kItems;) {
+            size_t want = (kItems - next < kBatch) ? (size_t)(kItems - next) : kBatch;
+            for (size_t i = 0; i < want; i++) block[i] = next + i;
+            size_t n = ring.push_batch(block, want);
+            if (n == 0) std::this_thread::yield();
+            next += n;
+        }
+        consumer.join();
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        report("SpscRingBuffer push_batch/pop_batch(64)", kItems, elapsed.count(), sum);
+    }
+
+    {
+        std::mutex mtx;
+        std::deque<uint64_t> queue;
+        const size_t kLimit = 4096;     // Ayn kapasite snr: Adil karlatrma iin.
+        auto result = run_producer_consumer(
+            [&](uint64_t v) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (queue.size() == kLimit) return false;
+                queue.push_back(v);
+                return true;
+            },
+            [&](uint64_t& v) {
+                std::lock_guard<std::mutex> lock(mtx);
+                if (queue.empty()) return false;
+                v = queue.front();
+                queue.pop_front();
+                return true;
+            }, kItems);
+        report("std::mutex + std::deque", kItems, result.first, result.second);
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief MPMC kuyruun 1'den N'ye kadar retici/tketici ifti ile leklenmesini ler.
+ *
+ * Her admda T retici ve T tketici alr (T = 1, 2, 4, ... donanm i parac says).
+ * Ayn senaryo mutex korumal std::deque ile tekrarlanr.
+ */
+void bench_mpmc_queue_scaling() {
+    std::cout << "=== MPMC QUEUE LEKLENME (T retici + T tketici) ===" << std::endl;
+    const uint64_t kItems = 4000000;
+    unsigned hw = std::thread::hardware_concurrency();
+    const int max_threads = (hw > 1) ? (int)hw : 2;
+
+    for (int t = 1; t <= max_threads; t *= 2) {
+        {
+            static MpmcQueue<uint64_t, 4096> queue;
+            auto result = run_multi_producer_consumer(t, t,
+                [](uint64_t v) { return queue.try_push(v); },
+                [](uint64_t& v) { return queue.try_pop(v); }, kItems);
+            report("MpmcQueue T=" + std::to_string(t), kItems, result.first, result.second);
+        }
+        {
+            std::mutex mtx;
+            std::deque<uint64_t> queue;
+            const size_t kLimit = 4096;
+            auto result = run_multi_producer_consumer(t, t,
+                [&](uint64_t v) {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    if (queue.size() == kLimit) return false;
+                    queue.push_back(v);
+                    return true;
+                },
+                [&](uint64_t& v) {
+                    std::lock_guard<std::mutex> lock(mtx);
+                    if (queue.empty()) return false;
+                    v = queue.front();
+                    queue.pop_front();
+                    return true;
+                }, kItems);
+            report("std::mutex + std::deque T=" + std::to_string(t), kItems, result.first, result.second);
+        }
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief BitWriter/BitReader paketleme ve ama verimini tek (odd) alan geniliklerinde ler.
+ */
+void bench_bitstream() {
+    std::cout << "=== BITSTREAM PAKETLEME / AMA ===" << std::endl;
+    const size_t kValues = 1 << 20;
+    const int kRepeats = 20;
+    std::vector<uint32_t> values(kValues);
+    std::vector<uint32_t> decoded(kValues);
+    std::vector<uint8_t> buffer(kValues * 4 + 8);
+
+    const int widths[] = { 3, 11, 17, 32 };
+    for (int width : widths) {
+        const uint32_t mask = CreateMask<uint32_t>(width, 0);
+        uint32_t seed = 12345;
+        for (uint32_t& v : values) {
+            seed = seed * 1664525u + 1013904223u;   // LCG: Tekrarlanabilir szde rastgele veri.
+            v = seed & mask;
+        }
+        size_t bytes = 0;
+        auto start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            BitWriter writer(buffer.data(), buffer.size());
+            for (size_t i = 0; i < kValues; i++) writer.write(values[i], width);
+            bytes = writer.finish();
+        }
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        report("BitWriter::write w=" + std::to_string(width), kValues * kRepeats, elapsed.count(), bytes);
+
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            BitWriter writer(buffer.data(), buffer.size());
+            writer.write_array(values.data(), kValues, width);
+            bytes = writer.finish();
+        }
+        elapsed = BenchClock::now() - start;
+        report("BitWriter::write_array w=" + std::to_string(width), kValues * kRepeats, elapsed.count(), bytes);
+
+        uint64_t sum = 0;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            BitReader reader(buffer.data(), bytes);
+            for (size_t i = 0; i < kValues; i++) sum += reader.read(width);
+        }
+        elapsed = BenchClock::now() - start;
+        report("BitReader::read w=" + std::to_string(width), kValues * kRepeats, elapsed.count(), sum);
+
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            BitReader reader(buffer.data(), bytes);
+            reader.read_array(decoded.data(), kValues, width);
+        }
+        elapsed = BenchClock::now() - start;
+        report("BitReader::read_array w=" + std::to_string(width), kValues * kRepeats, elapsed.count(),
+               decoded[kValues - 1]);
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Bit paketleme codec'ini 5..13 bitlik sayalarla ler.
+ *
+ * Dizi L2 nbelleine sacak boyuttadr; bylece lm bellek bant geniliini deil
+ * ekirdek hzn gsterir. Sktrma oran checksum yerine satr sonunda raporlanr.
+ */
+void bench_bitpack() {
+    std::cout << "=== BITPACK CODEC (128 / 256 BLOK) ===" << std::endl;
+    std::cout << "bitpack kernels: block128=" << bitpack_kernel_name(BitpackBlockSize::k128)
+              << " block256=" << bitpack_kernel_name(BitpackBlockSize::k256) << std::endl;
+    const size_t kValues = 1 << 16;
+    const int kRepeats = 2000;
+    std::vector<uint32_t> samples(kValues);
+    std::vector<uint32_t> values(kValues);
+    std::vector<uint32_t> decoded(kValues);
+    std::vector<uint32_t> encoded(bitpack_max_encoded_words(kValues, BitpackBlockSize::k128));
+
+    const int widths[] = { 5, 13 };
+    const BitpackBlockSize blocks[] = { BitpackBlockSize::k128, BitpackBlockSize::k256 };
+    for (int width : widths) {
+        uint32_t seed = 12345;
+        for (uint32_t& v : samples) {
+            seed = seed * 1664525u + 1013904223u;
+            v = (seed >> 8) & CreateMask<uint32_t>(width, 0);
+        }
+        for (BitpackBlockSize block : blocks) {
+            for (BitpackMode mode : { BitpackMode::Plain, BitpackMode::Delta }) {
+                // Delta modunda kmlatif saya: Artlar 'width' bitlik, deerler 32 bitlik.
+                uint32_t counter = 0;
+                for (size_t i = 0; i < kValues; i++) {
+                    values[i] = (mode == BitpackMode::Delta) ? (counter += samples[i]) : samples[i];
+                }
+                const std::string label = std::string(mode == BitpackMode::Plain ? "plain" : "delta")
+                    + " b" + std::to_string(static_cast<int>(block)) + " w=" + std::to_string(width);
+                size_t words = 0;
+                auto start = BenchClock::now();
+                for (int r = 0; r < kRepeats; r++) {
+                    words = bitpack_encode(values.data(), kValues, encoded.data(), mode, block);
+                }
+                std::chrono::duration<double> elapsed = BenchClock::now() - start;
+                report("bitpack_encode " + label, kValues * kRepeats, elapsed.count(), words);
+
+                start = BenchClock::now();
+                for (int r = 0; r < kRepeats; r++) {
+                    bitpack_decode(encoded.data(), words, decoded.data(), kValues, mode, block);
+                }
+                elapsed = BenchClock::now() - start;
+                report("bitpack_decode " + label, kValues * kRepeats, elapsed.count(), decoded[kValues - 1]);
+                std::cout << "  oran: " << std::setprecision(2)
+                          << (static_cast<double>(kValues) / words) << "x"
+                          << (decoded == values ? "" : "  (HATALI!)") << std::endl;
+            }
+        }
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Seyrek (sparse) bir bit kmesini taramay ve kelime bazl toplu ilemleri ler.
+ *
+ * Bit bana test() dngs O(bit) iken for_each_set_bit O(kelime + '1' bit)'tir.
+ */
+void bench_dynamic_bitset() {
+    std::cout << "=== DYNAMIC BITSET (16M BIT) ===" << std::endl;
+    const size_t kBits = 1 << 24;
+    const int kRepeats = 10;
+    DynamicBitset flags(kBits);
+    DynamicBitset other(kBits);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < kBits / 1000; i++) {            // %0.1 younluk.
+        seed = seed * 1664525u + 1013904223u;
+        flags.set(seed % kBits);
+        other.set((seed >> 3) % kBits);
+    }
+
+    uint64_t sum = 0;
+    auto start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        for (size_t i = 0; i < kBits; i++) {
+            if (flags.test(i)) sum += i;
+        }
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("scan test() her bit", kBits * kRepeats, elapsed.count(), sum);
+
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        flags.for_each_set_bit([&sum](size_t i) { sum += i; });
+    }
+    elapsed = BenchClock::now() - start;
+    report("scan for_each_set_bit", kBits * kRepeats, elapsed.count(), sum);
+
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        DynamicBitset tmp = flags;
+        tmp |= other;
+        tmp.and_not(other);
+        sum += tmp.count();
+    }
+    elapsed = BenchClock::now() - start;
+    report("copy + OR + ANDNOT + count", kBits * kRepeats, elapsed.count(), sum);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief 256M bitlik statik bir bitmap zerinde rank/select sorgularn ler.
+ *
+ * Karlatrma: Rank'n indekssiz karl, bitmapin bandan itibaren toplu
+ * count_set_bits taramasdr (O(n)); bu yzden yalnzca birka sorgu ile llr.
+ */
+void bench_rank_select() {
+    std::cout << "=== RANK / SELECT (256M BIT) ===" << std::endl;
+    const size_t kBits = static_cast<size_t>(1) << 28;
+    DynamicBitset bits(kBits);
+    uint32_t seed = 12345;
+    for (size_t i = 0; i < kBits; i++) {
+        seed = seed * 1664525u + 1013904223u;
+        if ((seed >> 24) < 80) bits.set(i);          // ~%31 younluk.
+    }
+
+    auto start = BenchClock::now();
+    RankSelectIndex index(bits);
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    std::cout << "kurulum: " << std::setprecision(3) << elapsed.count() << " s, ek alan: "
+              << std::setprecision(2) << (100.0 * index.overhead_bytes() / (kBits / 8)) << " %, select: "
+              << RankSelectIndex::select_kernel_name() << std::endl;
+
+    const int kLinearQueries = 20;
+    const int kQueries = 5000000;
+    uint64_t sum = 0;
+    start = BenchClock::now();
+    for (int q = 0; q < kLinearQueries; q++) {
+        seed = seed * 1664525u + 1013904223u;
+        sum += count_set_bits(bits.data(), (seed % kBits) / 64);
+    }
+    elapsed = BenchClock::now() - start;
+    report("rank dorusal count_set_bits", kLinearQueries, elapsed.count(), sum);
+
+    sum = 0;
+    start = BenchClock::now();
+    for (int q = 0; q < kQueries; q++) {
+        seed = seed * 1664525u + 1013904223u;
+        sum += index.rank1(seed % kBits);
+    }
+    elapsed = BenchClock::now() - start;
+    report("rank1 (rastgele)", kQueries, elapsed.count(), sum);
+
+    sum = 0;
+    start = BenchClock::now();
+    for (int q = 0; q < kQueries; q++) {
+        seed = seed * 1664525u + 1013904223u;
+        sum += index.select1(seed % index.ones());
+    }
+    elapsed = BenchClock::now() - start;
+    report("select1 (rastgele)", kQueries, elapsed.count(), sum);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Q15 / Q31 FIR filtre verimini (rnek/s) blok ve rnek bana yollarla ler.
+ */
+template<typename Sample>
+void bench_fir_width(const char* format) {
+    const size_t kSamples = 1 << 18;
+    const int kRepeats = 10;
+    std::vector<Sample> input(kSamples);
+    std::vector<Sample> output(kSamples);
+    uint32_t seed = 12345;
+    for (Sample& x : input) {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<Sample>(seed);
+    }
+    const size_t tap_counts[] = { 32, 128 };
+    for (size_t taps : tap_counts) {
+        // Kutu (moving average) katsaylar: Toplam ~1.0.
+        std::vector<Sample> coeffs(taps, FixedPointTraits<Sample>::from_double(1.0 / static_cast<double>(taps)));
+        FirFilter<Sample> filter(coeffs.data(), taps);
+        auto start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) filter.process(input.data(), output.data(), kSamples);
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        report(std::string("FIR ") + format + " process taps=" + std::to_string(taps), kSamples * kRepeats,
+               elapsed.count(), static_cast<uint64_t>(output[kSamples - 1]));
+
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            for (size_t i = 0; i < kSamples; i++) output[i] = filter.process_sample(input[i]);
+        }
+        elapsed = BenchClock::now() - start;
+        report(std::string("FIR ") + format + " process_sample taps=" + std::to_string(taps), kSamples * kRepeats,
+               elapsed.count(), static_cast<uint64_t>(output[kSamples - 1]));
+    }
+}
+
+void bench_fir() {
+    std::cout << "=== FIR FILTRE (ekirdek: " << fir_kernel_name() << ") ===" << std::endl;
+    bench_fir_width<int16_t>("Q15");
+    bench_fir_width<int32_t>("Q31");
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Q15 / Q31 biquad kaskad verimini (kanal-rnek/s) ler: 8 kanal serpitirilmi
+ * (SIMD eritleri) ile ayn 8 kanaln tek kanall kaskadlarla ayr ayr ilenmesi.
+ */
+template<typename Sample>
+void bench_iir_width(const char* format) {
+    const size_t kChannels = 8;
+    const size_t kFrames = 1 << 15;
+    const size_t kStages = 4;
+    const int kRepeats = 10;
+    std::vector<Sample> interleaved(kFrames * kChannels);
+    uint32_t seed = 12345;
+    for (Sample& x : interleaved) {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<Sample>(static_cast<int32_t>(seed) >> 2);
+    }
+    std::vector<std::vector<Sample>> planar(kChannels, std::vector<Sample>(kFrames));
+    for (size_t c = 0; c < kChannels; c++) {
+        for (size_t n = 0; n < kFrames; n++) planar[c][n] = interleaved[n * kChannels + c];
+    }
+    // Butterworth alak geiren (fc = fs/8) blm; katsaylar Q(F-1) (a1 < -1.0).
+    const double scale = static_cast<double>(static_cast<int64_t>(1) << (FixedPointTraits<Sample>::kFracBits - 1));
+    const double design[5] = { 0.0976, 0.1953, 0.0976, -0.9428, 0.3333 };
+    BiquadCoeffs<Sample> stage;
+    Sample* fields[5] = { &stage.b0, &stage.b1, &stage.b2, &stage.a1, &stage.a2 };
+    for (int k = 0; k < 5; k++) *fields[k] = static_cast<Sample>(design[k] * scale);
+    std::vector<BiquadCoeffs<Sample>> stages(kStages, stage);
+
+    std::vector<Sample> output(kFrames * kChannels);
+    MultiChannelBiquad<Sample> multi(stages.data(), kStages, 1, kChannels);
+    auto start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) multi.process_interleaved(interleaved.data(), output.data(), kFrames);
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report(std::string("Biquad ") + format + " x4 MultiChannel 8 kanal", kFrames * kChannels * kRepeats,
+           elapsed.count(), static_cast<uint64_t>(output.back()));
+
+    std::vector<BiquadCascade<Sample>> singles(kChannels, BiquadCascade<Sample>(stages.data(), kStages, 1));
+    std::vector<Sample> mono(kFrames);
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        for (size_t c = 0; c < kChannels; c++) singles[c].process(planar[c].data(), mono.data(), kFrames);
+    }
+    elapsed = BenchClock::now() - start;
+    report(std::string("Biquad ") + format + " x4 BiquadCascade kanal kanal", kFrames * kChannels * kRepeats,
+           elapsed.count(), static_cast<uint64_t>(mono.back()));
+}
+
+void bench_iir() {
+    std::cout << "=== BIQUAD IIR (ekirdek: " << iir_kernel_name() << ") ===" << std::endl;
+    bench_iir_width<int16_t>("Q15");
+    bench_iir_width<int32_t>("Q31");
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief CIC desimatr, kayan ortalama ve kayan medyan verimini ler. Medyan, pencereyi
+ * her rnekte yeniden seen (std::nth_element) dorudan zmle karlatrlr.
+ */
+void bench_stream_filters() {
+    std::cout << "=== AKI FLTRELER (CIC / KAYAN ORTALAMA / MEDYAN) ===" << std::endl;
+    const size_t kSamples = 1 << 20;
+    const int kRepeats = 10;
+    std::vector<int16_t> input(kSamples);
+    std::vector<int16_t> output(kSamples);
+    uint32_t seed = 12345;
+    for (int16_t& x : input) {
+        seed = seed * 1664525u + 1013904223u;
+        x = static_cast<int16_t>(seed >> 16);
+    }
+
+    CicDecimator<int16_t> cic(5, 16);
+    auto start = BenchClock::now();
+    size_t produced = 0;
+    for (int r = 0; r < kRepeats; r++) produced += cic.process(input.data(), kSamples, output.data());
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("CicDecimator N=5 R=16", kSamples * kRepeats, elapsed.count(), produced);
+
+    const size_t windows[] = { 64, 100 };
+    for (size_t w : windows) {
+        MovingAverage<int16_t> average(w);
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) average.process(input.data(), output.data(), kSamples);
+        elapsed = BenchClock::now() - start;
+        report("MovingAverage w=" + std::to_string(w), kSamples * kRepeats, elapsed.count(),
+               static_cast<uint64_t>(output[kSamples - 1]));
+    }
+
+    const size_t kMedianWindow = 31;
+    SlidingMedian<int16_t> median(kMedianWindow);
+    start = BenchClock::now();
+    median.process(input.data(), output.data(), kSamples);
+    elapsed = BenchClock::now() - start;
+    report("SlidingMedian w=31", kSamples, elapsed.count(), static_cast<uint64_t>(output[kSamples - 1]));
+
+    std::vector<int16_t> window(kMedianWindow);
+    start = BenchClock::now();
+    for (size_t i = kMedianWindow - 1; i < kSamples; i++) {
+        std::copy(input.begin() + (i + 1 - kMedianWindow), input.begin() + (i + 1), window.begin());
+        std::nth_element(window.begin(), window.begin() + kMedianWindow / 2, window.end());
+        output[i] = window[kMedianWindow / 2];
+    }
+    elapsed = BenchClock::now() - start;
+    report("nth_element w=31", kSamples - kMedianWindow + 1, elapsed.count(), static_cast<uint64_t>(output[kSamples - 1]));
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Yklem filtresini (aralk kontrol, %50 seicilik) eleman bana 'if' ieren
+ * dall dngyle karlatrr: maske deerlendirme, sktrma ve indeks seimi.
+ */
+void bench_predicate_filter() {
+    std::cout << "=== YKLEM FLTRES (ekirdek: " << predicate_kernel_name() << ") ===" << std::endl;
+    const size_t kValues = 1 << 22;
+    const int kRepeats = 10;
+    std::vector<uint32_t> values(kValues);
+    uint32_t seed = 12345;
+    for (uint32_t& v : values) {
+        seed = seed * 1664525u + 1013904223u;
+        v = seed >> 8;
+    }
+    const uint32_t lo = 1u << 22, hi = lo + (1u << 23);     // 24-bit deerlerin ~%50'si.
+    std::vector<uint32_t> selected(kValues);
+    std::vector<uint32_t> indices(kValues);
+
+    auto start = BenchClock::now();
+    size_t count = 0;
+    for (int r = 0; r < kRepeats; r++) {
+        count = 0;
+        for (size_t i = 0; i < kValues; i++) {
+            if (values[i] >= lo && values[i] <= hi) selected[count++] = values[i];
+        }
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("dall dng (if + kopya)", kValues * kRepeats, elapsed.count(), count);
+
+    DynamicBitset mask;
+    const Predicate<uint32_t> in_range = Predicate<uint32_t>::in_range(lo, hi);
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) predicate_evaluate(values.data(), kValues, in_range, mask);
+    elapsed = BenchClock::now() - start;
+    report("predicate_evaluate u32 in_range", kValues * kRepeats, elapsed.count(), mask.count());
+
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) count = predicate_compact(values.data(), mask, selected.data());
+    elapsed = BenchClock::now() - start;
+    report("predicate_compact u32", kValues * kRepeats, elapsed.count(), count);
+
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) count = predicate_select_indices(mask, indices.data());
+    elapsed = BenchClock::now() - start;
+    report("predicate_select_indices", kValues * kRepeats, elapsed.count(), count);
+
+    std::vector<uint8_t> flags(kValues);
+    for (size_t i = 0; i < kValues; i++) flags[i] = static_cast<uint8_t>(values[i]);
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) predicate_evaluate(flags.data(), kValues, Predicate<uint8_t>::flags(0x81, 0x01), mask);
+    elapsed = BenchClock::now() - start;
+    report("predicate_evaluate u8 flags", kValues * kRepeats, elapsed.count(), mask.count());
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief CRC motorlarnn ve tampon parity'sinin verimini (byte/s) ler.
+ */
+void bench_crc() {
+    std::cout << "=== CRC / PARITY (CRC32C ekirdei: " << crc32c_kernel_name() << ") ===" << std::endl;
+    const size_t kBytes = 1 << 22;
+    const int kRepeats = 20;
+    std::vector<uint8_t> buffer(kBytes);
+    uint32_t seed = 12345;
+    for (uint8_t& b : buffer) {
+        seed = seed * 1664525u + 1013904223u;
+        b = static_cast<uint8_t>(seed >> 24);
+    }
+
+    auto start = BenchClock::now();
+    uint64_t sum = 0;
+    for (int r = 0; r < kRepeats; r++) sum += Crc32c::compute(buffer.data(), kBytes);
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("Crc32c (byte)", kBytes * kRepeats, elapsed.count(), sum);
+
+    start = BenchClock::now();
+    sum = 0;
+    for (int r = 0; r < kRepeats; r++) sum += Crc32::compute(buffer.data(), kBytes);
+    elapsed = BenchClock::now() - start;
+    report("Crc32 slicing-by-8 (byte)", kBytes * kRepeats, elapsed.count(), sum);
+
+    start = BenchClock::now();
+    sum = 0;
+    for (int r = 0; r < kRepeats; r++) sum += Crc16X25::compute(buffer.data(), kBytes);
+    elapsed = BenchClock::now() - start;
+    report("Crc16X25 slicing-by-8 (byte)", kBytes * kRepeats, elapsed.count(), sum);
+
+    start = BenchClock::now();
+    sum = 0;
+    for (int r = 0; r < kRepeats; r++) sum += getParity(buffer.data(), kBytes);
+    elapsed = BenchClock::now() - start;
+    report("getParity tampon (byte)", kBytes * kRepeats, elapsed.count(), sum);
+
+    start = BenchClock::now();
+    sum = 0;
+    for (int r = 0; r < kRepeats; r++) sum += count_set_bits(buffer.data(), kBytes) & 1;
+    elapsed = BenchClock::now() - start;
+    report("count_set_bits & 1 tampon (byte)", kBytes * kRepeats, elapsed.count(), sum);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Bit matrisi devriini bit bana isBitSet/SetRegBit dngsyle karlatrr.
+ */
+void bench_bit_matrix() {
+    std::cout << "=== BT MATRS DEVR (ekirdek: " << bit_matrix_kernel_name() << ") ===" << std::endl;
+    const size_t kRows = 4096;
+    const size_t kCols = 4096;
+    const int kRepeats = 10;
+    std::vector<uint64_t> in(kRows * kCols / 64);
+    std::vector<uint64_t> out(kRows * kCols / 64);
+    uint64_t seed = 12345;
+    for (uint64_t& w : in) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        w = seed ^ (seed >> 32);                    // LCG'nin ksa periyotlu alt bitleri kartrlr.
+    }
+
+    // Bit bit devrik: ktnn her kelimesi 64 isBitSet + SetRegBit arsyla kurulur.
+    const size_t in_words = kCols / 64;
+    const size_t out_words = kRows / 64;
+    auto start = BenchClock::now();
+    for (size_t c = 0; c < kCols; c++) {
+        for (size_t rw = 0; rw < out_words; rw++) {
+            uint64_t word = 0;
+            for (int k = 0; k < 64; k++) {
+                const size_t r = rw * 64 + k;
+                if (isBitSet(in[r * in_words + c / 64], static_cast<int>(c % 64))) word = SetRegBit(word, k);
+            }
+            out[c * out_words + rw] = word;
+        }
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("isBitSet/SetRegBit (bit)", kRows * kCols, elapsed.count(), out[kCols * out_words / 2]);
+
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        bit_matrix_transpose(reinterpret_cast<const uint8_t*>(in.data()), kRows, kCols,
+                             reinterpret_cast<uint8_t*>(out.data()));
+    }
+    elapsed = BenchClock::now() - start;
+    report("bit_matrix_transpose (bit)", kRows * kCols * kRepeats, elapsed.count(), out[kCols * out_words / 2]);
+
+    // 64x64 bloklar yerinde: Devrik bloklar (kt dzeni deil) llr.
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        for (size_t b = 0; b < in.size(); b += 64) transpose64x64(&in[b]);
+    }
+    elapsed = BenchClock::now() - start;
+    report("transpose64x64 yerinde (bit)", kRows * kCols * kRepeats, elapsed.count(), in[in.size() / 2]);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Elenmi bitmap taramasn read() + heap tamponu ile ve 1..N i paracyla karlatrr.
+ *
+ * Dosya lmden nce yazld iin sayfa nbelleindedir (scak nbellek): lm disk
+ * hzn deil kopyalama maliyetini ve ekirdek leklenmesini gsterir.
+ */
+void bench_mapped_bitmap() {
+    std::cout << "=== ELENM BITMAP (256 MiB dosya) ===" << std::endl;
+    const char* path = "mapped_bitmap_bench.bin";
+    const size_t kWords = (static_cast<size_t>(256) << 20) / sizeof(uint64_t);
+    const int kRepeats = 5;
+    {
+        std::vector<uint64_t> words(kWords);
+        uint64_t seed = 12345;
+        for (uint64_t& w : words) {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            w = seed ^ (seed >> 32);
+        }
+        std::FILE* file = std::fopen(path, "wb");
+        if (file == nullptr) {
+            std::cout << "dosya yazlamad, atland" << std::endl;
+            return;
+        }
+        std::fwrite(words.data(), sizeof(uint64_t), kWords, file);
+        std::fclose(file);
+    }
+
+    uint64_t sum = 0;
+    auto start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        std::vector<uint64_t> heap(kWords);
+        std::FILE* file = std::fopen(path, "rb");
+        const size_t got = std::fread(heap.data(), sizeof(uint64_t), kWords, file);
+        std::fclose(file);
+        sum += count_set_bits(heap.data(), got);
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("read() + count_set_bits (kelime)", kWords * kRepeats, elapsed.count(), sum);
+
+    MappedBitmap mapped;
+    if (!mapped.open(path)) {
+        std::cout << "mmap alamad, atland" << std::endl;
+        std::remove(path);
+        return;
+    }
+    unsigned hw = std::thread::hardware_concurrency();
+    const unsigned max_threads = (hw > 1) ? hw : 1;
+    std::vector<unsigned> thread_counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);               // Son adm: Tm ekirdekler.
+    for (unsigned t : thread_counts) {
+        sum = 0;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) sum += mapped.count(t);
+        elapsed = BenchClock::now() - start;
+        report("MappedBitmap::count T=" + std::to_string(t) + " (kelime)", kWords * kRepeats, elapsed.count(), sum);
+    }
+    mapped.close();
+    std::remove(path);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+void bench_parallel() {
+    std::cout << "=== PARALEL TOPLU LEMLER ( ALAN HAVUZ, 64 MiB) ===" << std::endl;
+    const size_t kValues = (static_cast<size_t>(64) << 20) / sizeof(uint32_t);
+    const int kRepeats = 3;
+    std::vector<uint32_t> values(kValues);
+    uint64_t seed = 777;
+    for (uint32_t& v : values) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        v = static_cast<uint32_t>(seed >> 52);          // 12-bit deerler: Paketleme genilii 12.
+    }
+    DynamicBitset a(kValues * 8);
+    DynamicBitset b(kValues * 8);
+    for (size_t i = 0; i < a.word_count(); i++) {
+        a.data()[i] = 0x9E3779B97F4A7C15ULL * (i + 1);
+        b.data()[i] = 0xC2B2AE3D27D4EB4FULL * (i + 7);
+    }
+    std::vector<uint32_t> encoded(bitpack_max_encoded_words(kValues, BitpackBlockSize::k128));
+    std::vector<uint32_t> decoded(kValues);
+    std::vector<uint32_t> selected(kValues);
+    DynamicBitset mask;
+
+    unsigned hw = std::thread::hardware_concurrency();
+    const unsigned max_threads = (hw > 1) ? hw : 1;
+    std::vector<unsigned> thread_counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
+    for (unsigned t : thread_counts) {
+        ThreadPool pool(t);
+        const std::string suffix = " T=" + std::to_string(t);
+        uint64_t sum = 0;
+        auto start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) sum += count_set_bits(pool, values.data(), kValues);
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        report("count_set_bits" + suffix + " (uint32)", kValues * kRepeats, elapsed.count(), sum);
+
+        DynamicBitset work = a;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) work.assign_xor(pool, b);
+        elapsed = BenchClock::now() - start;
+        report("DynamicBitset::assign_xor" + suffix + " (kelime)", a.word_count() * kRepeats, elapsed.count(), work.count(pool));
+
+        size_t words = 0;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) words = bitpack_encode(pool, values.data(), kValues, encoded.data());
+        elapsed = BenchClock::now() - start;
+        report("bitpack_encode" + suffix, kValues * kRepeats, elapsed.count(), words);
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) bitpack_decode(pool, encoded.data(), words, decoded.data(), kValues);
+        elapsed = BenchClock::now() - start;
+        report("bitpack_decode" + suffix, kValues * kRepeats, elapsed.count(), decoded[kValues / 3]);
+
+        size_t kept = 0;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) {
+            predicate_evaluate(pool, values.data(), kValues, Predicate<uint32_t>::in_range(1000, 2999), mask);
+            kept = predicate_compact(pool, values.data(), mask, selected.data());
+        }
+        elapsed = BenchClock::now() - start;
+        report("predicate evaluate + compact" + suffix, kValues * kRepeats, elapsed.count(), kept);
+
+        uint64_t crc = 0;
+        start = BenchClock::now();
+        for (int r = 0; r < kRepeats; r++) crc += Crc32c::compute(pool, values.data(), kValues * sizeof(uint32_t));
+        elapsed = BenchClock::now() - start;
+        report("Crc32c::compute" + suffix + " (byte)", kValues * sizeof(uint32_t) * kRepeats, elapsed.count(), crc);
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Sabit boyutlu ereve ayrma/brakma dngsn malloc/free, BlockPool ve
+ * BlockPool::Cache ile 1..N i paracnda karlatrr.
+ *
+ * Her i parac 1024 canl bloktan oluan bir pencere tutar; her admda rastgele bir
+ * blou brakp yerine yenisini ayrr (tampon hattndaki ereve yaam dngs).
+ */
+void bench_block_pool() {
+    std::cout << "=== BLOK HAVUZU (64 byte ereve, ayr + brak) ===" << std::endl;
+    const size_t kBlockSize = 64;
+    const size_t kWindow = 1024;
+    const uint64_t kOps = 4000000;
+
+    unsigned hw = std::thread::hardware_concurrency();
+    const unsigned max_threads = (hw > 1) ? hw : 1;
+    std::vector<unsigned> thread_counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
+
+    // mode 0: malloc/free, 1: BlockPool, 2: BlockPool::Cache
+    auto run = [&](unsigned threads, int mode, BlockPool& pool) {
+        std::atomic<uint64_t> checksum(0);
+        auto worker = [&](unsigned id) {
+            BlockPool::Cache cache(pool);
+            auto take = [&]() -> void* {
+                if (mode == 0) return std::malloc(kBlockSize);
+                return (mode == 1) ? pool.allocate() : cache.allocate();
+            };
+            auto give = [&](void* p) {
+                if (mode == 0) std::free(p);
+                else if (mode == 1) pool.deallocate(p);
+                else cache.deallocate(p);
+            };
+            std::vector<void*> live(kWindow);
+            for (void*& p : live) p = take();
+            uint64_t seed = 0x9E3779B97F4A7C15ULL * (id + 1);
+            uint64_t sum = 0;
+            const uint64_t ops = kOps / threads;
+            for (uint64_t i = 0; i < ops; i++) {
+                seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+                void*& slot = live[(seed >> 33) % kWindow];
+                give(slot);
+                slot = take();
+                *static_cast<uint64_t*>(slot) = i;          // Bloa dokun: Gerek kullanm taklit et.
+                sum += reinterpret_cast<uintptr_t>(slot) >> 6;
+            }
+            for (void* p : live) give(p);
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        };
+        auto start = BenchClock::now();
+        std::vector<std::thread> pool_threads;
+        for (unsigned t = 1; t < threads; t++) pool_threads.emplace_back(worker, t);
+        worker(0);
+        for (std::thread& th : pool_threads) th.join();
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        return std::make_pair(elapsed.count(), checksum.load());
+    };
+
+    for (unsigned t : thread_counts) {
+        // Pencereler + i parac bana bir dolu nbellek sar.
+        BlockPool pool;
+        pool.init(kBlockSize, t * (kWindow + BlockPool::Cache::kCapacity), 64);
+        const std::string suffix = " T=" + std::to_string(t);
+        static const char* const kNames[] = { "malloc/free", "BlockPool", "BlockPool::Cache" };
+        for (int mode = 0; mode < 3; mode++) {
+            auto result = run(t, mode, pool);
+            report(std::string(kNames[mode]) + suffix, kOps, result.first, result.second);
+        }
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Paylalan durum bitmap'i gncellemelerini mutex + DynamicBitset ile AtomicBitmap
+ * arasnda 1..N i paracnda karlatrr.
+ *
+ * Durum: Her i parac rastgele bir bayra set edip temizler. Sahiplenme: Her i
+ * parac ilk bo biti alr ve hemen brakr (yuva/kimlik ayrma).
+ */
+void bench_atomic_bitops() {
+    std::cout << "=== ATOMK BT LEMLER (4096 bitlik paylalan bitmap) ===" << std::endl;
+    const size_t kBits = 4096;
+    const uint64_t kOps = 4000000;
+
+    unsigned hw = std::thread::hardware_concurrency();
+    const unsigned max_threads = (hw > 1) ? hw : 1;
+    std::vector<unsigned> thread_counts;
+    for (unsigned t = 1; t < max_threads; t *= 2) thread_counts.push_back(t);
+    thread_counts.push_back(max_threads);
+
+    // Her i parac kOps / T ilem yapar; fn(id, i) bir ilemdir ve checksum'a eklenir.
+    auto run = [&](unsigned threads, auto fn) {
+        std::atomic<uint64_t> checksum(0);
+        auto worker = [&](unsigned id) {
+            uint64_t sum = 0;
+            const uint64_t ops = kOps / threads;
+            for (uint64_t i = 0; i < ops; i++) sum += fn(id, i);
+            checksum.fetch_add(sum, std::memory_order_relaxed);
+        };
+        auto start = BenchClock::now();
+        std::vector<std::thread> workers;
+        for (unsigned t = 1; t < threads; t++) workers.emplace_back(worker, t);
+        worker(0);
+        for (std::thread& th : workers) th.join();
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        return std::make_pair(elapsed.count(), checksum.load());
+    };
+
+    for (unsigned t : thread_counts) {
+        const std::string suffix = " T=" + std::to_string(t);
+        std::mutex lock;
+        DynamicBitset locked(kBits);
+        AtomicBitmap atomic_bits(kBits);
+
+        auto result = run(t, [&](unsigned id, uint64_t i) -> uint64_t {
+            const size_t pos = (i * 2654435761u + id * 97) % kBits;
+            std::lock_guard<std::mutex> guard(lock);
+            const bool was = locked.test(pos);
+            locked.flip(pos);
+            return was;
+        });
+        report("durum: mutex + DynamicBitset" + suffix, kOps, result.first, result.second);
+        result = run(t, [&](unsigned id, uint64_t i) -> uint64_t {
+            return atomic_bits.flip((i * 2654435761u + id * 97) % kBits, std::memory_order_acq_rel);
+        });
+        report("durum: AtomicBitmap::flip" + suffix, kOps, result.first, result.second);
+
+        locked.resize(0);
+        locked.resize(kBits);
+        for (size_t i = 0; i < kBits / 2; i++) locked.set(i);       // lk yar dolu: Arama gereki.
+        atomic_bits.clear_all();
+        for (size_t i = 0; i < kBits / 2; i++) atomic_bits.set(i);
+        result = run(t, [&](unsigned, uint64_t) -> uint64_t {
+            std::lock_guard<std::mutex> guard(lock);
+            const uint64_t* words = locked.data();
+            size_t slot = 0;
+            for (size_t w = 0; w < locked.word_count(); w++) {
+                if (words[w] == ~0ULL) continue;
+                slot = w * 64 + static_cast<size_t>(find_first_set_bit(~words[w]));
+                break;
+            }
+            locked.set(slot);
+            locked.clear(slot);
+            return slot;
+        });
+        report("sahiplen: mutex + DynamicBitset" + suffix, kOps, result.first, result.second);
+        result = run(t, [&](unsigned, uint64_t) -> uint64_t {
+            const size_t slot = atomic_bits.claim_first_clear(std::memory_order_acquire);
+            atomic_bits.clear(slot, std::memory_order_release);
+            return slot;
+        });
+        report("sahiplen: AtomicBitmap" + suffix, kOps, result.first, result.second);
+    }
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Seyrek 1M yuval hazr kuyruunda en dk grevi alma (find_first + clear + set)
+ * ve find_next ile gezmeyi DynamicBitset ile HierarchicalBitmap arasnda karlatrr.
+ */
+void bench_hierarchical_bitmap() {
+    std::cout << "=== ZET SEVYEL BITMAP (1M yuva, 64 hazr grev) ===" << std::endl;
+    const size_t kSlots = 1000000;
+    const size_t kReady = 64;
+    const uint64_t kOps = 2000000;
+    std::vector<size_t> arrivals(kOps);
+    uint64_t seed = 4242;
+    for (size_t& a : arrivals) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        a = static_cast<size_t>(seed >> 33) % kSlots;
+    }
+
+    DynamicBitset flat(kSlots);
+    HierarchicalBitmap tree(kSlots);
+    for (size_t i = 0; i < kReady; i++) {
+        flat.set(arrivals[i]);
+        tree.set(arrivals[i]);
+    }
+
+    // Zamanlayc adm: En dk numaral hazr grevi al, yerine yeni bir grev gelsin.
+    uint64_t sum = 0;
+    auto start = BenchClock::now();
+    for (uint64_t i = 0; i < kOps; i++) {
+        const size_t task = flat.find_first();
+        flat.clear(task);
+        flat.set(arrivals[i]);
+        sum += task;
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("DynamicBitset find_first + clear + set", kOps, elapsed.count(), sum);
+
+    sum = 0;
+    start = BenchClock::now();
+    for (uint64_t i = 0; i < kOps; i++) {
+        const size_t task = tree.find_first();
+        tree.clear(task);
+        tree.set(arrivals[i]);
+        sum += task;
+    }
+    elapsed = BenchClock::now() - start;
+    report("HierarchicalBitmap find_first + clear + set", kOps, elapsed.count(), sum);
+
+    // Tm hazr grevleri artan srada gezme.
+    const int kRepeats = 2000;
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        for (size_t i = flat.find_first(); i != DynamicBitset::npos; i = flat.find_next(i)) sum += i;
+    }
+    elapsed = BenchClock::now() - start;
+    report("DynamicBitset find_next (grev)", flat.count() * kRepeats, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kRepeats; r++) {
+        for (size_t i = tree.find_first(); i != HierarchicalBitmap::npos; i = tree.find_next(i)) sum += i;
+    }
+    elapsed = BenchClock::now() - start;
+    report("HierarchicalBitmap find_next (grev)", tree.count() * kRepeats, elapsed.count(), sum);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief 2^24 kimlik uzaynda seyrek kimlikler + uzun aralklardan oluan iki kmeyi
+ * DynamicBitset ve CompressedBitmap ile karlatrr: Bellek, AND/OR ve yelik sorgusu
+ * (bellek ii ve seri tampon zerinde kopyasz grnm).
+ */
+void bench_compressed_bitmap() {
+    std::cout << "=== SIKITIRILMI BITMAP (2^24 kimlik, seyrek + aralklar) ===" << std::endl;
+    const uint32_t kUniverse = 1u << 24;
+    const size_t kSparse = 20000;
+    const int kRanges = 8;
+    const uint32_t kRangeLength = 300000;
+
+    DynamicBitset flat_a(kUniverse), flat_b(kUniverse);
+    CompressedBitmap packed_a, packed_b;
+    uint64_t seed = 2024;
+    auto next_id = [&seed, kUniverse]() {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        return static_cast<uint32_t>(seed >> 33) % kUniverse;
+    };
+    for (int side = 0; side < 2; side++) {
+        DynamicBitset& flat = (side == 0) ? flat_a : flat_b;
+        CompressedBitmap& packed = (side == 0) ? packed_a : packed_b;
+        for (size_t i = 0; i < kSparse; i++) {
+            const uint32_t id = next_id();
+            flat.set(id);
+            packed.add(id);
+        }
+        for (int r = 0; r < kRanges; r++) {
+            const uint32_t begin = next_id() % (kUniverse - kRangeLength);
+            for (uint32_t id = begin; id < begin + kRangeLength; id++) flat.set(id);
+            packed.add_range(begin, static_cast<uint64_t>(begin) + kRangeLength);
+        }
+    }
+    std::cout << std::left << std::setw(40) << "Bellek: DynamicBitset / seri Compressed" << std::right
+              << flat_a.word_count() * sizeof(uint64_t) / 1024 << " KiB / " << packed_a.serialized_size() / 1024
+              << " KiB (" << packed_a.container_count() << " kap)" << std::endl;
+
+    const int kSetOps = 200;
+    uint64_t sum = 0;
+    auto start = BenchClock::now();
+    for (int r = 0; r < kSetOps; r++) {
+        DynamicBitset result = flat_a;
+        result &= flat_b;
+        sum += result.count();
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("DynamicBitset AND + count", kSetOps, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kSetOps; r++) {
+        CompressedBitmap result = packed_a;
+        result &= packed_b;
+        sum += result.cardinality();
+    }
+    elapsed = BenchClock::now() - start;
+    report("CompressedBitmap AND + cardinality", kSetOps, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kSetOps; r++) {
+        DynamicBitset result = flat_a;
+        result |= flat_b;
+        sum += result.count();
+    }
+    elapsed = BenchClock::now() - start;
+    report("DynamicBitset OR + count", kSetOps, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (int r = 0; r < kSetOps; r++) {
+        CompressedBitmap result = packed_a;
+        result |= packed_b;
+        sum += result.cardinality();
+    }
+    elapsed = BenchClock::now() - start;
+    report("CompressedBitmap OR + cardinality", kSetOps, elapsed.count(), sum);
+
+    // Rastgele yelik sorgular.
+    const size_t kQueries = 4000000;
+    std::vector<uint32_t> queries(kQueries);
+    for (uint32_t& q : queries) q = next_id();
+    std::vector<uint8_t> serialized(packed_a.serialized_size());
+    packed_a.serialize(serialized.data());
+    CompressedBitmapView view;
+    view.open(serialized.data(), serialized.size());
+
+    sum = 0;
+    start = BenchClock::now();
+    for (uint32_t q : queries) sum += flat_a.test(q);
+    elapsed = BenchClock::now() - start;
+    report("DynamicBitset test", kQueries, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (uint32_t q : queries) sum += packed_a.contains(q);
+    elapsed = BenchClock::now() - start;
+    report("CompressedBitmap contains", kQueries, elapsed.count(), sum);
+    sum = 0;
+    start = BenchClock::now();
+    for (uint32_t q : queries) sum += view.contains(q);
+    elapsed = BenchClock::now() - start;
+    report("CompressedBitmapView contains (kopyasz)", kQueries, elapsed.count(), sum);
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief 8M anahtarlk (%1, ~10 MiB) filtrede ekleme ve sorgu: Ayn bit bteli klasik
+ * Bloom filtresi (k = 7 dank bit) ile bloklu filtrenin tekli ve toplu yollar.
+ */
+void bench_bloom_filter() {
+    std::cout << "=== BLOKLU BLOOM FLTRES (8M anahtar, %1, ekirdek: " << bloom_kernel_name() << ") ===" << std::endl;
+    const size_t kKeys = static_cast<size_t>(1) << 23;
+    const int kClassicProbes = 7;
+    std::vector<uint64_t> keys(kKeys), queries(kKeys);
+    for (size_t i = 0; i < kKeys; i++) {
+        keys[i] = bloom_hash(2 * i);
+        queries[i] = bloom_hash(2 * i + (i & 1));    // Yars eklenmi, yars eklenmemi.
+    }
+
+    BlockedBloomFilter blocked;
+    blocked.init(kKeys, 0.01);
+    const uint64_t classic_bits = blocked.size_bytes() * 8;
+    DynamicBitset classic(static_cast<size_t>(classic_bits));
+    // Klasik filtre: ift kartrma (h1 + i * h2), her bit ayr bir nbellek satrnda.
+    auto classic_bit = [classic_bits](uint64_t h, int i) {
+        const uint64_t g = (h >> 32) + static_cast<uint64_t>(i) * (h | 1);
+        return static_cast<size_t>((static_cast<uint64_t>(static_cast<uint32_t>(g ^ (g >> 32))) * classic_bits) >> 32);
+    };
+
+    auto start = BenchClock::now();
+    for (uint64_t h : keys) {
+        for (int i = 0; i < kClassicProbes; i++) classic.set(classic_bit(h, i));
+    }
+    std::chrono::duration<double> elapsed = BenchClock::now() - start;
+    report("klasik insert (k = 7)", kKeys, elapsed.count(), classic.count());
+    start = BenchClock::now();
+    for (uint64_t h : keys) blocked.insert(h);
+    elapsed = BenchClock::now() - start;
+    report("BlockedBloomFilter insert", kKeys, elapsed.count(), blocked.block_count());
+    blocked.clear();
+    start = BenchClock::now();
+    blocked.insert_batch(keys.data(), kKeys);
+    elapsed = BenchClock::now() - start;
+    report("BlockedBloomFilter insert_batch", kKeys, elapsed.count(), blocked.block_count());
+
+    uint64_t hits = 0;
+    start = BenchClock::now();
+    for (uint64_t h : queries) {
+        bool found = true;
+        for (int i = 0; i < kClassicProbes && found; i++) found = classic.test(classic_bit(h, i));
+        hits += found;
+    }
+    elapsed = BenchClock::now() - start;
+    report("klasik contains (k = 7)", kKeys, elapsed.count(), hits);
+    hits = 0;
+    start = BenchClock::now();
+    for (uint64_t h : queries) hits += blocked.contains(h);
+    elapsed = BenchClock::now() - start;
+    report("BlockedBloomFilter contains", kKeys, elapsed.count(), hits);
+    DynamicBitset found_mask;
+    start = BenchClock::now();
+    blocked.contains_batch(queries.data(), kKeys, found_mask);
+    elapsed = BenchClock::now() - start;
+    report("BlockedBloomFilter contains_batch", kKeys, elapsed.count(), found_mask.count());
+    std::cout << "----------------------------------------------------" << std::endl;
+}
+
+/**
+ * @brief Benchmark uygulamasnn giri noktas.
+ */
+int main() {
+    print_bitops_dispatch(std::cout);
+    bench_spsc_ring_buffer();
+    bench_mpmc_queue_scaling();
+    bench_bitstream();
+    bench_bitpack();
+    bench_dynamic_bitset();
+    bench_rank_select();
+    bench_fir();
+    bench_iir();
+    bench_stream_filters();
+    bench_predicate_filter();
+    bench_crc();
+    bench_bit_matrix();
+    bench_mapped_bitmap();
+    bench_parallel();
+    bench_block_pool();
+    bench_atomic_bitops();
+    bench_hierarchical_bitmap();
+    bench_compressed_bitmap();
+    bench_bloom_filter();
+    return 0;
+}
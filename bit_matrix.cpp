@@ -0,0 +1,211 @@
+/**
+ * @file bit_matrix.cpp
+ * @brief Bit Matrisi Devrik ekirdekleri: 64x64 Blok Takas, 8x8 Deme ve SSE2/AVX2 Movemask.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "bit_matrix.h"
+#include "bitops.h"     // bitops_cpu_features
+#include <cstring>      // std::memcpy (hizasz yazmalar)
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define BIT_MATRIX_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define BIT_MATRIX_X86_SIMD 0
+#endif
+
+namespace {
+
+// =========================================================================
+// I. SKALER 8x8 DEMELER
+// =========================================================================
+
+// [r0, r1) satrlar ve [c0, c1) stunlar (hepsi 8'in kat) 8x8 demelerle devrilir:
+// Sekiz satrn ayn byte' tek kelimede toplanr, transpose8x8 ile evrilir ve sonucun
+// j. byte' ktnn (c + j). satrna yazlr.
+void transpose_tiles(const uint8_t* in, size_t istride, uint8_t* out, size_t ostride,
+                     size_t r0, size_t r1, size_t c0, size_t c1) {
+	for (size_t r = r0; r < r1; r += 8) {
+		for (size_t c = c0; c < c1; c += 8) {
+			const uint8_t* src = in + r * istride + c / 8;
+			uint64_t tile = 0;
+			for (int k = 0; k < 8; k++) tile |= static_cast<uint64_t>(src[k * istride]) << (8 * k);
+			tile = transpose8x8(tile);
+			uint8_t* dst = out + c * ostride + r / 8;
+			for (int j = 0; j < 8; j++) dst[j * ostride] = static_cast<uint8_t>(tile >> (8 * j));
+		}
+	}
+}
+
+// =========================================================================
+// II. SSE2 / AVX2 MOVEMASK EKRDEKLER
+// =========================================================================
+
+#if BIT_MATRIX_X86_SIMD
+
+/**
+ * MHENDSLK NOTU (Movemask devrii): movemask, her byte'n en st bitini toplar. Bir
+ * vektr 16 satrn ayn byte stununu tayorsa movemask tek komutta kt satrnn 16
+ * bitini verir; vektr kendine eklenerek (byte bana sola kaydrma) sradaki bit en ste
+ * tanr ve 8 admda byte'n tm stunlar kar. Satrlardan okunan byte'lar stun
+ * vektrlerine evirmek iin 16x8 byte devrii drt unpack aamasyla (8, 16, 32, 64 bit)
+ * yaplr. AVX2'de 0..15 satrlar alt, 16..31 satrlar st 128-bit eritte ayn
+ * erit ii unpack'lerle ilenir; movemask 32 satr tek seferde verir.
+ */
+
+// v[k]: 16 satrn (in, in + stride, ...) k. byte' (k = 0..7).
+void gather_columns_sse2(const uint8_t* in, size_t stride, __m128i v[8]) {
+	__m128i t[8];
+	for (int k = 0; k < 8; k++) {
+		const __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + (2 * k) * stride));
+		const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(in + (2 * k + 1) * stride));
+		t[k] = _mm_unpacklo_epi8(a, b);             // 16-bit e c: satr (2k, 2k+1), byte c.
+	}
+	__m128i u[8];
+	for (int k = 0; k < 4; k++) {
+		u[2 * k] = _mm_unpacklo_epi16(t[2 * k], t[2 * k + 1]);       // 32-bit e: 4 satr, byte 0..3.
+		u[2 * k + 1] = _mm_unpackhi_epi16(t[2 * k], t[2 * k + 1]);   // byte 4..7.
+	}
+	__m128i w[8];
+	for (int h = 0; h < 2; h++) {                   // h = 0: satr 0..7, h = 1: satr 8..15.
+		w[4 * h + 0] = _mm_unpacklo_epi32(u[4 * h + 0], u[4 * h + 2]);  // 64-bit e: 8 satr, byte 0, 1.
+		w[4 * h + 1] = _mm_unpackhi_epi32(u[4 * h + 0], u[4 * h + 2]);  // byte 2, 3.
+		w[4 * h + 2] = _mm_unpacklo_epi32(u[4 * h + 1], u[4 * h + 3]);  // byte 4, 5.
+		w[4 * h + 3] = _mm_unpackhi_epi32(u[4 * h + 1], u[4 * h + 3]);  // byte 6, 7.
+	}
+	for (int k = 0; k < 4; k++) {
+		v[2 * k] = _mm_unpacklo_epi64(w[k], w[4 + k]);
+		v[2 * k + 1] = _mm_unpackhi_epi64(w[k], w[4 + k]);
+	}
+}
+
+// 16 satr x 64 stunluk blok. out: ktda (stun 0, satr 0) konumu.
+void transpose_block_sse2(const uint8_t* in, size_t istride, uint8_t* out, size_t ostride) {
+	__m128i v[8];
+	gather_columns_sse2(in, istride, v);
+	for (int c = 0; c < 8; c++) {
+		__m128i x = v[c];
+		for (int bit = 7; bit >= 0; bit--) {
+			const uint16_t row_bits = static_cast<uint16_t>(_mm_movemask_epi8(x));
+			std::memcpy(out + (8 * c + bit) * ostride, &row_bits, sizeof(row_bits));
+			x = _mm_add_epi8(x, x);
+		}
+	}
+}
+
+__attribute__((target("avx2")))
+__m256i load_row_pair(const uint8_t* lo, const uint8_t* hi) {
+	const __m128i a = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(lo));
+	const __m128i b = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(hi));
+	return _mm256_inserti128_si256(_mm256_castsi128_si256(a), b, 1);
+}
+
+// 32 satr x 64 stunluk blok: SSE2 ekirdeinin 256-bit karl.
+__attribute__((target("avx2")))
+void transpose_block_avx2(const uint8_t* in, size_t istride, uint8_t* out, size_t ostride) {
+	const uint8_t* upper = in + 16 * istride;
+	__m256i t[8];
+	for (int k = 0; k < 8; k++) {
+		const __m256i a = load_row_pair(in + (2 * k) * istride, upper + (2 * k) * istride);
+		const __m256i b = load_row_pair(in + (2 * k + 1) * istride, upper + (2 * k + 1) * istride);
+		t[k] = _mm256_unpacklo_epi8(a, b);
+	}
+	__m256i u[8];
+	for (int k = 0; k < 4; k++) {
+		u[2 * k] = _mm256_unpacklo_epi16(t[2 * k], t[2 * k + 1]);
+		u[2 * k + 1] = _mm256_unpackhi_epi16(t[2 * k], t[2 * k + 1]);
+	}
+	__m256i w[8];
+	for (int h = 0; h < 2; h++) {
+		w[4 * h + 0] = _mm256_unpacklo_epi32(u[4 * h + 0], u[4 * h + 2]);
+		w[4 * h + 1] = _mm256_unpackhi_epi32(u[4 * h + 0], u[4 * h + 2]);
+		w[4 * h + 2] = _mm256_unpacklo_epi32(u[4 * h + 1], u[4 * h + 3]);
+		w[4 * h + 3] = _mm256_unpackhi_epi32(u[4 * h + 1], u[4 * h + 3]);
+	}
+	for (int k = 0; k < 4; k++) {
+		for (int half = 0; half < 2; half++) {
+			__m256i x = half ? _mm256_unpackhi_epi64(w[k], w[4 + k]) : _mm256_unpacklo_epi64(w[k], w[4 + k]);
+			const int c = 2 * k + half;
+			for (int bit = 7; bit >= 0; bit--) {
+				const uint32_t row_bits = static_cast<uint32_t>(_mm256_movemask_epi8(x));
+				std::memcpy(out + (8 * c + bit) * ostride, &row_bits, sizeof(row_bits));
+				x = _mm256_add_epi8(x, x);
+			}
+		}
+	}
+}
+
+#endif // BIT_MATRIX_X86_SIMD
+
+// =========================================================================
+// III. DISPATCH
+// =========================================================================
+
+struct BitMatrixDispatch {
+	void (*block)(const uint8_t*, size_t, uint8_t*, size_t);   ///< block_rows x 64 blok ekirdei.
+	size_t block_rows;                                          ///< 0: Yalnzca 8x8 demeler.
+	const char* name;
+};
+
+BitMatrixDispatch build_bit_matrix_dispatch() {
+	BitMatrixDispatch d = { nullptr, 0, "scalar" };
+#if BIT_MATRIX_X86_SIMD
+	d = { transpose_block_sse2, 16, "sse2" };   // x86-64 temel komut kmesi.
+	if (bitops_cpu_features().avx2) d = { transpose_block_avx2, 32, "avx2" };
+#endif
+	return d;
+}
+
+const BitMatrixDispatch& bit_matrix_dispatch() {
+	static const BitMatrixDispatch d = build_bit_matrix_dispatch();
+	return d;
+}
+
+} // namespace
+
+
+// =========================================================================
+// IV. GENEL API
+// =========================================================================
+
+void transpose64x64(uint64_t* m) {
+	// Seviye j'de (32, 16, ..., 1) maske, j bitlik bloklarn alt yarlarn seer:
+	// 0x00000000FFFFFFFF, 0x0000FFFF0000FFFF, ..., 0x5555555555555555.
+	uint64_t mask = 0x00000000FFFFFFFFULL;
+	for (int j = 32; j != 0; j >>= 1, mask ^= (mask << j)) {
+		// k, j. biti sfr olan satrlar gezer; ei k | j'dir.
+		for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			const uint64_t t = ((m[k] >> j) ^ m[k | j]) & mask;
+			m[k] ^= t << j;
+			m[k | j] ^= t;
+		}
+	}
+}
+
+void bit_matrix_transpose(const uint8_t* in, size_t rows, size_t cols, uint8_t* out) {
+	const size_t istride = cols / 8;
+	const size_t ostride = rows / 8;
+	const BitMatrixDispatch& d = bit_matrix_dispatch();
+
+	size_t simd_rows = 0;
+	const size_t simd_cols = cols & ~static_cast<size_t>(63);
+	if (d.block_rows != 0 && simd_cols != 0) {
+		simd_rows = rows - rows % d.block_rows;
+		for (size_t r = 0; r < simd_rows; r += d.block_rows) {
+			for (size_t c = 0; c < simd_cols; c += 64) {
+				d.block(in + r * istride + c / 8, istride, out + c * ostride + r / 8, ostride);
+			}
+		}
+		transpose_tiles(in, istride, out, ostride, 0, simd_rows, simd_cols, cols);
+	}
+	transpose_tiles(in, istride, out, ostride, simd_rows, rows, 0, cols);
+}
+
+const char* bit_matrix_kernel_name() {
+	return bit_matrix_dispatch().name;
+}
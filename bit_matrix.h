@@ -0,0 +1,79 @@
+/**
+ * @file bit_matrix.h
+ * @brief Bit Matrisi Devrik (Transpose) ekirdekleri: 8x8, 64x64 ve Tampon zerinde Rastgele Boyut.
+ *
+ * Kelime ynelimli (word-oriented) dzen ile bit dilimli (bit-sliced) dzen arasnda
+ * dnm yapar. Bit dilimli dzende j. kelime, tm girdilerin j. bitlerini tar; bylece
+ * tek bir AND/XOR 64 girdi zerinde ayn boolean/parity ilemini paralel yrtr.
+ * isBitSet/SetRegBit ile bit bit devrik almak n^2 ardr; buradaki ekirdekler kelime
+ * dzeyinde XOR-takas (delta swap) ve SIMD movemask kullanr.
+ *
+ * Bit dzeni (DynamicBitset ile ayn, LSB tabanl): r. satrn c. biti, satrn
+ * (c / 8). byte'nn (c % 8). bitidir. Little-endian hedefte uint64_t dizisi de ayn
+ * dzendir: words[r] satr r, words[r] >> c & 1 stun c.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef BIT_MATRIX_H
+#define BIT_MATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief 8x8 bit matrisinin devrii: Byte i = satr i, bit j = stun j.
+ *
+ * MHENDSLK NOTU (XOR-takas): 64 bitlik kelimede (i, j) bitinin indeksi 8i + j'dir.
+ * Devrik, kegen etrafndaki bloklar  admda takas eder: 1x1 bloklar (uzaklk 7),
+ * 2x2 bloklar (uzaklk 14), 4x4 bloklar (uzaklk 28). Her adm
+ * t = (x ^ (x >> d)) & m; x ^= t ^ (t << d) ile dalsz ve 6 ilemliktir.
+ *
+ * @param x Satr-ncelikli 8x8 matris.
+ * @return Devrik matris.
+ */
+constexpr uint64_t transpose8x8(uint64_t x) {
+    uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AAULL;
+    x = x ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCCULL;
+    x = x ^ t ^ (t << 14);
+    t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0ULL;
+    return x ^ t ^ (t << 28);
+}
+
+/**
+ * @brief 64x64 bit matrisinin yerinde (in-place) devrii: m[i] satr i, bit j stun j.
+ *
+ * zyinelemeli blok takas: Matris 32x32'lik drt bloa blnr ve sa st ile sol alt
+ * bloklar takas edilir; ayn ilem 16, 8, 4, 2, 1 boyutlu bloklarda tekrarlanr. Her
+ * seviye 32 satr ifti zerinde tek bir XOR-takas yapar: 6 x 32 = 192 adm, bit bana
+ * yaklak 0.3 ilem.
+ *
+ * @param m 64 kelimelik matris.
+ */
+void transpose64x64(uint64_t* m);
+
+/**
+ * @brief rows x cols bit matrisinin devriini 'out'a yazar (cols x rows).
+ *
+ * Girdinin satr adm (stride) cols / 8, ktnnki rows / 8 byte'tr. 16/32 satrlk ve
+ * 64 stunluk bloklar SSE2/AVX2 movemask ekirdeiyle, kenarlar 8x8 demelerle ilenir.
+ *
+ * rnek (bit dilimleme): n adet uint64_t deer iin
+ * bit_matrix_transpose(words, n, 64, slices) sonrasnda slices'n j. satr (n / 8 byte)
+ * tm deerlerin j. bitleridir. Ayn ar (n ile 64 yer deitirerek) geri dntrr.
+ *
+ * @param in Girdi matrisi.
+ * @param rows Satr says (8'in kat).
+ * @param cols Stun says (8'in kat).
+ * @param out kt matrisi (rows * cols / 8 byte); 'in' ile akmamaldr.
+ */
+void bit_matrix_transpose(const uint8_t* in, size_t rows, size_t cols, uint8_t* out);
+
+/// Seilen bit_matrix_transpose ekirdeinin ad ("avx2", "sse2" veya "scalar").
+const char* bit_matrix_kernel_name();
+
+#endif // BIT_MATRIX_H
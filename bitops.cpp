@@ -2,143 +2,373 @@
  * @file bitops.cpp
  * @brief oklu Bit Genilikleri iin Kapsaml Bitwise lemleri Ktphanesi Implementasyonu.
  *
- * Bu dosya, uint8_t'den uint64_t'ye kadar tm standart tam say tipleri iin
- * temel maniplasyon, alan ynetimi, ak kontrol ve analiz ilemlerini
- * gerekletiren fonksiyon ar yklemelerini ierir.
- * ablon (template) implementasyonlar Linker sorununu nlemek iin 'bitops.h' dosyasnda tutulmutur.
+ * Tek kelimelik (single register) ilemler 'bitops.h' iinde constexpr ablonlar olarak
+ * tanmldr. Bu dosya yalnzca satr iine alnmas anlamsz olan ksmlar ierir:
+ * alma zaman CPU dispatch katman ve tampon (bulk) ekirdekleri.
  *
  * @author Doukan Avc
  * @date 15 Aralk 2025
- * @version 1.1.0 (Template/Overloading Birleimi)
+ * @version 1.2.0 (constexpr Header-Only ablon ekirdek)
  * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
  */
 
 #include "bitops.h" // Prototipler ve ablon implementasyonlar burada
-#include <cstdio>   // C stili I/O fonksiyonlar iin (Gerekliyse)
-#include <limits>   // std::numeric_limits<T>::digits kullanm iin (RotateLeft/Right'ta N deeri iin)
+#include "thread_pool.h" // ThreadPool::parallel_for, kParallelGrainBytes
+#include <atomic>
+#include <cstring>  // std::memcpy (hizasz/unaligned 64-bit okumalar iin), std::memmove
+
+// x86 SIMD/BMI ekirdekleri yalnzca GCC/Clang ile x86-64 hedeflerinde derlenir.
+// Dier platformlarda (ARM MCU vb.) sadece tanabilir skaler yol kalr.
+#if defined(__x86_64__) && defined(__GNUC__)
+#define BITOPS_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define BITOPS_X86_SIMD 0
+#endif
 
 // =========================================================================
-// I. TEMEL MANPLASYON LEMLER (SINGLE BIT OPERATIONS)
+// 0. ALIMA ZAMANI DISPATCH KATMANI (RUNTIME CPU DISPATCH)
 // =========================================================================
 
 /**
- * MHENDSLK NOTU: Set/Clear/Toggle ilemlerinde, tip uyumluluu ve olas tamsay
- * ykseltmeleri (Integer Promotion) nedeniyle `1` literalinin (uintX_t) tipine
- * aka cast edilmesi veya doru suffix (U, UL, ULL) kullanlmas KRTKTR.
+ * MHENDSLK NOTU: Tek bir binary farkl ilemcilere (kark filo) datld iin
+ * POPCNT/AVX2 gibi komutlar derleme zamannda (-march) alamaz.
+ * Bunun yerine skaler ve donanm ekirdekleri ayr ayr derlenir (__attribute__((target))),
+ * CPUID program balangcnda bir kez sorgulanr ve ekirdekler bir fonksiyon iaretisi
+ * tablosu zerinden balanr. TZCNT/BEXTR/BZHI gibi tek komutluk ilemler dolayl
+ * ar (indirect call) maliyetini kaldramayaca iin dispatch edilmez; 'bitops.h'
+ * iinde satr iine alnr ve komut seimi derleme bayraklarna braklr.
  */
+namespace {
 
-// SetRegBit (Biti 1 Yapma) Implementasyonlar (Maskeleme: OR |)
-uint8_t SetRegBit(uint8_t reg, int index) {
-	return reg | ((uint8_t)1 << index);	// 8-bit maskeleme iin (uint8_t)1 cast'.
-}
-uint16_t SetRegBit(uint16_t reg, int index) {
-	return reg | ((uint16_t)1 << index);
-}
-uint32_t SetRegBit(uint32_t reg, int index) {
-	return reg | (1U << index);	// 32-bit iin 1U suffix'i kullanlr.
-}
-uint64_t SetRegBit(uint64_t reg, int index) {
-	return reg | (1ULL << index);	// 64-bit iin 1ULL suffix'i KRTKTR.
-}
+using bitops_detail::popcount64_swar;
 
+// Tanabilir skaler ekirdek: 8'er byte'lk hizasz okumalar + kalan byte'lar.
+uint64_t popcount_bytes_scalar(const uint8_t* data, size_t bytes) {
+	uint64_t total = 0;
+	size_t i = 0;
+	for (; i + 8 <= bytes; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, data + i, sizeof(word));
+		total += popcount64_swar(word);
+	}
+	for (; i < bytes; i++) {
+		total += popcount64_swar(data[i]);
+	}
+	return total;
+}
 
-// ClearRegBit (Biti 0 Yapma) Implementasyonlar (Maskeleme: AND & ~)
-uint8_t ClearRegBit(uint8_t reg, int index) {
-	return reg & ~((uint8_t)1 << index);
+int popcount64_scalar(uint64_t x) {
+	return popcount64_swar(x);
 }
-uint16_t ClearRegBit(uint16_t reg, int index) {
-	return reg & ~((uint16_t)1 << index);
+
+// Tamponu tek bir 64-bit kelimeye XOR ile katlar (parity(tampon) = parity(katlanm kelime)).
+uint64_t xor_fold_bytes_scalar(const uint8_t* data, size_t bytes) {
+	uint64_t acc = 0;
+	size_t i = 0;
+	for (; i + 8 <= bytes; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, data + i, sizeof(word));
+		acc ^= word;
+	}
+	for (; i < bytes; i++) acc ^= data[i];
+	return acc;
 }
-uint32_t ClearRegBit(uint32_t reg, int index) {
-	return reg & ~(1U << index);
+
+// ok kelimeli sola kaydrma: dst[i] = (src[i - q] << r) | (src[i - q - 1] >> (64 - r)).
+// Yksek kelimeden aa doru yazlr; bylece dst == src iken okunacak kelimeler ezilmez.
+void shift_words_left_scalar(uint64_t* dst, const uint64_t* src, size_t nwords, size_t q, unsigned r) {
+	size_t i = nwords;
+	if (r == 0) {
+		// Kelime hizal: Kelime kopyas (memmove akan aralklar doru tar).
+		if (nwords > q) std::memmove(dst + q, src, (nwords - q) * sizeof(uint64_t));
+		i = (nwords > q) ? q : nwords;
+	} else {
+		for (; i > q + 1; i--) dst[i - 1] = (src[i - 1 - q] << r) | (src[i - 2 - q] >> (64 - r));
+		if (i > q) dst[--i] = src[0] << r;
+	}
+	for (; i > 0; i--) dst[i - 1] = 0;
 }
-uint64_t ClearRegBit(uint64_t reg, int index) {
-	return reg & ~(1ULL << index);
+
+// ok kelimeli saa kaydrma: dst[i] = (src[i + q] >> r) | (src[i + q + 1] << (64 - r)), src_words
+// tesi '0'. Yalnzca ilk 'count' kt kelimesi yazlr; Merge ise mevcut deerle OR'lanr
+// (dndrmenin sarmalanan ksm). Alak kelimeden yukar doru yazlr (yerinde gvenli).
+template<bool Merge>
+void shift_words_right_scalar(uint64_t* dst, const uint64_t* src, size_t src_words, size_t count,
+                              size_t q, unsigned r) {
+	for (size_t i = 0; i < count; i++) {
+		const size_t j = i + q;
+		uint64_t word = 0;
+		if (j < src_words) {
+			word = src[j] >> r;
+			if (r != 0 && j + 1 < src_words) word |= src[j + 1] << (64 - r);
+		}
+		dst[i] = Merge ? (dst[i] | word) : word;
+	}
 }
 
-// ToggleRegBit (Biti Ters evirme) Implementasyonlar (Maskeleme: XOR ^)
-uint8_t ToggleRegBit(uint8_t reg, int index) {
-	return reg ^ ((uint8_t)1 << index);
+#if BITOPS_X86_SIMD
+
+__attribute__((target("popcnt")))
+int popcount64_popcnt(uint64_t x) {
+	return __builtin_popcountll(x);	// -mpopcnt hedefinde tek POPCNT komutuna iner.
 }
-uint16_t ToggleRegBit(uint16_t reg, int index) {
-	return reg ^ ((uint16_t)1 << index);
+
+// AVX2: 4-bit'lik nibble tablosu ile (pshufb) 256-bit vektr popcount'u.
+// Sonu, 4 adet 64-bit eride (lane) dalm ksmi toplamlardr.
+__attribute__((target("avx2")))
+inline __m256i popcount256_avx2(__m256i v) {
+	const __m256i lookup = _mm256_setr_epi8(
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+		0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+	const __m256i low_mask = _mm256_set1_epi8(0x0F);
+	__m256i lo = _mm256_and_si256(v, low_mask);
+	__m256i hi = _mm256_and_si256(_mm256_srli_epi16(v, 4), low_mask);
+	__m256i cnt = _mm256_add_epi8(_mm256_shuffle_epi8(lookup, lo),
+	                              _mm256_shuffle_epi8(lookup, hi));
+	return _mm256_sad_epu8(cnt, _mm256_setzero_si256());
 }
-uint32_t ToggleRegBit(uint32_t reg, int index) {
-	return reg ^ (1U << index);
+
+// Carry-Save Adder:  vektr (a, b, c) bit baznda toplar; h = elde, l = toplam.
+__attribute__((target("avx2")))
+inline void csa256(__m256i& h, __m256i& l, __m256i a, __m256i b, __m256i c) {
+	__m256i u = _mm256_xor_si256(a, b);
+	h = _mm256_or_si256(_mm256_and_si256(a, b), _mm256_and_si256(u, c));
+	l = _mm256_xor_si256(u, c);
 }
-uint64_t ToggleRegBit(uint64_t reg, int index) {
-	return reg ^ (1ULL << index);
+
+// AVX2 Harley-Seal ekirdei: 16 vektrlk (512 byte) bloklarda CSA aac ile
+// popcount ars saysn 16'da 1'e indirir.
+__attribute__((target("avx2")))
+uint64_t popcount_bytes_avx2(const uint8_t* data, size_t bytes) {
+	const size_t vecs = bytes / 32;
+	const __m256i* d = reinterpret_cast<const __m256i*>(data);
+	__m256i total = _mm256_setzero_si256();
+	__m256i ones = _mm256_setzero_si256();
+	__m256i twos = _mm256_setzero_si256();
+	__m256i fours = _mm256_setzero_si256();
+	__m256i eights = _mm256_setzero_si256();
+	__m256i sixteens, twosA, twosB, foursA, foursB, eightsA, eightsB;
+	size_t i = 0;
+	for (; i + 16 <= vecs; i += 16) {
+		csa256(twosA, ones, ones, _mm256_loadu_si256(d + i + 0), _mm256_loadu_si256(d + i + 1));
+		csa256(twosB, ones, ones, _mm256_loadu_si256(d + i + 2), _mm256_loadu_si256(d + i + 3));
+		csa256(foursA, twos, twos, twosA, twosB);
+		csa256(twosA, ones, ones, _mm256_loadu_si256(d + i + 4), _mm256_loadu_si256(d + i + 5));
+		csa256(twosB, ones, ones, _mm256_loadu_si256(d + i + 6), _mm256_loadu_si256(d + i + 7));
+		csa256(foursB, twos, twos, twosA, twosB);
+		csa256(eightsA, fours, fours, foursA, foursB);
+		csa256(twosA, ones, ones, _mm256_loadu_si256(d + i + 8), _mm256_loadu_si256(d + i + 9));
+		csa256(twosB, ones, ones, _mm256_loadu_si256(d + i + 10), _mm256_loadu_si256(d + i + 11));
+		csa256(foursA, twos, twos, twosA, twosB);
+		csa256(twosA, ones, ones, _mm256_loadu_si256(d + i + 12), _mm256_loadu_si256(d + i + 13));
+		csa256(twosB, ones, ones, _mm256_loadu_si256(d + i + 14), _mm256_loadu_si256(d + i + 15));
+		csa256(foursB, twos, twos, twosA, twosB);
+		csa256(eightsB, fours, fours, foursA, foursB);
+		csa256(sixteens, eights, eights, eightsA, eightsB);
+		total = _mm256_add_epi64(total, popcount256_avx2(sixteens));
+	}
+	// Ara seviyeleri arlklaryla (16, 8, 4, 2, 1) toplama ekle.
+	total = _mm256_slli_epi64(total, 4);
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256_avx2(eights), 3));
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256_avx2(fours), 2));
+	total = _mm256_add_epi64(total, _mm256_slli_epi64(popcount256_avx2(twos), 1));
+	total = _mm256_add_epi64(total, popcount256_avx2(ones));
+	for (; i < vecs; i++) {
+		total = _mm256_add_epi64(total, popcount256_avx2(_mm256_loadu_si256(d + i)));
+	}
+	uint64_t lanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes), total);
+	return lanes[0] + lanes[1] + lanes[2] + lanes[3]
+	     + popcount_bytes_scalar(data + vecs * 32, bytes - vecs * 32);
 }
 
-// isBitSet (Bit Kontrol) Implementasyonlar
-bool isBitSet(uint8_t reg, int index) {	
-	// Shift-and-check (Kaydr ve kontrol et) yntemi kullanlr.
-	return (reg >> index) & 1;
+// AVX-512 VPOPCNTDQ ekirdei: Donanm 64-bit erit popcount'u, 64 byte/iterasyon.
+__attribute__((target("avx512f,avx512vpopcntdq")))
+uint64_t popcount_bytes_avx512(const uint8_t* data, size_t bytes) {
+	__m512i acc0 = _mm512_setzero_si512();
+	__m512i acc1 = _mm512_setzero_si512();
+	size_t i = 0;
+	// ki bamsz akmlatr, popcnt gecikmesini (latency) gizler.
+	for (; i + 128 <= bytes; i += 128) {
+		acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+		acc1 = _mm512_add_epi64(acc1, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i + 64)));
+	}
+	for (; i + 64 <= bytes; i += 64) {
+		acc0 = _mm512_add_epi64(acc0, _mm512_popcnt_epi64(_mm512_loadu_si512(data + i)));
+	}
+	uint64_t lanes[8];
+	_mm512_storeu_si512(lanes, _mm512_add_epi64(acc0, acc1));
+	uint64_t total = 0;
+	for (int k = 0; k < 8; k++) total += lanes[k];
+	return total + popcount_bytes_scalar(data + i, bytes - i);
 }
-bool isBitSet(uint16_t reg, int index) {	
-	return (reg >> index) & 1;
+
+// AVX2 XOR katlama: Drt bamsz akmlatr, 128 byte/iterasyon (bellek bant geniliiyle snrl).
+__attribute__((target("avx2")))
+uint64_t xor_fold_bytes_avx2(const uint8_t* data, size_t bytes) {
+	__m256i acc0 = _mm256_setzero_si256(), acc1 = _mm256_setzero_si256();
+	__m256i acc2 = _mm256_setzero_si256(), acc3 = _mm256_setzero_si256();
+	size_t i = 0;
+	for (; i + 128 <= bytes; i += 128) {
+		acc0 = _mm256_xor_si256(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+		acc1 = _mm256_xor_si256(acc1, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 32)));
+		acc2 = _mm256_xor_si256(acc2, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 64)));
+		acc3 = _mm256_xor_si256(acc3, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i + 96)));
+	}
+	for (; i + 32 <= bytes; i += 32) {
+		acc0 = _mm256_xor_si256(acc0, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i)));
+	}
+	uint64_t lanes[4];
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(lanes),
+	                    _mm256_xor_si256(_mm256_xor_si256(acc0, acc1), _mm256_xor_si256(acc2, acc3)));
+	return lanes[0] ^ lanes[1] ^ lanes[2] ^ lanes[3] ^ xor_fold_bytes_scalar(data + i, bytes - i);
 }
-bool isBitSet(uint32_t reg, int index) {	
-	return (reg >> index) & 1U;
+
+// AVX2 funnel shift: 4 kelimelik blokta iki hizasz okuma (hi ve bir kelime kaydrlm lo),
+// VPSLLQ/VPSRLQ ve OR. Okumalar her blokta yazmadan nce yaplr ve yazma yn okumalarn
+// nnde kalmaz; yerinde (dst == src) ar gvenlidir. Kenar kelimeler skaler yoldadr.
+__attribute__((target("avx2")))
+void shift_words_left_avx2(uint64_t* dst, const uint64_t* src, size_t nwords, size_t q, unsigned r) {
+	if (r == 0) {
+		shift_words_left_scalar(dst, src, nwords, q, r);
+		return;
+	}
+	const __m128i left = _mm_cvtsi32_si128(static_cast<int>(r));
+	const __m128i right = _mm_cvtsi32_si128(static_cast<int>(64 - r));
+	size_t i = nwords;                                  // Yazlacak blok: [i - 4, i).
+	for (; i >= q + 5 && i >= 4; i -= 4) {
+		const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 4 - q));
+		const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i - 5 - q));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i - 4),
+		                    _mm256_or_si256(_mm256_sll_epi64(hi, left), _mm256_srl_epi64(lo, right)));
+	}
+	shift_words_left_scalar(dst, src, i, q, r);        // Kalan alt kelimeler [0, i).
 }
-bool isBitSet(uint64_t reg, int index) {	
-	return (reg >> index) & 1ULL; // 64-bit iin 1ULL kullanm.
+
+template<bool Merge>
+__attribute__((target("avx2")))
+void shift_words_right_avx2(uint64_t* dst, const uint64_t* src, size_t src_words, size_t count,
+                            size_t q, unsigned r) {
+	const __m128i right = _mm_cvtsi32_si128(static_cast<int>(r));
+	const __m128i left = _mm_cvtsi32_si128(static_cast<int>(64 - r));  // r == 0: VPSLLQ 64 -> 0.
+	size_t i = 0;
+	for (; i + 4 <= count && i + q + 5 <= src_words; i += 4) {
+		const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + q));
+		const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i + q + 1));
+		__m256i word = _mm256_or_si256(_mm256_srl_epi64(lo, right), _mm256_sll_epi64(hi, left));
+		if (Merge) word = _mm256_or_si256(word, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst + i)));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), word);
+	}
+	// Dng altysa i < src_words'tr; kalan kelimeler ayn formlle skaler yoldan.
+	shift_words_right_scalar<Merge>(dst + i, src + i, src_words - i, count - i, q, r);
 }
 
+#endif // BITOPS_X86_SIMD
 
-// =========================================================================
-// II. BT ALANI LEMLER (BIT FIELD OPERATIONS)
-// =========================================================================
+struct DispatchTable {
+	int (*popcount64)(uint64_t);
+	uint64_t (*popcount_bytes)(const uint8_t*, size_t);
+	uint64_t (*xor_fold_bytes)(const uint8_t*, size_t);
+	void (*shift_words_left)(uint64_t*, const uint64_t*, size_t, size_t, unsigned);
+	void (*shift_words_right)(uint64_t*, const uint64_t*, size_t, size_t, size_t, unsigned);
+	void (*shift_words_right_merge)(uint64_t*, const uint64_t*, size_t, size_t, size_t, unsigned);
+	BitopsCpuFeatures features;
+	BitopsDispatchInfo info;
+};
 
-// get_bit_field (Bit Alan Oku) Implementasyonlar
-uint8_t get_bit_field(uint8_t reg, int start_bit, int length) {
-	// Maske: (1 << length) - 1. Okuma: nce kaydr, sonra maskele.
-	uint8_t mask = (1U << length) - 1U;
-	return (reg >> start_bit) & mask; 
-}
-uint16_t get_bit_field(uint16_t reg, int start_bit, int length) {
-	uint16_t mask = (1U << length) - 1U;
-	return (reg >> start_bit) & mask;
+BitopsCpuFeatures probe_cpu_features() {
+	BitopsCpuFeatures f = {};
+#if BITOPS_X86_SIMD
+	__builtin_cpu_init();
+	f.popcnt = __builtin_cpu_supports("popcnt");
+	f.bmi1 = __builtin_cpu_supports("bmi");
+	f.bmi2 = __builtin_cpu_supports("bmi2");
+	// AMD Zen1/Zen2 ve Excavator'da PDEP/PEXT mikrokodludur (~250 dng); bu ilemcilerde kullanlmaz.
+	f.bmi2_fast = f.bmi2 && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2")
+	                     && !__builtin_cpu_is("amdfam15h");
+	f.lzcnt = __builtin_cpu_supports("lzcnt");
+	f.sse4_1 = __builtin_cpu_supports("sse4.1");
+	f.sse4_2 = __builtin_cpu_supports("sse4.2");
+	f.avx2 = __builtin_cpu_supports("avx2");
+	f.avx512_vpopcntdq = __builtin_cpu_supports("avx512vpopcntdq");
+	f.avx512bw = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw");
+	f.avx512_vbmi2 = f.avx512bw && __builtin_cpu_supports("avx512vbmi2");
+#endif
+	return f;
 }
-uint32_t get_bit_field(uint32_t reg, int start_bit, int length) {
-	uint32_t mask = (1U << length) - 1U;
-	return (reg >> start_bit) & mask;
+
+DispatchTable build_dispatch_table() {
+	DispatchTable t;
+	t.features = probe_cpu_features();
+	t.popcount64 = popcount64_scalar;         t.info.count_set_bits = "scalar-swar";
+	t.popcount_bytes = popcount_bytes_scalar; t.info.bulk_popcount = "scalar-swar";
+	t.xor_fold_bytes = xor_fold_bytes_scalar; t.info.bulk_parity = "scalar-xor";
+	t.shift_words_left = shift_words_left_scalar;
+	t.shift_words_right = shift_words_right_scalar<false>;
+	t.shift_words_right_merge = shift_words_right_scalar<true>;
+	t.info.bulk_shift = "scalar-funnel";
+	// Satr ii (inline) ilemler: Komut seimi bu ktphanenin derleme bayraklarna gre raporlanr.
+	t.info.find_first_set_bit = "inline-ctz";
+#if defined(__BMI2__)
+	t.info.get_bit_field = "inline-bmi2";
+	t.info.set_bit_field = "inline-bmi2";
+#else
+	t.info.get_bit_field = "inline-mask";
+	t.info.set_bit_field = "inline-mask";
+#endif
+#if BITOPS_X86_SIMD
+	const BitopsCpuFeatures& f = t.features;
+	if (f.popcnt) { t.popcount64 = popcount64_popcnt; t.info.count_set_bits = "popcnt"; }
+	if (f.avx2) {
+		t.popcount_bytes = popcount_bytes_avx2; t.info.bulk_popcount = "avx2-harley-seal";
+		t.xor_fold_bytes = xor_fold_bytes_avx2; t.info.bulk_parity = "avx2-xor";
+		t.shift_words_left = shift_words_left_avx2;
+		t.shift_words_right = shift_words_right_avx2<false>;
+		t.shift_words_right_merge = shift_words_right_avx2<true>;
+		t.info.bulk_shift = "avx2-funnel";
+	}
+	if (f.avx512_vpopcntdq) { t.popcount_bytes = popcount_bytes_avx512; t.info.bulk_popcount = "avx512-vpopcntdq"; }
+#endif
+#if !BITOPS_RUNTIME_POPCOUNT
+	t.info.count_set_bits = "inline-popcnt";	// Derleme birimi zaten POPCNT hedefliyor (veya x86 d).
+#endif
+	return t;
 }
-uint64_t get_bit_field(uint64_t reg, int start_bit, int length) {
-	// 64-bit iin maske oluturulurken 1ULL kullanlr.
-	uint64_t mask = (1ULL << length) - 1ULL; 
-	return (reg >> start_bit) & mask;
+
+// Fonksiyon-ii static: C++11'den itibaren thread-safe ve tek seferlik balatma.
+// Baka bir eviri biriminin statik balatcsndan arlsa bile (static init order) gvenlidir.
+const DispatchTable& dispatch() {
+	static const DispatchTable table = build_dispatch_table();
+	return table;
 }
 
+// CPUID sorgusunu ilk arya brakmak yerine program balangcnda tetikler.
+[[maybe_unused]] const bool g_dispatch_probed = (dispatch(), true);
+
+} // namespace
 
-// set_bit_field (Bit Alan Yaz) Implementasyonlar
-uint8_t set_bit_field(uint8_t reg, int start_bit, int length, uint8_t new_value) {
-	uint8_t mask = (1U << length) - 1U;
-	reg &= ~(mask << start_bit);	 	 // 1. Alan ters maske ile temizle.
-	new_value &= mask;				     // 2. Yeni deeri, tamay nlemek iin maskele.
-	reg |= (new_value << start_bit);	 // 3. Yeni deeri kaydrarak alana yerletir (OR).
-	return reg;
+int bitops_detail::popcount64_dispatched(uint64_t x) {
+	return dispatch().popcount64(x);
 }
-uint16_t set_bit_field(uint16_t reg, int start_bit, int length, uint16_t new_value) {
-	uint16_t mask = (1U << length) - 1U;
-	reg &= ~(mask << start_bit);
-	new_value &= mask;
-	reg |= (new_value << start_bit);
-	return reg;
+
+const BitopsCpuFeatures& bitops_cpu_features() {
+	return dispatch().features;
 }
-uint32_t set_bit_field(uint32_t reg, int start_bit, int length, uint32_t new_value) {
-	uint32_t mask = (1U << length) - 1U;
-	reg &= ~(mask << start_bit);
-	new_value &= mask;
-	reg |= (new_value << start_bit);
-	return reg;
+
+const BitopsDispatchInfo& bitops_dispatch_info() {
+	return dispatch().info;
 }
-uint64_t set_bit_field(uint64_t reg, int start_bit, int length, uint64_t new_value) {
-	uint64_t mask = (1ULL << length) - 1ULL;
-	reg &= ~(mask << start_bit);
-	new_value &= mask;
-	reg |= (new_value << start_bit);
-	return reg;
+
+void print_bitops_dispatch(std::ostream& os) {
+	const BitopsDispatchInfo& info = dispatch().info;
+	os << "bitops dispatch: count_set_bits=" << info.count_set_bits
+	   << " find_first_set_bit=" << info.find_first_set_bit
+	   << " get_bit_field=" << info.get_bit_field
+	   << " set_bit_field=" << info.set_bit_field
+	   << " bulk_popcount=" << info.bulk_popcount
+	   << " bulk_parity=" << info.bulk_parity
+	   << " bulk_shift=" << info.bulk_shift << std::endl;
 }
 
 
@@ -146,91 +376,61 @@ uint64_t set_bit_field(uint64_t reg, int start_bit, int length, uint64_t new_val
 // IV. POZSYON VE AKI LEMLER (POSITION & FLOW OPERATIONS)
 // =========================================================================
 
-// RotateLeft (Sola Dndr) Implementasyonlar
-uint8_t RotateLeft(uint8_t reg, int shift) {
-	const int N = 8;
-	shift %= N;
-	// Dairesel kaydrma forml: (reg << shift) | (reg >> (N - shift))
-	return (reg << shift) | (reg >> (N - shift));
-}
-uint16_t RotateLeft(uint16_t reg, int shift) {
-	const int N = 16;
-	shift %= N;
-	return (reg << shift) | (reg >> (N - shift));
-}
-uint32_t RotateLeft(uint32_t reg, int shift) {
-	const int N = 32;
-	shift %= N;
-	return (reg << shift) | (reg >> (N - shift));
-}
-uint64_t RotateLeft(uint64_t reg, int shift) {
-	const int N = 64;
-	shift %= N;
-	return (reg << shift) | (reg >> (N - shift));
-}
-
-// RotateRight (Saa Dndr) Implementasyonlar
-uint8_t RotateRight(uint8_t reg, int shift) {
-	const int N = 8;
-	shift %= N;
-	// Dairesel kaydrma forml: (reg >> shift) | (reg << (N - shift))
-	return (reg >> shift) | (reg << (N - shift));
-}
-uint16_t RotateRight(uint16_t reg, int shift) {
-	const int N = 16;
-	shift %= N;
-	return (reg >> shift) | (reg << (N - shift));
-}
-uint32_t RotateRight(uint32_t reg, int shift) {
-	const int N = 32;
-	shift %= N;
-	return (reg >> shift) | (reg << (N - shift));	
-}
-uint64_t RotateRight(uint64_t reg, int shift) {
-	const int N = 64;
-	shift %= N;
-	return (reg >> shift) | (reg << (N - shift));
-}
-
-
-// find_first_set_bit (lk '1' Bitini Bul) Implementasyonlar (LSB'den balar)
-int find_first_set_bit(uint8_t reg) {
-	if (reg == 0) return -1;
-    // MHENDSLK NOTU: Modern C++'ta __builtin_ctz (count trailing zeros) veya
-    // std::countr_zero daha hzldr, ancak bu saf C++ mantdr.
-	int count = 0;
-	while (!(reg & 1U)) { // LSB 0 olduu srece
-		reg >>= 1;
-		count++;
-	}
-	return count;
-}
-int find_first_set_bit(uint16_t reg) {
-	if (reg == 0) return -1;
-	int count = 0;
-	while (!(reg & 1U)) {
-		reg >>= 1;
-		count++;
-	}
-	return count;
-}
-int find_first_set_bit(uint32_t reg) {
-	if (reg == 0) return -1;
-	int count = 0;
-	while (!(reg & 1U)) {
-		reg >>= 1;
-		count++;
+namespace {
+
+const size_t kShiftWordBits = 64;
+
+size_t shift_word_count(size_t nbits) {
+	return (nbits + kShiftWordBits - 1) / kShiftWordBits;
+}
+
+// Son kelimenin nbits tesindeki bitlerini sfrlar (sola kaydrmada taan bitler).
+void clear_shift_tail(uint64_t* dst, size_t nbits) {
+	const size_t tail = nbits % kShiftWordBits;
+	if (tail != 0) dst[nbits / kShiftWordBits] &= bitops_detail::low_mask<uint64_t>(static_cast<int>(tail));
+}
+
+} // namespace
+
+// Tampon (ok kelimeli) kaydrma ve dndrme: Dispatch edilmi funnel shift ekirdekleri.
+void ShiftLeft(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift) {
+	if (nbits == 0) return;
+	const size_t nwords = shift_word_count(nbits);
+	if (shift >= nbits) {
+		for (size_t i = 0; i < nwords; i++) dst[i] = 0;
+		return;
 	}
-	return count;
-}
-int find_first_set_bit(uint64_t reg) {
-	if (reg == 0) return -1;
-	int count = 0;
-	while (!(reg & 1ULL)) { // 64-bit iin 1ULL ile kontrol
-		reg >>= 1;
-		count++;
+	dispatch().shift_words_left(dst, src, nwords, shift / kShiftWordBits,
+	                            static_cast<unsigned>(shift % kShiftWordBits));
+	clear_shift_tail(dst, nbits);
+}
+
+void ShiftRight(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift) {
+	if (nbits == 0) return;
+	const size_t nwords = shift_word_count(nbits);
+	if (shift >= nbits) {
+		for (size_t i = 0; i < nwords; i++) dst[i] = 0;
+		return;
 	}
-	return count;
+	dispatch().shift_words_right(dst, src, nwords, nwords, shift / kShiftWordBits,
+	                             static_cast<unsigned>(shift % kShiftWordBits));
+}
+
+void RotateLeft(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift) {
+	if (nbits == 0) return;
+	shift %= nbits;
+	// (src << shift) | (src >> (nbits - shift)): kinci ksm yalnzca alt 'shift' biti doldurur
+	// ve sola kaydrmann sfr brakt ilk ceil(shift / 64) kelimeye OR'lanr.
+	ShiftLeft(dst, src, nbits, shift);
+	if (shift == 0) return;
+	const size_t back = nbits - shift;
+	dispatch().shift_words_right_merge(dst, src, shift_word_count(nbits), shift_word_count(shift),
+	                                   back / kShiftWordBits, static_cast<unsigned>(back % kShiftWordBits));
+}
+
+void RotateRight(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift) {
+	if (nbits == 0) return;
+	RotateLeft(dst, src, nbits, nbits - shift % nbits);
 }
 
 
@@ -238,82 +438,112 @@ int find_first_set_bit(uint64_t reg) {
 // V. KONTROL VE ANALZ LEMLER (CONTROL & ANALYSIS)
 // =========================================================================
 
-// count_set_bits (Popcount) Implementasyonlar (Klasik Kaydrma Yntemi)
-int count_set_bits(uint8_t reg) {
-    // MHENDSLK NOTU: Bu, O(N) karmaklna sahiptir. Brian Kernighan'n
-    // O(K) karmaklna sahip algoritmas veya __builtin_popcount daha hzldr.
-	int count = 0;
-	while (reg != 0) {
-		if (reg & 1U) count++;
-		reg >>= 1;
-	}
-	return count;
+// count_set_bits (Bulk Popcount) Tampon Implementasyonlar
+// Tm tampon varyantlar byte seviyesinde tek bir dispatch edilmi ekirdee indirgenir.
+uint64_t count_set_bits(const uint8_t* data, size_t n) {
+	return dispatch().popcount_bytes(data, n);
 }
-int count_set_bits(uint16_t reg) {
-	int count = 0;
-	while (reg != 0) {
-		if (reg & 1U) count++;
-		reg >>= 1;
-	}
-	return count;
+uint64_t count_set_bits(const uint16_t* data, size_t n) {
+	return dispatch().popcount_bytes(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint16_t));
 }
-int count_set_bits(uint32_t reg) {
-	int count = 0;
-	while (reg != 0) {
-		if (reg & 1U) count++;
-		reg >>= 1;
-	}
-	return count;
+uint64_t count_set_bits(const uint32_t* data, size_t n) {
+	return dispatch().popcount_bytes(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint32_t));
 }
-int count_set_bits(uint64_t reg) {
-	int count = 0;
-	while (reg != 0) {
-		if (reg & 1ULL) count++; // 64-bit iin 1ULL ile kontrol
-		reg >>= 1;
-	}
-	return count;
+uint64_t count_set_bits(const uint64_t* data, size_t n) {
+	return dispatch().popcount_bytes(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint64_t));
 }
 
-// getParity (Parity Kontrol) Implementasyonlar (count_set_bits'e dayanr)
-bool getParity(uint8_t reg) {
-	// Parity (Teklik/iftlik): Set edilen bit saysnn LSB'sini kontrol et. (Modl 2'ye edeer)
-	return count_set_bits(reg) & 1; 
+// getParityAdvanced: Tanabilir XOR katlamas. Her adm st yary alt yarya katlar;
+// kalan 4 bitin parity'si 0x6996 (= 0110 1001 1001 0110b) tablosunun ilgili bitidir.
+namespace {
+
+inline bool parity_fold4(uint32_t nibble_folded) {
+	return ((0x6996u >> (nibble_folded & 0xFu)) & 1u) != 0;
 }
-bool getParity(uint16_t reg) {
-	return count_set_bits(reg) & 1;
+
+} // namespace
+
+bool getParityAdvanced(uint8_t reg) {
+	uint32_t x = reg;
+	x ^= x >> 4;
+	return parity_fold4(x);
+}
+bool getParityAdvanced(uint16_t reg) {
+	uint32_t x = reg;
+	x ^= x >> 8;
+	x ^= x >> 4;
+	return parity_fold4(x);
+}
+bool getParityAdvanced(uint32_t reg) {
+	uint32_t x = reg;
+	x ^= x >> 16;
+	x ^= x >> 8;
+	x ^= x >> 4;
+	return parity_fold4(x);
+}
+bool getParityAdvanced(uint64_t reg) {
+	return getParityAdvanced(static_cast<uint32_t>(reg ^ (reg >> 32)));
 }
-bool getParity(uint32_t reg) {
-	return count_set_bits(reg) & 1;
+
+// getParity (Bulk Parity) Tampon Implementasyonlar: XOR katlama + tek kelime parity.
+bool getParity(const uint8_t* data, size_t n) {
+	return bitops_detail::parity64(dispatch().xor_fold_bytes(data, n));
 }
-bool getParity(uint64_t reg) {
-	return count_set_bits(reg) & 1;
+bool getParity(const uint16_t* data, size_t n) {
+	return getParity(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint16_t));
 }
-
-// is_power_of_two (2'nin Kuvveti Kontrol) Implementasyonlar
-bool is_power_of_two(uint8_t num) {
-	// Say > 0 VE sadece tek bir bit set edilmise.
-	return (num > 0) && ((num & (num - 1)) == 0);
+bool getParity(const uint32_t* data, size_t n) {
+	return getParity(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint32_t));
 }
-bool is_power_of_two(uint16_t num) {
-	return (num > 0) && ((num & (num - 1)) == 0);
+bool getParity(const uint64_t* data, size_t n) {
+	return getParity(reinterpret_cast<const uint8_t*>(data), n * sizeof(uint64_t));
 }
-bool is_power_of_two(uint32_t num) {
-	return (num > 0) && ((num & (num - 1)) == 0);
+
+// Paralel tampon varyantlar: Bloklar byte cinsinden kParallelGrainBytes'lk (64'n kat)
+// paralardr; her blok balangc tamponun bana gre nbellek satr hizasn korur.
+namespace {
+
+uint64_t popcount_bytes_parallel(ThreadPool& pool, const uint8_t* data, size_t n) {
+	std::atomic<uint64_t> total(0);
+	pool.parallel_for(0, n, kParallelGrainBytes, [&](size_t lo, size_t hi) {
+		total.fetch_add(dispatch().popcount_bytes(data + lo, hi - lo), std::memory_order_relaxed);
+	});
+	return total.load();
 }
-bool is_power_of_two(uint64_t num) {
-	return (num > 0) && ((num & (num - 1)) == 0);
+
+bool parity_bytes_parallel(ThreadPool& pool, const uint8_t* data, size_t n) {
+	// Blok boyutu 8'in kat olduundan her bloun katlanm kelimesi ayn byte eritlerini
+	// tar; XOR'lar seri katlamann sonucuna eittir.
+	std::atomic<uint64_t> folded(0);
+	pool.parallel_for(0, n, kParallelGrainBytes, [&](size_t lo, size_t hi) {
+		folded.fetch_xor(dispatch().xor_fold_bytes(data + lo, hi - lo), std::memory_order_relaxed);
+	});
+	return bitops_detail::parity64(folded.load());
 }
 
-// =========================================================================
-// EK NOT: getParityAdvanced gibi opsiyonel fonksiyonlarn implementasyonlar
-// istenirse buraya eklenebilir. rnein:
-//
-// bool getParityAdvanced(uint32_t num) {
-//     num ^= num >> 16;
-//     num ^= num >> 8;
-//     num ^= num >> 4;
-//     num ^= num >> 2;
-//     num ^= num >> 1;
-//     return num & 1;
-// }
-// =========================================================================
+} // namespace
+
+uint64_t count_set_bits(ThreadPool& pool, const uint8_t* data, size_t n) {
+	return popcount_bytes_parallel(pool, data, n);
+}
+uint64_t count_set_bits(ThreadPool& pool, const uint16_t* data, size_t n) {
+	return popcount_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint16_t));
+}
+uint64_t count_set_bits(ThreadPool& pool, const uint32_t* data, size_t n) {
+	return popcount_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint32_t));
+}
+uint64_t count_set_bits(ThreadPool& pool, const uint64_t* data, size_t n) {
+	return popcount_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint64_t));
+}
+bool getParity(ThreadPool& pool, const uint8_t* data, size_t n) {
+	return parity_bytes_parallel(pool, data, n);
+}
+bool getParity(ThreadPool& pool, const uint16_t* data, size_t n) {
+	return parity_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint16_t));
+}
+bool getParity(ThreadPool& pool, const uint32_t* data, size_t n) {
+	return parity_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint32_t));
+}
+bool getParity(ThreadPool& pool, const uint64_t* data, size_t n) {
+	return parity_bytes_parallel(pool, reinterpret_cast<const uint8_t*>(data), n * sizeof(uint64_t));
+}
@@ -1,16 +1,18 @@
 /**
  * @file bitops.h
- * @brief oklu Bit Genilikleri iin Kapsaml Bitwise lemleri Ktphanesi Deklarasyonlar.
+ * @brief oklu Bit Genilikleri iin Kapsaml Bitwise lemleri Ktphanesi (Header-Only ekirdek).
  *
- * Bu dosya, uint8_t'den uint64_t'ye kadar tm standart tam say tipleri iin
+ * Bu dosya, uint8_t'den uint64_t'ye kadar tm iaretsiz (unsigned) tam say tipleri iin
  * temel maniplasyon, alan ynetimi, ak kontrol ve analiz ilemlerini
- * gerekletiren fonksiyon ar yklemelerinin prototiplerini ierir.
- * ablon (Template) fonksiyonlarnn implementasyonlar da Linker sorununu zmek iin
- * bu dosyann sonundadr.
+ * gerekletiren constexpr ablon (template) fonksiyonlarn ierir.
+ * Tek kelimelik (single register) ilemlerin tamam bu dosyada tanmldr; bylece
+ * LTO olmadan da her ar satr iine alnr (inline) ve sabit giriler derleme
+ * zamannda hesaplanr (immediate). 'bitops.cpp' yalnzca tampon (bulk) ekirdeklerini
+ * ve alma zaman CPU dispatch katmann ierir.
  *
  * @author Doukan Avc
  * @date 15 Aralk 2025
- * @version 1.1.0 (Template/Overloading Birleimi)
+ * @version 1.2.0 (constexpr Header-Only ablon ekirdek)
  * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
  */
 
@@ -19,94 +21,255 @@
 
 #include <iostream>
 #include <cstdint> // uintX_t tipleri iin (std::uint32_t vb.)
+#include <cstddef> // size_t (tampon/buffer uzunluklar) iin
+#include <limits>  // std::numeric_limits<T>::digits (tipin bit genilii N) iin
+#include <type_traits> // std::enable_if / std::is_unsigned (ablon kstlar) iin
 // bool, true, false C++ dilinin yerleik anahtar kelimeleridir, stdbool.h gerekmez.
 
 // Makro: Tek bir biti set eden maskeyi hzlca oluturur.
 #define BIT(N) (1U << (N))
 
+// =========================================================================
+// 0. ABLON ALTYAPISI (TEMPLATE INFRASTRUCTURE)
+// =========================================================================
+
+// Tek kelimelik popcount, derleme birimi POPCNT ile derlenmediyse (-mpopcnt / -march)
+// alma zamannda 'bitops.cpp' iindeki dispatch tablosu zerinden yaplr.
+#if defined(__x86_64__) && defined(__GNUC__) && !defined(__POPCNT__)
+#define BITOPS_RUNTIME_POPCOUNT 1
+#else
+#define BITOPS_RUNTIME_POPCOUNT 0
+#endif
+
+namespace bitops_detail {
+
+/**
+ * @brief Register tipi kst: Sadece iaretsiz tam saylar (bool hari) kabul edilir.
+ *
+ * aretli tiplerde saa kaydrma (aritmetik shift) ve tama davran register
+ * semantiine uymad iin bu tipler derleme zamannda reddedilir.
+ */
+template<typename T>
+struct is_register_type
+    : std::integral_constant<bool, std::is_unsigned<T>::value && !std::is_same<T, bool>::value> {};
+
+/// ablonun yalnzca register tipleri iin ar ykleme kmesine girmesini salar (SFINAE).
+template<typename T, typename R = T>
+using EnableIfRegister = typename std::enable_if<is_register_type<T>::value, R>::type;
+
+/// Parametreyi tip karmnn (deduction) dnda tutar: set_bit_field(reg16, 4, 5, 0x1F) gibi
+/// arlarda tamsay literali T'ye dntrlr, akan karm hatas olumaz.
+template<typename T>
+struct identity { using type = T; };
+
+/// length uzunluunda, LSB'ye hizal '1' maskesi. length == N durumunda (T)1 << N tanmsz
+/// davran olacandan tm bitler '1' dndrlr.
+template<typename T>
+constexpr T low_mask(int length) {
+    return (length >= std::numeric_limits<T>::digits)
+        ? static_cast<T>(~static_cast<T>(0))
+        : static_cast<T>((static_cast<T>(1) << length) - static_cast<T>(1));
+}
+
+/// Tanabilir, dallanmasz 64-bit SWAR popcount (Hacker's Delight).
+constexpr int popcount64_swar(uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    return static_cast<int>((x * 0x0101010101010101ULL) >> 56);
+}
+
+/// Derleme zamannda da kullanlabilen popcount (GCC/Clang builtin'i constexpr'dir).
+constexpr int popcount64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    return popcount64_swar(x);
+#endif
+}
+
+/// Dallanmasz 64-bit parity: XOR katlama (folding) ile 4 bite indirip 0x6996 sabit
+/// tablosundan okur. GCC/Clang'da builtin, POPCNT varsa POPCNT + AND, yoksa x86 PF
+/// bayran kullanan (XOR + SETNP) koda iner.
+constexpr bool parity64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_parityll(x) != 0;
+#else
+    x ^= x >> 32;
+    x ^= x >> 16;
+    x ^= x >> 8;
+    x ^= x >> 4;
+    return ((0x6996u >> (x & 0xFu)) & 1u) != 0;
+#endif
+}
+
+/// De Bruijn dizisi ile sondaki sfr says tablosu (builtin olmayan derleyiciler iin).
+constexpr int kDeBruijnIndex64[64] = {
+     0,  1, 48,  2, 57, 49, 28,  3, 61, 58, 50, 42, 38, 29, 17,  4,
+    62, 55, 59, 36, 53, 51, 43, 22, 45, 39, 33, 30, 24, 18, 12,  5,
+    63, 47, 56, 27, 60, 41, 37, 16, 54, 35, 52, 21, 44, 32, 23, 11,
+    46, 26, 40, 15, 34, 20, 31, 10, 25, 14, 19,  9, 13,  8,  7,  6
+};
+
+/// Sondaki sfr says (x != 0 olmaldr). x86'da BSF/TZCNT, ARM'da RBIT+CLZ komutuna iner.
+constexpr int ctz64(uint64_t x) {
+#if defined(__GNUC__)
+    return __builtin_ctzll(x);
+#else
+    return kDeBruijnIndex64[((x & (~x + 1)) * 0x03F79D71B4CB0A89ULL) >> 58];
+#endif
+}
+
+/// Derleme zaman deerlendirmesinde mi olduumuzu bildirir (C++20 std::is_constant_evaluated edeeri).
+constexpr bool is_constant_evaluated() {
+#if defined(__GNUC__)
+    return __builtin_is_constant_evaluated();
+#else
+    return true;
+#endif
+}
+
+/**
+ * @brief alma zaman dispatch edilmi tek kelime popcount (POPCNT veya SWAR).
+ * Implementasyonu 'bitops.cpp' dosyasndadr.
+ */
+int popcount64_dispatched(uint64_t x);
+
+} // namespace bitops_detail
+
 // =========================================================================
 // I. TEMEL MANPLASYON LEMLER (SINGLE BIT OPERATIONS)
 // =========================================================================
 
 /**
- * @brief Belirtilen indeksteki biti '1' (Set) yapar. 
+ * MHENDSLK NOTU: Set/Clear/Toggle ilemlerinde, tip uyumluluu ve olas tamsay
+ * ykseltmeleri (Integer Promotion) nedeniyle `1` literalinin T tipine aka cast
+ * edilmesi (static_cast<T>(1)) KRTKTR. Aksi halde 64-bit register'da 31. bitin
+ * tesi int tamasna (UB) yol aar.
+ */
+
+/**
+ * @brief Belirtilen indeksteki biti '1' (Set) yapar.
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @param index Bitin konumu (0'dan (N-1)'e kadar).
  * @return Deitirilmi register deerini, giri tipiyle ayn tipte dndrr.
  */
-uint8_t SetRegBit(uint8_t reg, int index);
-uint16_t SetRegBit(uint16_t reg, int index);
-uint32_t SetRegBit(uint32_t reg, int index);
-uint64_t SetRegBit(uint64_t reg, int index);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> SetRegBit(T reg, int index) {
+    return static_cast<T>(reg | (static_cast<T>(1) << index));    // Maskeleme: OR |
+}
 
 /**
- * @brief Belirtilen indeksteki biti '0' (Clear) yapar. 
+ * @brief Belirtilen indeksteki biti '0' (Clear) yapar.
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @param index Bitin konumu (0'dan (N-1)'e kadar).
  * @return Deitirilmi register deerini, giri tipiyle ayn tipte dndrr.
  */
-uint8_t ClearRegBit(uint8_t reg, int index);
-uint16_t ClearRegBit(uint16_t reg, int index);
-uint32_t ClearRegBit(uint32_t reg, int index);
-uint64_t ClearRegBit(uint64_t reg, int index);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> ClearRegBit(T reg, int index) {
+    return static_cast<T>(reg & ~(static_cast<T>(1) << index));   // Maskeleme: AND & ~
+}
 
 /**
- * @brief Belirtilen indeksteki bitin deerini tersine evirir (Toggle). 
+ * @brief Belirtilen indeksteki bitin deerini tersine evirir (Toggle).
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @param index Bitin konumu (0'dan (N-1)'e kadar).
  * @return Deitirilmi register deerini, giri tipiyle ayn tipte dndrr.
  */
-uint8_t ToggleRegBit(uint8_t reg, int index);
-uint16_t ToggleRegBit(uint16_t reg, int index);
-uint32_t ToggleRegBit(uint32_t reg, int index);
-uint64_t ToggleRegBit(uint64_t reg, int index);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> ToggleRegBit(T reg, int index) {
+    return static_cast<T>(reg ^ (static_cast<T>(1) << index));    // Maskeleme: XOR ^
+}
 
 /**
  * @brief Belirtilen indeksteki bitin '1' olup olmadn kontrol eder.
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @param index Bitin konumu (0'dan (N-1)'e kadar).
  * @return Bit '1' ise true, deilse false dndrr.
  */
-bool isBitSet(uint8_t reg, int index);
-bool isBitSet(uint16_t reg, int index);
-bool isBitSet(uint32_t reg, int index);
-bool isBitSet(uint64_t reg, int index);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T, bool> isBitSet(T reg, int index) {
+    // Shift-and-check (Kaydr ve kontrol et) yntemi kullanlr.
+    return ((reg >> index) & static_cast<T>(1)) != 0;
+}
 
 
 // =========================================================================
-// II. BT ALANI LEMLER (BIT FIELD OPERATIONS)
+// II. YARDIMCI MASKE LEMLER (MASK HELPERS)
 // =========================================================================
 
 /**
- * @brief Belirtilen balang bitinden itibaren 'length' uzunluundaki bit alann okur. 
+ * @brief Belirtilen uzunlukta ve balang konumunda, hedef tipte bir maske oluturur (rn: 0b00011100).
+ * @tparam T Maskenin tipini belirler (uint8_t, uint32_t vb.).
+ * @param length Maskenin '1' olan bit uzunluu (N'ye kadar, N dahil).
+ * @param start_bit Maskenin balang indeksi (LSB'den).
+ * @return Oluturulmu maske deeri.
+ */
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> CreateMask(int length, int start_bit) {
+    // 1. length uzunluunda 1'lerden oluan alan (length == N iin tm bitler).
+    // 2. Alan balang konumuna kaydrlr.
+    return static_cast<T>(bitops_detail::low_mask<T>(length) << start_bit);
+}
+
+/**
+ * @brief Belirtilen alan '0' yapmak iin kullanlan ters maskeyi oluturur (rn: 0b11100011).
+ * @tparam T Maskenin tipini belirler.
+ * @param length '0' yaplacak alann uzunluu.
+ * @param start_bit '0' yaplacak alann balang indeksi.
+ * @return Oluturulmu ters maske deeri.
+ */
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> ReverseMask(int length, int start_bit) {
+    // Normal maske oluturulur ve tersi alnr (~), bylece hedef alan 0, dierleri 1 olur.
+    return static_cast<T>(~CreateMask<T>(length, start_bit));
+}
+
+
+// =========================================================================
+// III. BT ALANI LEMLER (BIT FIELD OPERATIONS)
+// =========================================================================
+
+/**
+ * @brief Belirtilen balang bitinden itibaren 'length' uzunluundaki bit alann okur.
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg Okunacak register deeri.
  * @param start_bit Balang indeksi (0-tabanl).
  * @param length Bit alannn uzunluu.
  * @return Okunan bit alannn deerini dndrr (Saa hizalanm). Dn tipi, giri tipiyle ayndr.
  */
-uint8_t get_bit_field(uint8_t reg, int start_bit, int length);
-uint16_t get_bit_field(uint16_t reg, int start_bit, int length);
-uint32_t get_bit_field(uint32_t reg, int start_bit, int length);
-uint64_t get_bit_field(uint64_t reg, int start_bit, int length);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> get_bit_field(T reg, int start_bit, int length) {
+    // Okuma: nce kaydr, sonra maskele. -mbmi2 hedefinde SHRX + BZHI komutlarna iner.
+    return static_cast<T>((reg >> start_bit) & bitops_detail::low_mask<T>(length));
+}
 
 /**
- * @brief Belirtilen bit alanna yeni bir deer yazar (nce temizleme, sonra yazma). 
+ * @brief Belirtilen bit alanna yeni bir deer yazar (nce temizleme, sonra yazma).
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @param start_bit Balang indeksi (0-tabanl).
  * @param length Bit alannn uzunluu.
- * @param new_value Alana yazlacak yeni deer. New_value, reg ile ayn tipte olmaldr.
+ * @param new_value Alana yazlacak yeni deer. reg ile ayn tipe dntrlr.
  * @return Deitirilmi register deerini dndrr. Dn tipi, giri tipiyle ayndr.
  */
-uint8_t set_bit_field(uint8_t reg, int start_bit, int length, uint8_t new_value);
-uint16_t set_bit_field(uint16_t reg, int start_bit, int length, uint16_t new_value);
-uint32_t set_bit_field(uint32_t reg, int start_bit, int length, uint32_t new_value);
-uint64_t set_bit_field(uint64_t reg, int start_bit, int length, uint64_t new_value);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> set_bit_field(T reg, int start_bit, int length,
+                                                          typename bitops_detail::identity<T>::type new_value) {
+    const T mask = CreateMask<T>(length, start_bit);
+    reg = static_cast<T>(reg & ~mask);                               // 1. Alan ters maske ile temizle.
+    return static_cast<T>(reg | ((new_value << start_bit) & mask));  // 2. Yeni deeri maskeleyip yerletir (OR).
+}
 
 
 // =========================================================================
@@ -114,39 +277,99 @@ uint64_t set_bit_field(uint64_t reg, int start_bit, int length, uint64_t new_val
 // =========================================================================
 
 /**
- * @brief Bitleri sola dairesel olarak kaydrr (Rotate Left). 
+ * MHENDSLK NOTU (Tanmsz davransz dndrme): shift % N == 0 iken (reg >> (N - 0))
+ * tipin genilii kadar kaydrmadr ve C++'ta tanmsz davrantr (UB); negatif shift'te
+ * ise % ileci negatif sonu verir. N 2'nin kuvveti olduundan miktar iaretsiz olarak
+ * (N - 1) ile maskelenir: Negatif miktar ters ynde dndrme olur (RotateLeft(x, -1) ==
+ * RotateRight(x, 1)) ve ters kaydrma da ((N - s) & (N - 1)) ile maskelendii iin s == 0'da
+ * 0'a iner. GCC/Clang bu kalb tek ROL/ROR komutuna derler.
+ */
+
+/**
+ * @brief Bitleri sola dairesel olarak kaydrr (Rotate Left).
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
- * @param shift Kaydrma miktar.
+ * @param shift Kaydrma miktar (herhangi bir deer; negatifse saa dndrr).
  * @return Dndrlm register deerini, giri tipiyle ayn tipte dndrr.
  */
-uint8_t RotateLeft(uint8_t reg, int shift);
-uint16_t RotateLeft(uint16_t reg, int shift);
-uint32_t RotateLeft(uint32_t reg, int shift);
-uint64_t RotateLeft(uint64_t reg, int shift);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> RotateLeft(T reg, int shift) {
+    const unsigned N = std::numeric_limits<T>::digits;
+    const unsigned s = static_cast<unsigned>(shift) & (N - 1);
+    // Dairesel kaydrma forml: (reg << s) | (reg >> (N - s)), s == 0'da ikinci kaydrma 0.
+    return static_cast<T>((reg << s) | (reg >> ((N - s) & (N - 1))));
+}
 
 /**
- * @brief Bitleri saa dairesel olarak kaydrr (Rotate Right). 
+ * @brief Bitleri saa dairesel olarak kaydrr (Rotate Right).
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
- * @param shift Kaydrma miktar.
+ * @param shift Kaydrma miktar (herhangi bir deer; negatifse sola dndrr).
  * @return Dndrlm register deerini, giri tipiyle ayn tipte dndrr.
  */
-uint8_t RotateRight(uint8_t reg, int shift);
-uint16_t RotateRight(uint16_t reg, int shift);
-uint32_t RotateRight(uint32_t reg, int shift);
-uint64_t RotateRight(uint64_t reg, int shift);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T> RotateRight(T reg, int shift) {
+    const unsigned N = std::numeric_limits<T>::digits;
+    const unsigned s = static_cast<unsigned>(shift) & (N - 1);
+    // Dairesel kaydrma forml: (reg >> s) | (reg << (N - s)), s == 0'da ikinci kaydrma 0.
+    return static_cast<T>((reg >> s) | (reg << ((N - s) & (N - 1))));
+}
 
 /**
  * @brief En sadan (LSB) balayarak ilk '1' bitinin konumunu (indeksini) bulur.
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @return lk '1' bitinin indeksini (0'dan (N-1)'e) veya reg 0 ise -1 dndrr.
  */
-int find_first_set_bit(uint8_t reg);
-int find_first_set_bit(uint16_t reg);
-int find_first_set_bit(uint32_t reg);
-int find_first_set_bit(uint64_t reg);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T, int> find_first_set_bit(T reg) {
+    return (reg == 0) ? -1 : bitops_detail::ctz64(reg);
+}
+
+/**
+ * MHENDSLK NOTU (ok kelimeli kaydrma): Aadaki tampon ilemleri nbits bitlik bir
+ * tamponu tek bir byk say gibi kaydrr/dndrr. Bit i, (i / 64). kelimenin (i % 64).
+ * bitidir (DynamicBitset dzeni). Kaydrma miktar kelime (q = shift / 64) ve bit
+ * (r = shift % 64) ksmna ayrlr. Her kt kelimesi iki komu girdi kelimesinden tek bir
+ * funnel shift ile retilir: (hi << r) | (lo >> (64 - r)). x86'da bu SHLD/SHRD komutuna,
+ * AVX2 ekirdeinde 4 kelimelik VPSLLQ/VPSRLQ iftine iner. r == 0 durumu (64 - r == 64
+ * kaydrmas UB olurdu) kelime kopyasna ayrlr. Bylece her kaydrma miktar (0, 64'n
+ * katlar, >= nbits) tanmldr.
+ *
+ * n koul: src'nin son kelimesindeki nbits tesi bitler '0' olmaldr (DynamicBitset
+ * deimezi). ktda bu bitler '0' yazlr.
+ */
+
+/**
+ * @brief Tamponu sola kaydrr: Bit i, bit i + shift olur; alttan '0' girer, nbits'i aan bitler der.
+ * @param dst kt (ceil(nbits / 64) kelime). src ile ayn olabilir (yerinde); ksmen akamaz.
+ * @param src Girdi.
+ * @param nbits Tamponun bit uzunluu.
+ * @param shift Kaydrma miktar; shift >= nbits sonucu sfrlar.
+ */
+void ShiftLeft(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift);
+
+/**
+ * @brief Tamponu saa kaydrr: Bit i + shift, bit i olur; stten '0' girer.
+ * Parametreler ShiftLeft ile ayndr.
+ */
+void ShiftRight(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift);
+
+/**
+ * @brief Tamponu nbits bit iinde sola dndrr: Bit i, bit (i + shift) % nbits olur.
+ * @param dst kt (ceil(nbits / 64) kelime); src ile akmamaldr. Yerinde dndrme iin
+ *        DynamicBitset::rotate_left kullanlabilir.
+ * @param src Girdi.
+ * @param nbits Tamponun bit uzunluu.
+ * @param shift Dndrme miktar (herhangi bir deer, nbits modunda).
+ */
+void RotateLeft(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift);
+
+/// Tamponu nbits bit iinde saa dndrr: Bit (i + shift) % nbits, bit i olur.
+void RotateRight(uint64_t* dst, const uint64_t* src, size_t nbits, size_t shift);
 
 
 // =========================================================================
@@ -156,27 +379,60 @@ int find_first_set_bit(uint64_t reg);
 /**
  * @brief Saydaki set edilmi ('1') bitlerin saysn bulur (Popcount).
  *
+ * Sabit girilerde derleme zamannda hesaplanr. alma zamannda, derleme birimi
+ * POPCNT ile derlendiyse tek komuta, aksi halde dispatch edilmi ekirdee iner.
+ *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @return Set edilmi bit saysn dndrr. Dn tipi int'tir.
  */
-int count_set_bits(uint8_t reg);
-int count_set_bits(uint16_t reg);
-int count_set_bits(uint32_t reg);
-int count_set_bits(uint64_t reg);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T, int> count_set_bits(T reg) {
+#if BITOPS_RUNTIME_POPCOUNT
+    if (!bitops_detail::is_constant_evaluated()) {
+        return bitops_detail::popcount64_dispatched(reg);
+    }
+#endif
+    return bitops_detail::popcount64(reg);
+}
 
 /**
- * @brief Saynn tek/ift parity durumunu kontrol eder (count_set_bits'e dayanr).
+ * @brief Bir tampondaki (buffer) toplam set edilmi ('1') bit saysn bulur (Bulk Popcount).
+ *
+ * lemci destekliyorsa AVX-512 VPOPCNTDQ veya AVX2 Harley-Seal ekirdei, aksi halde
+ * tanabilir 64-bit SWAR ekirdei kullanlr. Seim ilk arda bir kez yaplr.
+ * Tamponun hizal (aligned) olmas gerekmez.
  *
+ * @param data Tamponun balang adresi.
+ * @param n Tampondaki eleman says (byte deil, eleman).
+ * @return Tampondaki toplam set edilmi bit says.
+ */
+uint64_t count_set_bits(const uint8_t* data, size_t n);
+uint64_t count_set_bits(const uint16_t* data, size_t n);
+uint64_t count_set_bits(const uint32_t* data, size_t n);
+uint64_t count_set_bits(const uint64_t* data, size_t n);
+
+/**
+ * @brief Saynn tek/ift parity durumunu kontrol eder.
+ *
+ * Tam popcount hesaplanmaz: Dallanmasz XOR katlamas (veya derleyici builtin'i) kullanlr.
+ * Sabit girilerde derleme zamannda hesaplanr.
+ *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param reg lem yaplacak register deeri.
  * @return Parity Tek ise true (1), ift ise false (0) dndrr.
  */
-bool getParity(uint8_t reg);
-bool getParity(uint16_t reg);
-bool getParity(uint32_t reg);
-bool getParity(uint64_t reg);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T, bool> getParity(T reg) {
+    // Parity (Teklik/iftlik): Tm bitlerin XOR'u; set edilen bit saysnn LSB'sine edeer.
+    return bitops_detail::parity64(reg);
+}
 
 /**
- * @brief Saynn parity durumunu gelimi bitwise teknikleri kullanarak kontrol eder (Daha hzl XOR yntemi). 
+ * @brief Saynn parity durumunu gelimi bitwise teknikleri kullanarak kontrol eder (Daha hzl XOR yntemi).
+ *
+ * Tanabilir XOR katlamas: Kelime log2(N) admda 4 bite indirilir ve 16 girilik
+ * sabit tablo (0x6996) ile zlr. Builtin veya POPCNT gerektirmez (ARM MCU vb.).
  *
  * @param reg lem yaplacak register deeri.
  * @return Parity Tek ise true (1), ift ise false (0) dndrr.
@@ -186,51 +442,115 @@ bool getParityAdvanced(uint16_t reg);
 bool getParityAdvanced(uint32_t reg);
 bool getParityAdvanced(uint64_t reg);
 
+/**
+ * @brief Bir tampondaki tm bitlerin parity'sini hesaplar (Bulk Parity).
+ *
+ * Tampon nce tek bir 64-bit kelimeye XOR ile katlanr (AVX2 ekirdeiyle 32 byte/komut),
+ * ardndan kelimenin parity'si alnr. Tamponun hizal olmas gerekmez.
+ *
+ * @param data Tamponun balang adresi.
+ * @param n Tampondaki eleman says (byte deil, eleman).
+ * @return Toplam set edilmi bit says tek ise true.
+ */
+bool getParity(const uint8_t* data, size_t n);
+bool getParity(const uint16_t* data, size_t n);
+bool getParity(const uint32_t* data, size_t n);
+bool getParity(const uint64_t* data, size_t n);
+
+class ThreadPool;   // thread_pool.h
+
+/**
+ * @brief Bulk popcount ve parity'nin paralel srmleri.
+ *
+ * Tampon kParallelGrainBytes'lk bloklara blnr; her blok ayn dispatch edilmi ekirdekle
+ * ilenir ve ksmi sonular toplanr (popcount) veya XOR'lanr (parity). ki birletirme de
+ * sradan bamsz olduundan sonu, seri srmle ve i parac saysndan bamsz
+ * olarak ayndr.
+ *
+ * @param pool  parac havuzu.
+ * @param data Tamponun balang adresi.
+ * @param n Tampondaki eleman says (byte deil, eleman).
+ */
+uint64_t count_set_bits(ThreadPool& pool, const uint8_t* data, size_t n);
+uint64_t count_set_bits(ThreadPool& pool, const uint16_t* data, size_t n);
+uint64_t count_set_bits(ThreadPool& pool, const uint32_t* data, size_t n);
+uint64_t count_set_bits(ThreadPool& pool, const uint64_t* data, size_t n);
+bool getParity(ThreadPool& pool, const uint8_t* data, size_t n);
+bool getParity(ThreadPool& pool, const uint16_t* data, size_t n);
+bool getParity(ThreadPool& pool, const uint32_t* data, size_t n);
+bool getParity(ThreadPool& pool, const uint64_t* data, size_t n);
+
 /**
  * @brief Saynn 2'nin tam kuvveti olup olmadn kontrol eder (N & (N-1) == 0 hilesi).
  *
+ * @tparam T Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
  * @param num Kontrol edilecek say.
  * @return Say 2'nin kuvveti ise true, deilse false dndrr.
  */
-bool is_power_of_two(uint8_t num);
-bool is_power_of_two(uint16_t num);
-bool is_power_of_two(uint32_t num);
-bool is_power_of_two(uint64_t num);
+template<typename T>
+constexpr bitops_detail::EnableIfRegister<T, bool> is_power_of_two(T num) {
+    // Say > 0 VE sadece tek bir bit set edilmise.
+    return (num > 0) && ((num & (num - 1)) == 0);
+}
 
 
 // =========================================================================
-// III. YARDIMCI MASKE LEMLER (TEMPLATE IMPLEMENTATION)
-// KRTK NOT: Linker hatasn nlemek iin ablon implementasyonlar buradadr.
+// VI. ALIMA ZAMANI CPU ZELLK SEM (RUNTIME DISPATCH)
 // =========================================================================
 
 /**
- * @brief Belirtilen uzunlukta ve balang konumunda, hedef tipte bir maske oluturur (rn: 0b00011100).
- * @tparam T Maskenin tipini belirler (uint8_t, uint32_t vb.).
- * @param length Maskenin '1' olan bit uzunluu.
- * @param start_bit Maskenin balang indeksi (LSB'den).
- * @return Oluturulmu maske deeri.
+ * @brief Program balangcnda CPUID ile bir kez tespit edilen ilemci zellikleri.
+ *
+ * x86 d hedeflerde tm alanlar false'tur ve tanabilir skaler yollar kullanlr.
  */
-template<typename T>
-T CreateMask(int length, int start_bit) {
-    // 1. (T)1 << length: length uzunluunda 1'lerden oluan bir alan oluturmak iin.
-    // 2. - (T)1: Tm '1'ler alann elde etmek iin.
-    T mask = ( (T)1 << length) - (T)1;
-    return mask << start_bit;
-}
+struct BitopsCpuFeatures {
+    bool popcnt;            ///< POPCNT komutu.
+    bool bmi1;              ///< BMI1 (TZCNT, BEXTR).
+    bool bmi2;              ///< BMI2 (BZHI, PDEP, PEXT).
+    bool bmi2_fast;         ///< PDEP/PEXT mikrokodlu deil (AMD Zen1/Zen2 ve ncesi hari).
+    bool lzcnt;             ///< LZCNT komutu (ABM).
+    bool sse4_1;            ///< SSE4.1 (sabit noktal DSP ekirdekleri).
+    bool sse4_2;            ///< SSE4.2 (donanm CRC32C komutu).
+    bool avx2;              ///< AVX2 (Harley-Seal bulk popcount).
+    bool avx512_vpopcntdq;  ///< AVX-512 VPOPCNTDQ (bulk popcount).
+    bool avx512bw;          ///< AVX-512 F + BW (8..64-bit karlatrmadan maskeye).
+    bool avx512_vbmi2;      ///< AVX-512 VBMI2 (8/16-bit VPCOMPRESS).
+};
 
 /**
- * @brief Belirtilen alan '0' yapmak iin kullanlan ters maskeyi oluturur (rn: 0b11100011).
- * @tparam T Maskenin tipini belirler.
- * @param length '0' yaplacak alann uzunluu.
- * @param start_bit '0' yaplacak alann balang indeksi.
- * @return Oluturulmu ters maske deeri.
+ * @brief Scak yollarn (hot path) hangi implementasyona balandn gsterir.
+ *
+ * Her alan okunabilir bir implementasyon addr (rn: "popcnt", "avx2-harley-seal").
+ * "inline-" nekli deerler, ilemin header'da satr iine alndn ve komut
+ * seiminin derleme bayraklarna (-march) brakldn belirtir.
+ * Operasyon ekipleri hzl yolun ilgili makinede aktif olduunu bununla dorulayabilir.
  */
-template<typename T>
-T ReverseMask(int length, int start_bit) {
-    // 1. nce normal maske oluturulur.
-    T mask = ( (T)1 << length) - (T)1;
-    // 2. Konumlandrlr ve tersi alnr (~), bylece hedef alan 0, dierleri 1 olur.
-    return ~(mask << start_bit);
-}
+struct BitopsDispatchInfo {
+    const char* count_set_bits;     ///< Tek kelime popcount.
+    const char* find_first_set_bit; ///< Sondaki sfrlar sayma (trailing zero count).
+    const char* get_bit_field;      ///< Bit alan okuma.
+    const char* set_bit_field;      ///< Bit alan yazma.
+    const char* bulk_popcount;      ///< Tampon (buffer) popcount ekirdei.
+    const char* bulk_parity;        ///< Tampon (buffer) parity (XOR katlama) ekirdei.
+    const char* bulk_shift;         ///< Tampon (buffer) kaydrma/dndrme (funnel shift) ekirdei.
+};
+
+/**
+ * @brief Tespit edilen CPU zelliklerini dndrr.
+ * @return Program balangcnda bir kez doldurulan zellik yaps.
+ */
+const BitopsCpuFeatures& bitops_cpu_features();
+
+/**
+ * @brief Her scak yol iin seilen implementasyonun adn dndrr.
+ * @return Program balangcnda bir kez doldurulan dispatch bilgisi.
+ */
+const BitopsDispatchInfo& bitops_dispatch_info();
+
+/**
+ * @brief Dispatch bilgisini tek satrlk metin olarak yazdrr (log/tehis amal).
+ * @param os kt ak (rn: std::cout).
+ */
+void print_bitops_dispatch(std::ostream& os);
 
 #endif // BITOPS_H
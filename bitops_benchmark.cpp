@@ -0,0 +1,558 @@
+/**
+ * @file bitops_benchmark.cpp
+ * @brief bitops.h Regresyon Benchmark Paketi: Her lem x Her Genilik x Rastgele/Kt Durum Girdi.
+ *
+ * benchmark.cpp bileenleri alternatiflerle karlatrr; bu dosya ise bitops.h'deki her
+ * tek kelimelik ilemi drt genilikte (uint8/16/32/64) ve her tampon ekirdeini 
+ * nbellek seviyesinde ler. Ama, bir implementasyon deiikliini yayna almadan
+ * nce eski ve yeni srm ayn makinede satr satr karlatrabilmektir.
+ *
+ * Her ilem iki girdi kmesiyle alr: Tekdze rastgele girdi ve ileme zg kt durum
+ * (adversarial) girdisi (rn. find_first_set_bit iin yalnzca en st biti set deerler:
+ * kaydrmal dng implementasyonunun en kt durumu; is_power_of_two iin ngrlemez
+ * %50 karm: dal tahmini skalamas).
+ *
+ * Rapor stunlar: ns/ilem, M ilem/s, GB/s (girdi byte') ve Linux'ta perf_event_open
+ * eriimi varsa ilem bana evrim (cycle) ve komut (instruction) says. Sayalar
+ * yalnzca kullanc modunu sayar (kernel.perf_event_paranoid <= 2 yeterlidir); eriim
+ * yoksa bu stunlar "-" baslr.
+ *
+ *   g++ -std=c++17 -O3 -pthread bitops_benchmark.cpp bitops.cpp thread_pool.cpp -o bitops_bench
+ *   ./bitops_bench                 # Tm lmler
+ *   ./bitops_bench find_first      # Yalnzca ad filtreyi ieren lmler
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <string>
+#include <vector>
+#include "bitops.h"
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#define BITOPS_BENCH_PERF 1
+#else
+#define BITOPS_BENCH_PERF 0
+#endif
+
+// =========================================================================
+// I. DONANIM SAYALARI (perf_event_open)
+// =========================================================================
+
+/**
+ * @brief evrim ve komut sayalarn tek bir grup olarak aar (Linux).
+ *
+ * ki saya ayn grupta olduundan birlikte zamanlanr (multiplexing) ve tek read() ile
+ * tutarl bir ift olarak okunur. Alamazsa (konteyner, paranoid ayar, sanal makine)
+ * available() false dner ve lmler yalnzca duvar saatiyle yaplr.
+ */
+class PerfCounters {
+public:
+    PerfCounters() : leader_(-1), instructions_(-1) {
+#if BITOPS_BENCH_PERF
+        leader_ = open_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (leader_ >= 0) instructions_ = open_counter(PERF_COUNT_HW_INSTRUCTIONS, leader_);
+        if (instructions_ < 0 && leader_ >= 0) {
+            close(leader_);
+            leader_ = -1;
+        }
+#endif
+    }
+
+    ~PerfCounters() {
+#if BITOPS_BENCH_PERF
+        if (instructions_ >= 0) close(instructions_);
+        if (leader_ >= 0) close(leader_);
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const { return leader_ >= 0; }
+
+    void start() {
+#if BITOPS_BENCH_PERF
+        if (!available()) return;
+        ioctl(leader_, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    /// Sayalar durdurur ve start()'tan bu yana geen evrim/komut saysn yazar.
+    void stop(uint64_t& cycles, uint64_t& instructions) {
+        cycles = 0;
+        instructions = 0;
+#if BITOPS_BENCH_PERF
+        if (!available()) return;
+        ioctl(leader_, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t values[3] = { 0, 0, 0 };   // PERF_FORMAT_GROUP: { nr, cycles, instructions }
+        if (read(leader_, values, sizeof(values)) == static_cast<ssize_t>(sizeof(values))) {
+            cycles = values[1];
+            instructions = values[2];
+        }
+#endif
+    }
+
+private:
+#if BITOPS_BENCH_PERF
+    static int open_counter(uint64_t config, int group_fd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = (group_fd == -1) ? 1 : 0;   // Grup, lider zerinden alp kapatlr.
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+    }
+#endif
+
+    int leader_;
+    int instructions_;
+};
+
+
+// =========================================================================
+// II. LM EREVES (HARNESS)
+// =========================================================================
+
+using BenchClock = std::chrono::steady_clock;
+
+/**
+ * @brief Deeri bir yazmata "gzlemlenmi" sayar: Derleyici sonucu eleyemez, dngy
+ * vektrletiremez veya iterasyonlar arasnda ortak alt ifade karamaz. Komut retmez.
+ */
+inline uint64_t bench_keep(uint64_t value) {
+#if defined(__GNUC__)
+    asm volatile("" : "+r"(value));
+#endif
+    return value;
+}
+
+/**
+ * @brief Kalibre edilmi tekrar, en iyi rnek seimi ve tablo kts.
+ *
+ * Her lm nce tek geiin sresini ~20 ms'ye ulaana kadar ikiye katlanan tekrar
+ * saysyla kalibre edilir; ardndan 5 rnek alnr ve en hzl rnek raporlanr
+ * (kesintiler ve frekans geileri sreyi yalnzca uzatabilir).
+ */
+class BenchHarness {
+public:
+    explicit BenchHarness(const char* filter) : filter_(filter ? filter : ""), checksum_(0) {}
+
+    void print_header() const {
+        std::cout << "perf_event_open sayalar: " << (perf_.available() ? "ak" : "yok (yalnzca sre)")
+                  << std::endl;
+        std::cout << std::left << std::setw(48) << "lm" << std::right
+                  << std::setw(10) << "ns/ilem" << std::setw(12) << "M ilem/s" << std::setw(10) << "GB/s"
+                  << std::setw(10) << "evrim" << std::setw(10) << "komut" << std::setw(7) << "IPC" << std::endl;
+    }
+
+    /**
+     * @brief Tek bir lm satr.
+     * @param name Satr ad (filtre bununla eletirilir).
+     * @param ops Bir geiteki ilem says.
+     * @param bytes Bir geiin okuduu girdi byte'.
+     * @param pass Bir geii altrp checksum dndren fonksiyon.
+     */
+    template<typename PassFn>
+    void run(const std::string& name, uint64_t ops, uint64_t bytes, PassFn pass) {
+        if (name.find(filter_) == std::string::npos) return;
+
+        uint64_t repeats = 1;
+        for (;;) {
+            const double seconds = time_pass(pass, repeats, nullptr, nullptr);
+            if (seconds >= kTargetSeconds || repeats >= (uint64_t(1) << 30)) break;
+            repeats *= 2;
+        }
+
+        double best = std::numeric_limits<double>::max();
+        uint64_t best_cycles = 0, best_instructions = 0;
+        for (int s = 0; s < kSamples; s++) {
+            uint64_t cycles = 0, instructions = 0;
+            const double seconds = time_pass(pass, repeats, &cycles, &instructions);
+            if (seconds < best) {
+                best = seconds;
+                best_cycles = cycles;
+                best_instructions = instructions;
+            }
+        }
+
+        const double total_ops = static_cast<double>(ops) * repeats;
+        std::cout << std::left << std::setw(48) << name << std::right << std::fixed
+                  << std::setw(10) << std::setprecision(3) << (best * 1e9 / total_ops)
+                  << std::setw(12) << std::setprecision(1) << (total_ops / best / 1e6)
+                  << std::setw(10) << std::setprecision(2) << (static_cast<double>(bytes) * repeats / best / 1e9);
+        if (perf_.available() && best_cycles != 0) {
+            std::cout << std::setw(10) << std::setprecision(2) << (best_cycles / total_ops)
+                      << std::setw(10) << std::setprecision(2) << (best_instructions / total_ops)
+                      << std::setw(7) << std::setprecision(2)
+                      << (static_cast<double>(best_instructions) / best_cycles);
+        } else {
+            std::cout << std::setw(10) << "-" << std::setw(10) << "-" << std::setw(7) << "-";
+        }
+        std::cout << std::endl;
+    }
+
+    /// Tm lmlerin checksum': llen iin elenmediinin son kant.
+    uint64_t checksum() const { return checksum_; }
+
+private:
+    static constexpr double kTargetSeconds = 0.02;
+    static constexpr int kSamples = 5;
+
+    template<typename PassFn>
+    double time_pass(PassFn& pass, uint64_t repeats, uint64_t* cycles, uint64_t* instructions) {
+        uint64_t sum = 0;
+        uint64_t c = 0, i = 0;
+        perf_.start();
+        auto start = BenchClock::now();
+        for (uint64_t r = 0; r < repeats; r++) sum += pass();
+        std::chrono::duration<double> elapsed = BenchClock::now() - start;
+        perf_.stop(c, i);
+        if (cycles) *cycles = c;
+        if (instructions) *instructions = i;
+        checksum_ += sum;
+        return elapsed.count();
+    }
+
+    std::string filter_;
+    uint64_t checksum_;
+    PerfCounters perf_;
+};
+
+
+// =========================================================================
+// III. GRD KMELER
+// =========================================================================
+
+/// Tekrarlanabilir szde rastgele kaynak (xorshift64*).
+class BenchRng {
+public:
+    explicit BenchRng(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        state_ ^= state_ >> 12;
+        state_ ^= state_ << 25;
+        state_ ^= state_ >> 27;
+        return state_ * 0x2545F4914F6CDD1DULL;
+    }
+
+    /// [0, bound) aralnda deer.
+    int below(int bound) { return static_cast<int>(next() % static_cast<uint64_t>(bound)); }
+
+private:
+    uint64_t state_;
+};
+
+/**
+ * @brief Tek kelimelik ilem girdisi: Deerler ve iki tam say parametre dizisi
+ * (indeks / kaydrma / alan balangc ve uzunluu, ileme gre).
+ */
+template<typename T>
+struct RegisterWorkload {
+    const char* input;          ///< Girdi kmesinin ad ("rastgele", "st-bit" vb.).
+    std::vector<T> values;
+    std::vector<uint8_t> a;
+    std::vector<uint8_t> b;
+};
+
+/// Bir geiteki ilem says: En geni tipte girdi dizileri L1 nbelleine sar.
+const size_t kRegisterOps = 2048;
+
+template<typename T>
+RegisterWorkload<T> make_workload(const char* input, uint64_t seed) {
+    RegisterWorkload<T> w = { input, std::vector<T>(kRegisterOps), std::vector<uint8_t>(kRegisterOps),
+                              std::vector<uint8_t>(kRegisterOps) };
+    BenchRng rng(seed);
+    for (size_t i = 0; i < kRegisterOps; i++) w.values[i] = static_cast<T>(rng.next());
+    return w;
+}
+
+/// a = bit indeksi [0, N), b kullanlmaz.
+template<typename T>
+RegisterWorkload<T> workload_random_index(const char* input, uint64_t seed) {
+    const int N = std::numeric_limits<T>::digits;
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    BenchRng rng(seed ^ 0x5A5A);
+    for (size_t i = 0; i < kRegisterOps; i++) w.a[i] = static_cast<uint8_t>(rng.below(N));
+    return w;
+}
+
+/// a = alan balangc, b = alan uzunluu (1 <= b, a + b <= N).
+template<typename T>
+RegisterWorkload<T> workload_random_field(const char* input, uint64_t seed) {
+    const int N = std::numeric_limits<T>::digits;
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    BenchRng rng(seed ^ 0xA5A5);
+    for (size_t i = 0; i < kRegisterOps; i++) {
+        const int length = 1 + rng.below(N);
+        w.b[i] = static_cast<uint8_t>(length);
+        w.a[i] = static_cast<uint8_t>(rng.below(N - length + 1));
+    }
+    return w;
+}
+
+/// Tam genilik alan (balang 0, uzunluk N): low_mask'in length == N zel durumu.
+template<typename T>
+RegisterWorkload<T> workload_full_field(const char* input, uint64_t seed) {
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    std::fill(w.b.begin(), w.b.end(), static_cast<uint8_t>(std::numeric_limits<T>::digits));
+    return w;
+}
+
+/**
+ * @brief a = kaydrma miktar; 'wide' ise [0, 4N) aralnda (modulo yolu), deilse [0, N).
+ * 0 ve N'nin katlar (etkin miktar 0 olan dnler) da dalma dahildir.
+ */
+template<typename T>
+RegisterWorkload<T> workload_rotate(const char* input, uint64_t seed, bool wide) {
+    const int N = std::numeric_limits<T>::digits;
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    BenchRng rng(seed ^ 0x3C3C);
+    for (size_t i = 0; i < kRegisterOps; i++) w.a[i] = static_cast<uint8_t>(rng.below(wide ? 4 * N : N));
+    return w;
+}
+
+/// Yalnzca en st bit set: find_first_set_bit'in kaydrmal dngdeki en kt durumu.
+template<typename T>
+RegisterWorkload<T> workload_high_bit(const char* input, uint64_t seed) {
+    RegisterWorkload<T> w = workload_random_index<T>(input, seed);
+    std::fill(w.values.begin(), w.values.end(),
+              static_cast<T>(static_cast<T>(1) << (std::numeric_limits<T>::digits - 1)));
+    std::fill(w.a.begin(), w.a.end(), static_cast<uint8_t>(std::numeric_limits<T>::digits - 1));
+    return w;
+}
+
+/// Tm bitler '1': popcount/parity'nin en youn girdisi.
+template<typename T>
+RegisterWorkload<T> workload_all_ones(const char* input, uint64_t seed) {
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    std::fill(w.values.begin(), w.values.end(), static_cast<T>(~static_cast<T>(0)));
+    return w;
+}
+
+/**
+ * @brief ngrlemez %50 karm: 'zero' ise sfr / rastgele (find_first_set_bit'in
+ * reg == 0 dal), deilse 2'nin kuvveti / rastgele (is_power_of_two'nun ksa devre dal).
+ */
+template<typename T>
+RegisterWorkload<T> workload_coin_flip(const char* input, uint64_t seed, bool zero) {
+    const int N = std::numeric_limits<T>::digits;
+    RegisterWorkload<T> w = make_workload<T>(input, seed);
+    BenchRng rng(seed ^ 0xC3C3);
+    for (size_t i = 0; i < kRegisterOps; i++) {
+        if (rng.next() & 1) continue;
+        w.values[i] = zero ? static_cast<T>(0) : static_cast<T>(static_cast<T>(1) << rng.below(N));
+    }
+    return w;
+}
+
+
+// =========================================================================
+// IV. TEK KELMELK LEMLER (DRT GENLK)
+// =========================================================================
+
+template<typename T> struct WidthName;
+template<> struct WidthName<uint8_t>  { static const char* get() { return "u8"; } };
+template<> struct WidthName<uint16_t> { static const char* get() { return "u16"; } };
+template<> struct WidthName<uint32_t> { static const char* get() { return "u32"; } };
+template<> struct WidthName<uint64_t> { static const char* get() { return "u64"; } };
+
+/**
+ * @brief Bir ilemi bir girdi kmesi zerinde ler. lem (deer, a, b) alr; sonucu
+ * checksum'a eklenir ve bench_keep ile her iterasyonda gzlemlenir.
+ */
+template<typename T, typename OpFn>
+void run_register_op(BenchHarness& h, const char* op, const RegisterWorkload<T>& w, OpFn fn) {
+    const std::string name = std::string(op) + " " + WidthName<T>::get() + " " + w.input;
+    const T* values = w.values.data();
+    const uint8_t* a = w.a.data();
+    const uint8_t* b = w.b.data();
+    h.run(name, kRegisterOps, kRegisterOps * sizeof(T), [=]() {
+        uint64_t acc = 0;
+        for (size_t i = 0; i < kRegisterOps; i++) acc += bench_keep(static_cast<uint64_t>(fn(values[i], a[i], b[i])));
+        return acc;
+    });
+}
+
+template<typename T>
+void bench_register_ops(BenchHarness& h) {
+    const int N = std::numeric_limits<T>::digits;
+    const uint64_t seed = 0x9E3779B97F4A7C15ULL + N;
+
+    const RegisterWorkload<T> index = workload_random_index<T>("rastgele", seed);
+    const RegisterWorkload<T> top = workload_high_bit<T>("st-bit", seed);
+    const RegisterWorkload<T> field = workload_random_field<T>("rastgele", seed);
+    const RegisterWorkload<T> full = workload_full_field<T>("tam-genilik", seed);
+    const RegisterWorkload<T> rotate = workload_rotate<T>("rastgele", seed, false);
+    const RegisterWorkload<T> rotate_wide = workload_rotate<T>("kaydrma>N", seed, true);
+    const RegisterWorkload<T> ones = workload_all_ones<T>("tm-bitler", seed);
+    const RegisterWorkload<T> zero_mix = workload_coin_flip<T>("%50-sfr", seed, true);
+    const RegisterWorkload<T> pow2_mix = workload_coin_flip<T>("%50-2^k", seed, false);
+
+    // I. Tek bit ilemleri.
+    auto set_bit = [](T v, int a, int) { return SetRegBit(v, a); };
+    auto clear_bit = [](T v, int a, int) { return ClearRegBit(v, a); };
+    auto toggle_bit = [](T v, int a, int) { return ToggleRegBit(v, a); };
+    auto is_set = [](T v, int a, int) { return isBitSet(v, a); };
+    run_register_op(h, "SetRegBit", index, set_bit);
+    run_register_op(h, "SetRegBit", top, set_bit);
+    run_register_op(h, "ClearRegBit", index, clear_bit);
+    run_register_op(h, "ClearRegBit", top, clear_bit);
+    run_register_op(h, "ToggleRegBit", index, toggle_bit);
+    run_register_op(h, "ToggleRegBit", top, toggle_bit);
+    run_register_op(h, "isBitSet", index, is_set);
+    run_register_op(h, "isBitSet", top, is_set);
+
+    // II-III. Maske ve bit alan ilemleri.
+    auto create_mask = [](T, int a, int b) { return CreateMask<T>(b, a); };
+    auto reverse_mask = [](T, int a, int b) { return ReverseMask<T>(b, a); };
+    auto get_field = [](T v, int a, int b) { return get_bit_field(v, a, b); };
+    auto set_field = [](T v, int a, int b) { return set_bit_field(v, a, b, static_cast<T>(v >> 3)); };
+    run_register_op(h, "CreateMask", field, create_mask);
+    run_register_op(h, "CreateMask", full, create_mask);
+    run_register_op(h, "ReverseMask", field, reverse_mask);
+    run_register_op(h, "ReverseMask", full, reverse_mask);
+    run_register_op(h, "get_bit_field", field, get_field);
+    run_register_op(h, "get_bit_field", full, get_field);
+    run_register_op(h, "set_bit_field", field, set_field);
+    run_register_op(h, "set_bit_field", full, set_field);
+
+    // IV. Pozisyon ve ak ilemleri.
+    auto rotate_left = [](T v, int a, int) { return RotateLeft(v, a); };
+    auto rotate_right = [](T v, int a, int) { return RotateRight(v, a); };
+    auto first_set = [](T v, int, int) { return find_first_set_bit(v); };
+    run_register_op(h, "RotateLeft", rotate, rotate_left);
+    run_register_op(h, "RotateLeft", rotate_wide, rotate_left);
+    run_register_op(h, "RotateRight", rotate, rotate_right);
+    run_register_op(h, "RotateRight", rotate_wide, rotate_right);
+    run_register_op(h, "find_first_set_bit", index, first_set);
+    run_register_op(h, "find_first_set_bit", top, first_set);
+    run_register_op(h, "find_first_set_bit", zero_mix, first_set);
+
+    // V. Kontrol ve analiz ilemleri.
+    auto popcount = [](T v, int, int) { return count_set_bits(v); };
+    auto parity = [](T v, int, int) { return getParity(v); };
+    auto parity_advanced = [](T v, int, int) { return getParityAdvanced(v); };
+    auto power_of_two = [](T v, int, int) { return is_power_of_two(v); };
+    run_register_op(h, "count_set_bits", index, popcount);
+    run_register_op(h, "count_set_bits", ones, popcount);
+    run_register_op(h, "getParity", index, parity);
+    run_register_op(h, "getParity", ones, parity);
+    run_register_op(h, "getParityAdvanced", index, parity_advanced);
+    run_register_op(h, "getParityAdvanced", ones, parity_advanced);
+    run_register_op(h, "is_power_of_two", index, power_of_two);
+    run_register_op(h, "is_power_of_two", pow2_mix, power_of_two);
+}
+
+
+// =========================================================================
+// V. TAMPON (BULK) EKRDEKLER
+// =========================================================================
+
+/**
+ * @brief Tampon popcount/parity'yi L1, L2 ve ana bellek boyutlarnda ler. lem = bir
+ * eleman; GB/s stunu ekirdein bellek verimidir.
+ */
+template<typename T>
+void bench_bulk_ops(BenchHarness& h) {
+    const size_t sizes[] = { 16u << 10, 512u << 10, 64u << 20 };
+    const char* size_names[] = { "16KiB", "512KiB", "64MiB" };
+    for (int s = 0; s < 3; s++) {
+        const size_t n = sizes[s] / sizeof(T);
+        std::vector<T> random(n);
+        std::vector<T> ones(n, static_cast<T>(~static_cast<T>(0)));
+        BenchRng rng(0xB01D + s);
+        for (T& v : random) v = static_cast<T>(rng.next());
+
+        const std::string suffix = std::string(" ") + WidthName<T>::get() + " " + size_names[s];
+        const T* r = random.data();
+        const T* o = ones.data();
+        h.run("count_set_bits[]" + suffix + " rastgele", n, sizes[s], [=]() { return count_set_bits(r, n); });
+        h.run("count_set_bits[]" + suffix + " tm-bitler", n, sizes[s], [=]() { return count_set_bits(o, n); });
+        h.run("getParity[]" + suffix + " rastgele", n, sizes[s],
+              [=]() { return static_cast<uint64_t>(getParity(r, n)); });
+    }
+}
+
+
+/**
+ * @brief Tampon kaydrma/dndrmeyi kelime hizal (r == 0) ve funnel shift (r != 0)
+ * miktarlarnda ler. lem = bir 64-bit kelime.
+ */
+void bench_bulk_shift(BenchHarness& h) {
+    const size_t sizes[] = { 16u << 10, 512u << 10, 64u << 20 };
+    const char* size_names[] = { "16KiB", "512KiB", "64MiB" };
+    const size_t shifts[] = { 64, 67 };
+    for (int s = 0; s < 3; s++) {
+        const size_t words = sizes[s] / sizeof(uint64_t);
+        const size_t nbits = words * 64;
+        std::vector<uint64_t> buffer(words);
+        std::vector<uint64_t> out(words);
+        BenchRng rng(0x5B1F7 + s);
+        for (uint64_t& w : buffer) w = rng.next();
+
+        uint64_t* b = buffer.data();
+        uint64_t* o = out.data();
+        for (size_t shift : shifts) {
+            const std::string suffix = std::string(" ") + size_names[s] + " kaydrma=" + std::to_string(shift);
+            h.run("ShiftLeft[] yerinde" + suffix, words, sizes[s], [=]() {
+                ShiftLeft(b, b, nbits, shift);
+                b[0] |= 0x5A5A5A5A5A5A5A5AULL;  // Tampon lm boyunca sfra akmasn.
+                return b[words - 1];
+            });
+            h.run("ShiftRight[] yerinde" + suffix, words, sizes[s], [=]() {
+                ShiftRight(b, b, nbits, shift);
+                b[words - 1] |= 0x5A5A5A5A5A5A5A5AULL;
+                return b[0];
+            });
+            h.run("RotateLeft[]" + suffix, words, sizes[s], [=]() {
+                RotateLeft(o, b, nbits, shift);
+                return o[words / 2];
+            });
+        }
+    }
+}
+
+
+/**
+ * @brief Benchmark paketinin giri noktas.
+ * @param argc Argman says.
+ * @param argv argv[1]: stee bal lm ad filtresi (alt dize).
+ */
+int main(int argc, char** argv) {
+    print_bitops_dispatch(std::cout);
+    BenchHarness harness(argc > 1 ? argv[1] : "");
+    harness.print_header();
+
+    std::cout << "=== TEK KELMELK LEMLER ===" << std::endl;
+    bench_register_ops<uint8_t>(harness);
+    bench_register_ops<uint16_t>(harness);
+    bench_register_ops<uint32_t>(harness);
+    bench_register_ops<uint64_t>(harness);
+
+    std::cout << "=== TAMPON EKRDEKLER ===" << std::endl;
+    bench_bulk_ops<uint8_t>(harness);
+    bench_bulk_ops<uint16_t>(harness);
+    bench_bulk_ops<uint32_t>(harness);
+    bench_bulk_ops<uint64_t>(harness);
+    bench_bulk_shift(harness);
+
+    std::cout << "(checksum " << harness.checksum() << ")" << std::endl;
+    return 0;
+}
@@ -0,0 +1,576 @@
+/**
+ * @file bitpack.cpp
+ * @brief Vektrel Bit Paketleme Codec'i Implementasyonu (Skaler / SSE2 / AVX2 ekirdekler).
+ *
+ * Her genilik (0..32) iin ayr bir ekirdek ablonu rneklenir (instantiate); genilik
+ * derleme zaman sabiti olduu iin kaydrma miktarlar ve kelime snrlar sabitlenir,
+ * 32 deerlik dng tamamen alr (unroll). ekirdekler genilie gre indekslenen
+ * fonksiyon iaretisi tablolarna yerletirilir; tablo program balangcnda
+ * bitops_cpu_features() ile bir kez seilir (bkz. bitops.cpp dispatch katman).
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "bitpack.h"
+#include "bitops.h"     // CreateMask, count_set_bits, get_bit_field/set_bit_field, bitops_cpu_features
+#include "bitstream.h"  // BitWriter/BitReader (eksik son blok)
+#include "thread_pool.h" // ThreadPool::parallel_for, kParallelGrainBytes
+#include <atomic>
+#include <cstring>      // std::memmove (paralel kodlamada segmentlerin bititirilmesi)
+#include <utility>      // std::index_sequence
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define BITPACK_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define BITPACK_X86_SIMD 0
+#endif
+
+namespace {
+
+using BlockKernel = void (*)(const uint32_t*, uint32_t*);
+
+// erit bana deer says (her iki blok boyutunda da 32).
+const int kValuesPerLane = 32;
+
+// =========================================================================
+// I. TAINABLR SKALER EKRDEKLER (REFERANS)
+// =========================================================================
+
+// Her erit 64-bit bir akmlatrde toplanr; 32 bit dolduka eridin sradaki kelimesi yazlr.
+template<int Width, int Lanes>
+void pack_scalar(const uint32_t* in, uint32_t* out) {
+	const uint32_t mask = CreateMask<uint32_t>(Width, 0);
+	for (int lane = 0; lane < Lanes; lane++) {
+		uint32_t* dst = out + lane;
+		uint64_t acc = 0;
+		int bits = 0;
+		for (int j = 0; j < kValuesPerLane; j++) {
+			acc |= static_cast<uint64_t>(in[j * Lanes + lane] & mask) << bits;
+			bits += Width;
+			if (bits >= 32) {
+				*dst = static_cast<uint32_t>(acc);
+				dst += Lanes;
+				acc >>= 32;
+				bits -= 32;
+			}
+		}
+	}
+}
+
+template<int Width, int Lanes>
+void unpack_scalar(const uint32_t* in, uint32_t* out) {
+	const uint32_t mask = CreateMask<uint32_t>(Width, 0);
+	for (int lane = 0; lane < Lanes; lane++) {
+		const uint32_t* src = in + lane;
+		uint64_t acc = 0;
+		int bits = 0;
+		for (int j = 0; j < kValuesPerLane; j++) {
+			if (bits < Width) {
+				acc |= static_cast<uint64_t>(*src) << bits;
+				src += Lanes;
+				bits += 32;
+			}
+			out[j * Lanes + lane] = static_cast<uint32_t>(acc) & mask;
+			acc >>= Width;
+			bits -= Width;
+		}
+	}
+}
+
+
+// =========================================================================
+// II. SIMD EKRDEKLER (SSE2 / AVX2)
+// =========================================================================
+
+#if BITPACK_X86_SIMD
+
+/**
+ * MHENDSLK NOTU: SSE2 x86-64'n taban komut setidir, bu yzden 128'lik ekirdekler
+ * hedef znitelii (target) gerektirmez. Genilik 0 ve 32 zel durumlardr: 0 hibir
+ * kelime retmez, 32 dz kopyadr. Dier geniliklerde son deer daima kelime snrnda
+ * biter (32 * Width bit), bu yzden dng sonunda akmlatrde artk kalmaz.
+ */
+template<int Width>
+void pack128_sse2(const uint32_t* in, uint32_t* out) {
+	const __m128i* src = reinterpret_cast<const __m128i*>(in);
+	__m128i* dst = reinterpret_cast<__m128i*>(out);
+	if (Width == 0) return;
+	if (Width == 32) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm_storeu_si128(dst + j, _mm_loadu_si128(src + j));
+		return;
+	}
+	const __m128i mask = _mm_set1_epi32(static_cast<int>(CreateMask<uint32_t>(Width, 0)));
+	__m128i acc = _mm_setzero_si128();
+	int shift = 0;
+#pragma GCC unroll 32
+	for (int j = 0; j < kValuesPerLane; j++) {
+		const __m128i v = _mm_and_si128(_mm_loadu_si128(src + j), mask);
+		acc = _mm_or_si128(acc, _mm_slli_epi32(v, shift));
+		shift += Width;
+		if (shift >= 32) {
+			_mm_storeu_si128(dst++, acc);
+			shift -= 32;
+			// Deerin kelimeye smayan st ksm bir sonraki kelimenin bana tanr.
+			acc = (shift > 0) ? _mm_srli_epi32(v, Width - shift) : _mm_setzero_si128();
+		}
+	}
+}
+
+template<int Width>
+void unpack128_sse2(const uint32_t* in, uint32_t* out) {
+	const __m128i* src = reinterpret_cast<const __m128i*>(in);
+	__m128i* dst = reinterpret_cast<__m128i*>(out);
+	if (Width == 0) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm_storeu_si128(dst + j, _mm_setzero_si128());
+		return;
+	}
+	if (Width == 32) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm_storeu_si128(dst + j, _mm_loadu_si128(src + j));
+		return;
+	}
+	const __m128i mask = _mm_set1_epi32(static_cast<int>(CreateMask<uint32_t>(Width, 0)));
+	__m128i word = _mm_loadu_si128(src);
+	int shift = 0;
+#pragma GCC unroll 32
+	for (int j = 0; j < kValuesPerLane; j++) {
+		__m128i v = _mm_srli_epi32(word, shift);
+		shift += Width;
+		if (shift >= 32) {
+			shift -= 32;
+			// Son deer kelime snrnda biter; paketlenmi verinin tesi okunmaz.
+			if (j != kValuesPerLane - 1) word = _mm_loadu_si128(++src);
+			if (shift > 0) v = _mm_or_si128(v, _mm_slli_epi32(word, Width - shift));
+		}
+		_mm_storeu_si128(dst + j, _mm_and_si128(v, mask));
+	}
+}
+
+template<int Width>
+__attribute__((target("avx2")))
+void pack256_avx2(const uint32_t* in, uint32_t* out) {
+	const __m256i* src = reinterpret_cast<const __m256i*>(in);
+	__m256i* dst = reinterpret_cast<__m256i*>(out);
+	if (Width == 0) return;
+	if (Width == 32) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm256_storeu_si256(dst + j, _mm256_loadu_si256(src + j));
+		return;
+	}
+	const __m256i mask = _mm256_set1_epi32(static_cast<int>(CreateMask<uint32_t>(Width, 0)));
+	__m256i acc = _mm256_setzero_si256();
+	int shift = 0;
+#pragma GCC unroll 32
+	for (int j = 0; j < kValuesPerLane; j++) {
+		const __m256i v = _mm256_and_si256(_mm256_loadu_si256(src + j), mask);
+		acc = _mm256_or_si256(acc, _mm256_slli_epi32(v, shift));
+		shift += Width;
+		if (shift >= 32) {
+			_mm256_storeu_si256(dst++, acc);
+			shift -= 32;
+			acc = (shift > 0) ? _mm256_srli_epi32(v, Width - shift) : _mm256_setzero_si256();
+		}
+	}
+}
+
+template<int Width>
+__attribute__((target("avx2")))
+void unpack256_avx2(const uint32_t* in, uint32_t* out) {
+	const __m256i* src = reinterpret_cast<const __m256i*>(in);
+	__m256i* dst = reinterpret_cast<__m256i*>(out);
+	if (Width == 0) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm256_storeu_si256(dst + j, _mm256_setzero_si256());
+		return;
+	}
+	if (Width == 32) {
+		for (int j = 0; j < kValuesPerLane; j++) _mm256_storeu_si256(dst + j, _mm256_loadu_si256(src + j));
+		return;
+	}
+	const __m256i mask = _mm256_set1_epi32(static_cast<int>(CreateMask<uint32_t>(Width, 0)));
+	__m256i word = _mm256_loadu_si256(src);
+	int shift = 0;
+#pragma GCC unroll 32
+	for (int j = 0; j < kValuesPerLane; j++) {
+		__m256i v = _mm256_srli_epi32(word, shift);
+		shift += Width;
+		if (shift >= 32) {
+			shift -= 32;
+			if (j != kValuesPerLane - 1) word = _mm256_loadu_si256(++src);
+			if (shift > 0) v = _mm256_or_si256(v, _mm256_slli_epi32(word, Width - shift));
+		}
+		_mm256_storeu_si256(dst + j, _mm256_and_si256(v, mask));
+	}
+}
+
+#endif // BITPACK_X86_SIMD
+
+
+// =========================================================================
+// III. GENLK TABLOLARI VE DISPATCH
+// =========================================================================
+
+struct KernelTable {
+	BlockKernel pack[33];
+	BlockKernel unpack[33];
+	const char* name;
+};
+
+template<template<int> class Kernels, size_t... W>
+KernelTable make_table(const char* name, std::index_sequence<W...>) {
+	return KernelTable{ { &Kernels<static_cast<int>(W)>::pack... },
+	                    { &Kernels<static_cast<int>(W)>::unpack... }, name };
+}
+
+// ablon ablon parametresi (template template) olarak geirilebilmesi iin ekirdek iftleri.
+template<int W> struct Scalar128 { static void pack(const uint32_t* i, uint32_t* o) { pack_scalar<W, 4>(i, o); }
+                                   static void unpack(const uint32_t* i, uint32_t* o) { unpack_scalar<W, 4>(i, o); } };
+template<int W> struct Scalar256 { static void pack(const uint32_t* i, uint32_t* o) { pack_scalar<W, 8>(i, o); }
+                                   static void unpack(const uint32_t* i, uint32_t* o) { unpack_scalar<W, 8>(i, o); } };
+#if BITPACK_X86_SIMD
+template<int W> struct Sse2_128 { static void pack(const uint32_t* i, uint32_t* o) { pack128_sse2<W>(i, o); }
+                                  static void unpack(const uint32_t* i, uint32_t* o) { unpack128_sse2<W>(i, o); } };
+template<int W> struct Avx2_256 { static void pack(const uint32_t* i, uint32_t* o) { pack256_avx2<W>(i, o); }
+                                  static void unpack(const uint32_t* i, uint32_t* o) { unpack256_avx2<W>(i, o); } };
+#endif
+
+struct BitpackDispatch {
+	KernelTable block128;
+	KernelTable block256;
+};
+
+BitpackDispatch build_bitpack_dispatch() {
+	const std::make_index_sequence<33> widths;
+	BitpackDispatch d;
+#if BITPACK_X86_SIMD
+	d.block128 = make_table<Sse2_128>("sse2", widths);
+	d.block256 = bitops_cpu_features().avx2 ? make_table<Avx2_256>("avx2", widths)
+	                                        : make_table<Scalar256>("scalar", widths);
+#else
+	d.block128 = make_table<Scalar128>("scalar", widths);
+	d.block256 = make_table<Scalar256>("scalar", widths);
+#endif
+	return d;
+}
+
+const BitpackDispatch& bitpack_dispatch() {
+	static const BitpackDispatch table = build_bitpack_dispatch();
+	return table;
+}
+
+const KernelTable& kernels_for(BitpackBlockSize block) {
+	return (block == BitpackBlockSize::k256) ? bitpack_dispatch().block256 : bitpack_dispatch().block128;
+}
+
+
+// =========================================================================
+// IV. BLOK DNMLER (FRAME-OF-REFERENCE / DELTA)
+// =========================================================================
+
+// Blok balk kelimesi alanlar.
+const int kHeaderWidthStart = 0;
+const int kHeaderWidthLength = 6;
+const int kHeaderModeStart = 8;
+const int kHeaderModeLength = 2;
+
+// Deerleri moda gre dntrr ve taban dndrr. Delta fark ayn eritteki nceki
+// deerden alnr (mesafe = erit says); ilk erit grubunun ncl tabandr.
+uint32_t forward_transform(const uint32_t* in, size_t count, size_t lanes, BitpackMode mode, uint32_t* out) {
+	if (mode == BitpackMode::FrameOfReference) {
+		uint32_t base = in[0];
+		for (size_t i = 1; i < count; i++) base = (in[i] < base) ? in[i] : base;
+		for (size_t i = 0; i < count; i++) out[i] = in[i] - base;
+		return base;
+	}
+	const uint32_t base = in[0];
+	for (size_t i = 0; i < count; i++) out[i] = in[i] - ((i < lanes) ? base : in[i - lanes]);
+	return base;
+}
+
+// Alm farklar yerinde (in-place) zgn deerlere evirir.
+void inverse_transform(uint32_t* values, size_t count, size_t lanes, BitpackMode mode, uint32_t base) {
+	if (mode == BitpackMode::FrameOfReference) {
+		for (size_t i = 0; i < count; i++) values[i] += base;
+		return;
+	}
+	const size_t head = (count < lanes) ? count : lanes;
+	for (size_t i = 0; i < head; i++) values[i] += base;
+	for (size_t i = lanes; i < count; i++) values[i] += values[i - lanes];
+}
+
+#if BITPACK_X86_SIMD
+
+/**
+ * MHENDSLK NOTU: Tam bloklarda dnmler SSE2 ile yaplr. erit says 4'n kat
+ * olduundan (4 / 8) delta'nn i - L bamll, her satrdaki L / 4 vektrn bir nceki
+ * satrdaki karlna eklenmesiyle (n ek toplam) zlr; satr ii bamllk yoktur.
+ * SSE2'de iaretsiz min bulunmad iin (_mm_min_epu32 SSE4.1'dir) karlatrma iaret
+ * biti evrilerek (bias) iaretli olarak yaplr.
+ */
+uint32_t forward_transform_block(const uint32_t* in, size_t count, size_t lanes, BitpackMode mode, uint32_t* out) {
+	const __m128i* src = reinterpret_cast<const __m128i*>(in);
+	__m128i* dst = reinterpret_cast<__m128i*>(out);
+	const size_t vectors = count / 4;
+	if (mode == BitpackMode::FrameOfReference) {
+		const __m128i bias = _mm_set1_epi32(static_cast<int>(0x80000000u));
+		__m128i min = _mm_xor_si128(_mm_loadu_si128(src), bias);
+		for (size_t j = 1; j < vectors; j++) {
+			const __m128i v = _mm_xor_si128(_mm_loadu_si128(src + j), bias);
+			const __m128i lt = _mm_cmplt_epi32(v, min);
+			min = _mm_or_si128(_mm_and_si128(lt, v), _mm_andnot_si128(lt, min));
+		}
+		uint32_t lane_min[4];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(lane_min), _mm_xor_si128(min, bias));
+		uint32_t base = lane_min[0];
+		for (int l = 1; l < 4; l++) base = (lane_min[l] < base) ? lane_min[l] : base;
+		const __m128i b = _mm_set1_epi32(static_cast<int>(base));
+		for (size_t j = 0; j < vectors; j++) _mm_storeu_si128(dst + j, _mm_sub_epi32(_mm_loadu_si128(src + j), b));
+		return base;
+	}
+	const uint32_t base = in[0];
+	const size_t row = lanes / 4;
+	const __m128i b = _mm_set1_epi32(static_cast<int>(base));
+	for (size_t j = 0; j < row; j++) _mm_storeu_si128(dst + j, _mm_sub_epi32(_mm_loadu_si128(src + j), b));
+	for (size_t j = row; j < vectors; j++) {
+		_mm_storeu_si128(dst + j, _mm_sub_epi32(_mm_loadu_si128(src + j), _mm_loadu_si128(src + j - row)));
+	}
+	return base;
+}
+
+// n ek toplam: nceki satr yazmalarda (register) tutulur; bellekten geri okunmaz
+// (store-to-load forwarding gecikmesi zincire eklenmez).
+template<int Row>
+void prefix_sum_rows(__m128i* v, size_t vectors, __m128i b) {
+	__m128i prev[Row];
+	for (int k = 0; k < Row; k++) prev[k] = b;
+	for (size_t j = 0; j < vectors; j += Row) {
+		for (int k = 0; k < Row; k++) {
+			prev[k] = _mm_add_epi32(_mm_loadu_si128(v + j + k), prev[k]);
+			_mm_storeu_si128(v + j + k, prev[k]);
+		}
+	}
+}
+
+void inverse_transform_block(uint32_t* values, size_t count, size_t lanes, BitpackMode mode, uint32_t base) {
+	__m128i* v = reinterpret_cast<__m128i*>(values);
+	const size_t vectors = count / 4;
+	const __m128i b = _mm_set1_epi32(static_cast<int>(base));
+	if (mode == BitpackMode::FrameOfReference) {
+		for (size_t j = 0; j < vectors; j++) _mm_storeu_si128(v + j, _mm_add_epi32(_mm_loadu_si128(v + j), b));
+		return;
+	}
+	if (lanes == 4) {
+		prefix_sum_rows<1>(v, vectors, b);
+	} else {
+		prefix_sum_rows<2>(v, vectors, b);
+	}
+}
+
+#else
+
+uint32_t forward_transform_block(const uint32_t* in, size_t count, size_t lanes, BitpackMode mode, uint32_t* out) {
+	return forward_transform(in, count, lanes, mode, out);
+}
+
+void inverse_transform_block(uint32_t* values, size_t count, size_t lanes, BitpackMode mode, uint32_t base) {
+	inverse_transform(values, count, lanes, mode, base);
+}
+
+#endif // BITPACK_X86_SIMD
+
+} // namespace
+
+
+// =========================================================================
+// V. GENEL API (PUBLIC API)
+// =========================================================================
+
+int bitpack_required_width(const uint32_t* in, size_t n) {
+	uint32_t acc = 0;
+	for (size_t i = 0; i < n; i++) acc |= in[i];
+	// En yksek '1' bitinin altndaki tm bitler doldurulur (smear); popcount = bit genilii.
+	acc |= acc >> 1;
+	acc |= acc >> 2;
+	acc |= acc >> 4;
+	acc |= acc >> 8;
+	acc |= acc >> 16;
+	return count_set_bits(acc);
+}
+
+void bitpack128_pack(const uint32_t* in, uint32_t* out, int width) {
+	bitpack_dispatch().block128.pack[width](in, out);
+}
+
+void bitpack128_unpack(const uint32_t* in, uint32_t* out, int width) {
+	bitpack_dispatch().block128.unpack[width](in, out);
+}
+
+void bitpack256_pack(const uint32_t* in, uint32_t* out, int width) {
+	bitpack_dispatch().block256.pack[width](in, out);
+}
+
+void bitpack256_unpack(const uint32_t* in, uint32_t* out, int width) {
+	bitpack_dispatch().block256.unpack[width](in, out);
+}
+
+const char* bitpack_kernel_name(BitpackBlockSize block) {
+	return kernels_for(block).name;
+}
+
+size_t bitpack_max_encoded_words(size_t n, BitpackBlockSize block) {
+	const size_t block_values = static_cast<size_t>(block);
+	const size_t blocks = (n + block_values - 1) / block_values;
+	// En kt durum: Her blokta balk + taban + 32 bitlik deerler.
+	return blocks * 2 + n;
+}
+
+size_t bitpack_encode(const uint32_t* in, size_t n, uint32_t* out, BitpackMode mode, BitpackBlockSize block) {
+	const KernelTable& kernels = kernels_for(block);
+	const size_t block_values = static_cast<size_t>(block);
+	const size_t lanes = block_values / kValuesPerLane;
+	uint32_t scratch[256];
+	uint32_t* p = out;
+
+	for (size_t i = 0; i < n; i += block_values) {
+		const size_t count = (n - i < block_values) ? n - i : block_values;
+		const uint32_t* values = in + i;
+		uint32_t base = 0;
+		if (mode != BitpackMode::Plain) {
+			base = (count == block_values) ? forward_transform_block(values, count, lanes, mode, scratch)
+			                               : forward_transform(values, count, lanes, mode, scratch);
+			values = scratch;
+		}
+		const int width = bitpack_required_width(values, count);
+
+		uint32_t header = 0;
+		header = set_bit_field(header, kHeaderWidthStart, kHeaderWidthLength, static_cast<uint32_t>(width));
+		header = set_bit_field(header, kHeaderModeStart, kHeaderModeLength, static_cast<uint32_t>(mode));
+		*p++ = header;
+		if (mode != BitpackMode::Plain) *p++ = base;
+
+		if (count == block_values) {
+			kernels.pack[width](values, p);
+			p += static_cast<size_t>(width) * lanes;
+		} else {
+			// Eksik son blok: Yatay (horizontal) LSB-nce dzen, kelime snrna tamamlanr.
+			const size_t words = (count * static_cast<size_t>(width) + 31) / 32;
+			BitWriter writer(reinterpret_cast<uint8_t*>(p), words * sizeof(uint32_t));
+			writer.write_array(values, count, width);
+			const size_t bytes = writer.finish();
+			for (size_t b = bytes; b < words * sizeof(uint32_t); b++) reinterpret_cast<uint8_t*>(p)[b] = 0;
+			p += words;
+		}
+	}
+	return static_cast<size_t>(p - out);
+}
+
+size_t bitpack_decode(const uint32_t* in, size_t in_words, uint32_t* out, size_t n,
+                      BitpackMode mode, BitpackBlockSize block) {
+	const KernelTable& kernels = kernels_for(block);
+	const size_t block_values = static_cast<size_t>(block);
+	const size_t lanes = block_values / kValuesPerLane;
+	const size_t header_words = (mode == BitpackMode::Plain) ? 1 : 2;
+	const uint32_t* p = in;
+	const uint32_t* end = in + in_words;
+
+	for (size_t i = 0; i < n; i += block_values) {
+		const size_t count = (n - i < block_values) ? n - i : block_values;
+		if (static_cast<size_t>(end - p) < header_words) return 0;
+		const uint32_t header = *p++;
+		const int width = static_cast<int>(get_bit_field(header, kHeaderWidthStart, kHeaderWidthLength));
+		const uint32_t header_mode = get_bit_field(header, kHeaderModeStart, kHeaderModeLength);
+		if (width > 32 || header_mode != static_cast<uint32_t>(mode)) return 0;
+		const uint32_t base = (mode != BitpackMode::Plain) ? *p++ : 0;
+
+		if (count == block_values) {
+			const size_t words = static_cast<size_t>(width) * lanes;
+			if (static_cast<size_t>(end - p) < words) return 0;
+			kernels.unpack[width](p, out + i);
+			p += words;
+		} else {
+			const size_t words = (count * static_cast<size_t>(width) + 31) / 32;
+			if (static_cast<size_t>(end - p) < words) return 0;
+			BitReader reader(reinterpret_cast<const uint8_t*>(p), words * sizeof(uint32_t));
+			reader.read_array(out + i, count, width);
+			p += words;
+		}
+		if (mode == BitpackMode::Plain) continue;
+		if (count == block_values) {
+			inverse_transform_block(out + i, count, lanes, mode, base);
+		} else {
+			inverse_transform(out + i, count, lanes, mode, base);
+		}
+	}
+	return static_cast<size_t>(p - in);
+}
+
+namespace {
+
+// Paralel segment boyutu: kParallelGrainBytes'lk girdiye en yakn tam blok kat.
+size_t parallel_segment_values(BitpackBlockSize block) {
+	const size_t block_values = static_cast<size_t>(block);
+	const size_t blocks = kParallelGrainBytes / sizeof(uint32_t) / block_values;
+	return (blocks == 0 ? 1 : blocks) * block_values;
+}
+
+} // namespace
+
+size_t bitpack_encode(ThreadPool& pool, const uint32_t* in, size_t n, uint32_t* out,
+                      BitpackMode mode, BitpackBlockSize block) {
+	const size_t segment_values = parallel_segment_values(block);
+	const size_t segments = ThreadPool::block_count(n, segment_values);
+	if (segments <= 1) return bitpack_encode(in, n, out, mode, block);
+
+	// Segment s, [max(ba), max(sonu)) aralna yazar; en kt durum snr tam bloklarda
+	// toplamsal olduundan blgeler akmaz.
+	std::vector<size_t> used(segments);
+	pool.parallel_for(0, n, segment_values, [&](size_t lo, size_t hi) {
+		used[lo / segment_values] = bitpack_encode(in + lo, hi - lo, out + bitpack_max_encoded_words(lo, block), mode, block);
+	});
+	// Bititirme: Hedef daima segmentin kendi blgesinin banda veya solundadr ve bir nceki
+	// segmentin blgesini amaz; sradaki segmentin henz tanmam verisi ezilmez.
+	size_t total = used[0];
+	for (size_t seg = 1; seg < segments; seg++) {
+		const uint32_t* src = out + bitpack_max_encoded_words(seg * segment_values, block);
+		std::memmove(out + total, src, used[seg] * sizeof(uint32_t));
+		total += used[seg];
+	}
+	return total;
+}
+
+size_t bitpack_decode(ThreadPool& pool, const uint32_t* in, size_t in_words, uint32_t* out, size_t n,
+                      BitpackMode mode, BitpackBlockSize block) {
+	const size_t segment_values = parallel_segment_values(block);
+	const size_t segments = ThreadPool::block_count(n, segment_values);
+	if (segments <= 1) return bitpack_decode(in, in_words, out, n, mode, block);
+
+	// Segment balarnn kodlanm konumlar: Balklardaki genilikle bloklar atlanr.
+	const size_t block_values = static_cast<size_t>(block);
+	const size_t lanes = block_values / kValuesPerLane;
+	const size_t header_words = (mode == BitpackMode::Plain) ? 1 : 2;
+	std::vector<size_t> offsets(segments + 1);
+	size_t pos = 0;
+	for (size_t i = 0; i < n; i += block_values) {
+		if (i % segment_values == 0) offsets[i / segment_values] = pos;
+		const size_t count = (n - i < block_values) ? n - i : block_values;
+		if (in_words - pos < header_words) return 0;
+		const size_t width = get_bit_field(in[pos], kHeaderWidthStart, kHeaderWidthLength);
+		if (width > 32) return 0;
+		const size_t words = header_words + ((count == block_values) ? width * lanes : (count * width + 31) / 32);
+		if (in_words - pos < words) return 0;
+		pos += words;
+	}
+	offsets[segments] = pos;
+
+	std::atomic<bool> ok(true);
+	pool.parallel_for(0, n, segment_values, [&](size_t lo, size_t hi) {
+		const size_t seg = lo / segment_values;
+		const size_t words = offsets[seg + 1] - offsets[seg];
+		if (bitpack_decode(in + offsets[seg], words, out + lo, hi - lo, mode, block) != words) {
+			ok.store(false, std::memory_order_relaxed);
+		}
+	});
+	return ok.load() ? pos : 0;
+}
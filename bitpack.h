@@ -0,0 +1,173 @@
+/**
+ * @file bitpack.h
+ * @brief Tamsay Dizileri iin Vektrel Bit Paketleme Codec'i (BP128 / BP256 Tarz).
+ *
+ * 32-bit olarak saklanan sayalarn ou 5..13 bite sar. Bu modl 128 veya 256
+ * deerlik bloklar 1..32 bit aras herhangi bir genilikte paketler ve aar.
+ *
+ * Blok dzeni dikeydir (vertical layout): L erit (lane) iin (128 -> 4, 256 -> 8),
+ * i. deer (i % L). eride der ve her erit kendi 32 deerini LSB-nce ardk
+ * 32-bit kelimelere paketler. Paketlenmi k. kelimenin l. eridi out[k * L + l]
+ * konumundadr. Bylece bir SIMD yazmac (SSE2: 4 x 32, AVX2: 8 x 32) tm eritleri
+ * ayn anda kaydrr/maskeler; deerler aras kelime snr hesaplamas yoktur.
+ * Ayn dzen tanabilir skaler ekirdekle de retilir; kt ekirdekten bamszdr.
+ *
+ * Blok ekirdeklerinin yannda, keyfi uzunluktaki diziler iin blok balkl bir ak
+ * codec'i (bitpack_encode / bitpack_decode) ve istee bal referans erevesi
+ * (Frame-of-Reference) ile delta modlar bulunur.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef BITPACK_H
+#define BITPACK_H
+
+#include <cstddef>
+#include <cstdint>
+
+// =========================================================================
+// I. BLOK EKRDEKLER (BLOCK KERNELS)
+// =========================================================================
+
+/// Blok boyutu (deer says). erit says = blok / 32.
+enum class BitpackBlockSize : uint16_t {
+    k128 = 128,     ///< 4 erit (SSE2 dzeni).
+    k256 = 256      ///< 8 erit (AVX2 dzeni).
+};
+
+/**
+ * @brief Deerlerin hepsini kaypsz tutmak iin gereken en kk bit genilii.
+ * @param in Deer dizisi.
+ * @param n Deer says.
+ * @return 0..32 (tm deerler 0 ise 0).
+ */
+int bitpack_required_width(const uint32_t* in, size_t n);
+
+/**
+ * @brief 128 deeri 'width' bitlik alanlara dikey dzende paketler.
+ *
+ * Deerlerin 'width' bitten taan st bitleri yok saylr.
+ *
+ * @param in 128 deer.
+ * @param out Hedef: width * 4 kelime (width * 16 byte).
+ * @param width Alan genilii (0..32).
+ */
+void bitpack128_pack(const uint32_t* in, uint32_t* out, int width);
+
+/**
+ * @brief bitpack128_pack ile paketlenmi 128 deeri aar.
+ * @param in Paketlenmi veri: width * 4 kelime.
+ * @param out Hedef: 128 deer.
+ * @param width Alan genilii (0..32).
+ */
+void bitpack128_unpack(const uint32_t* in, uint32_t* out, int width);
+
+/// 256 deerlik (8 eritli) paketleme. Hedef: width * 8 kelime.
+void bitpack256_pack(const uint32_t* in, uint32_t* out, int width);
+
+/// 256 deerlik (8 eritli) ama. Kaynak: width * 8 kelime.
+void bitpack256_unpack(const uint32_t* in, uint32_t* out, int width);
+
+
+// =========================================================================
+// II. AKI CODEC' (STREAM CODEC)
+// =========================================================================
+
+/**
+ * @brief Blok ii deer dnm.
+ *
+ * - Plain: Deerler olduu gibi paketlenir.
+ * - FrameOfReference: Bloun en kk deeri taban (base) olarak saklanr, deerler
+ *   tabandan farklar olarak paketlenir. Dar bir aralkta dalgalanan sayalar iindir.
+ * - Delta: Her deer, ayn eritteki bir nceki deerden (i - L) fark olarak paketlenir;
+ *   bloun ilk deeri taban olarak saklanr. Artan (monoton) diziler, rn. zaman damgalar
+ *   veya kmlatif sayalar iindir. erit bazl fark, ama tarafnda n ek toplamnn
+ *   (prefix sum) SIMD ile yaplabilmesini salar. Azalan deerlerde fark iaretsiz
+ *   tamayla (wraparound) saklanr; sonu yine dorudur ancak genilik 32'ye kar.
+ */
+enum class BitpackMode : uint8_t {
+    Plain = 0,
+    FrameOfReference = 1,
+    Delta = 2
+};
+
+/**
+ * @brief n deer iin bitpack_encode ktsnn st snr (kelime).
+ * @param n Deer says.
+ * @param block Blok boyutu.
+ * @return Gereken en fazla 32-bit kelime says.
+ */
+size_t bitpack_max_encoded_words(size_t n, BitpackBlockSize block);
+
+/**
+ * @brief Bir tamsay dizisini blok blok, her blok kendi geniliiyle paketler.
+ *
+ * Her blok: [balk kelimesi: genilik (bit 0..5), mod (bit 8..9)] [taban (Plain hari)]
+ * [paketlenmi veri]. Sondaki eksik blok (< blok boyutu) BitWriter ile yatay dzende
+ * paketlenir ve kelime snrna tamamlanr. Kelimeler host byte srasndadr.
+ *
+ * @param in Deerler.
+ * @param n Deer says.
+ * @param out Hedef (en az bitpack_max_encoded_words(n, block) kelime).
+ * @param mode Blok ii dnm.
+ * @param block Blok boyutu.
+ * @return Yazlan kelime says.
+ */
+size_t bitpack_encode(const uint32_t* in, size_t n, uint32_t* out,
+                      BitpackMode mode = BitpackMode::Plain,
+                      BitpackBlockSize block = BitpackBlockSize::k128);
+
+/**
+ * @brief bitpack_encode ktsndan n deeri geri aar.
+ *
+ * Mod ve blok boyutu kodlamadakiyle ayn olmaldr; balktaki mod uyumazsa veya
+ * veri kesikse (truncated) hata dndrlr.
+ *
+ * @param in Kodlanm kelimeler.
+ * @param in_words Kodlanm veri uzunluu (kelime).
+ * @param out Hedef: n deer.
+ * @param n Alacak deer says.
+ * @param mode Blok ii dnm.
+ * @param block Blok boyutu.
+ * @return Tketilen kelime says; hatal/kesik veride 0.
+ */
+size_t bitpack_decode(const uint32_t* in, size_t in_words, uint32_t* out, size_t n,
+                      BitpackMode mode = BitpackMode::Plain,
+                      BitpackBlockSize block = BitpackBlockSize::k128);
+
+class ThreadPool;   // thread_pool.h
+
+/**
+ * @brief bitpack_encode'un paralel srm; kt seri srmle kelime kelime ayndr.
+ *
+ * MHENDSLK NOTU (Deiken uzunluklu kt): Bloklar birbirinden bamsz kodland iin
+ * girdi, tam bloklardan oluan segmentlere (~kParallelGrainBytes) blnr. Her segment,
+ * ktda kendi en kt durum konumuna (bitpack_max_encoded_words(segment ba)) paralel
+ * kodlanr; ardndan segmentler srayla sola kaydrlarak (memmove) bititirilir. Hedef
+ * tampon seri srmdekiyle ayndr: En az bitpack_max_encoded_words(n, block) kelime.
+ */
+size_t bitpack_encode(ThreadPool& pool, const uint32_t* in, size_t n, uint32_t* out,
+                      BitpackMode mode = BitpackMode::Plain,
+                      BitpackBlockSize block = BitpackBlockSize::k128);
+
+/**
+ * @brief bitpack_decode'un paralel srm.
+ *
+ * Segment snrlar nce blok balklar seri olarak atlanarak bulunur (blok bana bir
+ * okuma), ardndan segmentler paralel alr. Dn deeri ve hata koullar seri
+ * srmle ayndr.
+ */
+size_t bitpack_decode(ThreadPool& pool, const uint32_t* in, size_t in_words, uint32_t* out, size_t n,
+                      BitpackMode mode = BitpackMode::Plain,
+                      BitpackBlockSize block = BitpackBlockSize::k128);
+
+/**
+ * @brief Seilen blok ekirdeinin adn dndrr (rn: "sse2", "avx2", "scalar").
+ * @param block Blok boyutu.
+ */
+const char* bitpack_kernel_name(BitpackBlockSize block);
+
+#endif // BITPACK_H
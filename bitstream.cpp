@@ -0,0 +1,128 @@
+/**
+ * @file bitstream.cpp
+ * @brief BitWriter / BitReader Toplu (Bulk) ve Souk Yol (Cold Path) Implementasyonlar.
+ *
+ * Alan bana scak yollar (write/read/peek) satr ii olmalar iin 'bitstream.h'
+ * dosyasndadr. Bu dosya, dizi ilemlerini ve tampon sonu gibi nadir durumlar ierir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "bitstream.h"
+
+// =========================================================================
+// I. BT YAZICI (BIT WRITER)
+// =========================================================================
+
+bool BitWriter::write_array(const uint32_t* values, size_t n, int width) {
+	// Kapasite tm dizi iin bir kez kontrol edilir; i dng yalnzca put() arr.
+	if (bits_written() + static_cast<uint64_t>(n) * width > static_cast<uint64_t>(capacity_) * 8) return false;
+	for (size_t i = 0; i < n; i++) {
+		put(values[i], width);
+	}
+	return true;
+}
+
+bool BitWriter::write_array(const uint64_t* values, size_t n, int width) {
+	if (bits_written() + static_cast<uint64_t>(n) * width > static_cast<uint64_t>(capacity_) * 8) return false;
+	for (size_t i = 0; i < n; i++) {
+		put(values[i], width);
+	}
+	return true;
+}
+
+size_t BitWriter::finish() {
+	// Kalan ksmi bitler byte byte yazlr (son byte'n st bitleri sfrdr).
+	const int bytes = (acc_bits_ + 7) >> 3;
+	for (int i = 0; i < bytes; i++) {
+		buffer_[byte_pos_++] = static_cast<uint8_t>(acc_ >> (8 * i));
+	}
+	acc_ = 0;
+	acc_bits_ = 0;
+	return byte_pos_;
+}
+
+
+// =========================================================================
+// II. BT OKUYUCU (BIT READER)
+// =========================================================================
+
+// Tampon sonunda 8 byte'lk okuma snr dna taaca iin byte byte doldurulur.
+void BitReader::refill_tail() {
+	while (acc_bits_ <= 56 && byte_pos_ < size_) {
+		acc_ |= static_cast<uint64_t>(data_[byte_pos_++]) << acc_bits_;
+		acc_bits_ += 8;
+	}
+}
+
+// Dar alanlar (1..28 bit): Tek refill ile en az 56 bit gelir; akmlatrdeki tm tam
+// alanlar arada refill veya tampon snr kontrol yaplmadan alr.
+// NOT: Ka alan alaca blme (acc_bits_ / width) ile hesaplanmaz; tamsay blmesi
+// refill bana onlarca dngye mal olur ve geni alanlarda ama maliyetini aar.
+template<typename T>
+void BitReader::read_array_narrow(T* out, size_t n, int width) {
+	const uint64_t mask = CreateMask<uint64_t>(width, 0);
+	size_t i = 0;
+	while (i < n) {
+		refill();
+		if (acc_bits_ < width) break;   // Tampon sonu: Kalanlar am (overrun) denetimli yoldan okunur.
+		do {
+			out[i++] = static_cast<T>(acc_ & mask);
+			acc_ >>= width;
+			acc_bits_ -= width;
+		} while (acc_bits_ >= width && i < n);
+	}
+	for (; i < n; i++) {
+		out[i] = static_cast<T>(read(width));
+	}
+}
+
+// 28 bitten geni alanlarda refill bana en fazla bir alan alabildii iin (56 / 29 < 2)
+// oklu ama dngs kazan salamaz; alan bana read() daha az dallanma ierir.
+static const int kNarrowFieldLimit = 28;
+
+void BitReader::read_array(uint32_t* out, size_t n, int width) {
+	if (width > 0 && width <= kNarrowFieldLimit) {
+		read_array_narrow(out, n, width);
+		return;
+	}
+	for (size_t i = 0; i < n; i++) {
+		out[i] = static_cast<uint32_t>(read(width));
+	}
+}
+
+void BitReader::read_array(uint64_t* out, size_t n, int width) {
+	if (width > 0 && width <= kNarrowFieldLimit) {
+		read_array_narrow(out, n, width);
+		return;
+	}
+	for (size_t i = 0; i < n; i++) {
+		out[i] = read(width);
+	}
+}
+
+void BitReader::skip(uint64_t nbits) {
+	if (nbits <= static_cast<uint64_t>(acc_bits_)) {
+		consume(static_cast<int>(nbits));
+		return;
+	}
+	// Akmlatr boalt, tam byte'lar dorudan atla, kalan 0..7 biti normal yoldan tket.
+	nbits -= acc_bits_;
+	acc_ = 0;
+	acc_bits_ = 0;
+	const uint64_t bytes = nbits >> 3;
+	if (bytes > size_ - byte_pos_) {
+		byte_pos_ = size_;
+		overrun_ = true;
+		return;
+	}
+	byte_pos_ += static_cast<size_t>(bytes);
+	const int rest = static_cast<int>(nbits & 7);
+	if (rest != 0) {
+		peek(rest);
+		consume(rest);
+	}
+}
@@ -0,0 +1,263 @@
+/**
+ * @file bitstream.h
+ * @brief Bit Hassasiyetinde Paketleme: BitWriter / BitReader (64-bit Akmlatrl).
+ *
+ * get_bit_field/set_bit_field tek bir register zerinde alr. Bu modl ise 3, 11, 17
+ * gibi tek (odd) genilikteki binlerce alan bir byte tamponuna ardk olarak paketler
+ * ve geri aar; alan bana elle ofset takibi gerekmez.
+ *
+ * Bit sras: LSB-nce (little-endian bit order). lk yazlan alan, ilk byte'n en dk
+ * bitlerinden balar; bu, get_bit_field'n LSB tabanl indekslemesiyle ayndr.
+ *
+ * Her iki snf da 64-bit bir akmlatr kullanr: Yazc, akmlatr dolduunda tek bir
+ * 8 byte'lk hizasz (unaligned) store yapar; okuyucu ise akmlatr tek bir 8 byte'lk
+ * load ile dallanmasz olarak en az 56 bite tamamlar (refill). Scak yollar satr ii
+ * (inline) olmas iin bu dosyadadr; toplu (bulk) dizi ilemleri 'bitstream.cpp' iindedir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef BITSTREAM_H
+#define BITSTREAM_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>   // std::memcpy (hizasz 64-bit eriim)
+#include "bitops.h"  // CreateMask (alan maskeleri)
+
+namespace bitstream_detail {
+
+/// 8 byte' little-endian olarak okur (hizasz). Big-endian hedeflerde byte sras evrilir.
+inline uint64_t load_le64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    v = __builtin_bswap64(v);
+#endif
+    return v;
+}
+
+/// 8 byte' little-endian olarak yazar (hizasz).
+inline void store_le64(uint8_t* p, uint64_t v) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    v = __builtin_bswap64(v);
+#endif
+    std::memcpy(p, &v, sizeof(v));
+}
+
+} // namespace bitstream_detail
+
+// =========================================================================
+// I. BT YAZICI (BIT WRITER)
+// =========================================================================
+
+/**
+ * @brief Bir byte tamponuna 1..64 bit geniliinde alanlar ardk yazar.
+ *
+ * Tampon sahiplii arandadr. Yazma tamamlandnda finish() arlmaldr;
+ * akmlatrde kalan son (ksmi) byte'lar ancak o zaman tampona aktarlr.
+ */
+class BitWriter {
+public:
+    /**
+     * @param buffer Hedef tampon.
+     * @param capacity Tampon kapasitesi (byte).
+     */
+    BitWriter(uint8_t* buffer, size_t capacity)
+        : buffer_(buffer), capacity_(capacity), byte_pos_(0), acc_(0), acc_bits_(0) {}
+
+    /**
+     * @brief Deerin en dk 'width' bitini aka ekler.
+     * @param value Yazlacak deer (st bitler yok saylr).
+     * @param width Alan genilii (0..64).
+     * @return Tamponda yer yoksa false (hibir ey yazlmaz), aksi halde true.
+     */
+    bool write(uint64_t value, int width) {
+        if (bits_written() + static_cast<uint64_t>(width) > static_cast<uint64_t>(capacity_) * 8) return false;
+        put(value, width);
+        return true;
+    }
+
+    /**
+     * @brief Ayn genilikteki bir deer dizisini yazar (toplu yol).
+     *
+     * Kapasite bir kez kontrol edilir; i dng snr kontrol yapmaz.
+     *
+     * @param values Yazlacak deerler.
+     * @param n Deer says.
+     * @param width Her deerin alan genilii (0..32 / 0..64).
+     * @return Tamponda tm dizi iin yer yoksa false (hibir ey yazlmaz).
+     */
+    bool write_array(const uint32_t* values, size_t n, int width);
+    bool write_array(const uint64_t* values, size_t n, int width);
+
+    /**
+     * @brief Ak bir sonraki byte snrna sfrlarla hizalar.
+     * @return Tamponda yer yoksa false.
+     */
+    bool align_to_byte() {
+        return write(0, static_cast<int>((8 - (acc_bits_ & 7)) & 7));
+    }
+
+    /**
+     * @brief Akmlatrde kalan bitleri tampona aktarr ve toplam byte saysn dndrr.
+     *
+     * Son byte'n kullanlmayan st bitleri sfrdr. finish() sonrasnda yazmaya
+     * devam edilmemelidir.
+     *
+     * @return Tampona yazlan toplam byte says.
+     */
+    size_t finish();
+
+    /// imdiye kadar yazlan toplam bit says.
+    uint64_t bits_written() const { return static_cast<uint64_t>(byte_pos_) * 8 + acc_bits_; }
+
+private:
+    // Snr kontrol yaplm ekirdek: Akmlatr 64 bite ulanca tek bir 8 byte'lk store.
+    void put(uint64_t value, int width) {
+        value &= CreateMask<uint64_t>(width, 0);
+        acc_ |= value << acc_bits_;      // acc_bits_ her zaman < 64 olduu iin tanml.
+        const int total = acc_bits_ + width;
+        if (total >= 64) {
+            bitstream_detail::store_le64(buffer_ + byte_pos_, acc_);
+            byte_pos_ += 8;
+            // Deerin akmlatre smayan st ksm (acc_bits_ == 0 ise kalan yoktur).
+            acc_ = (acc_bits_ == 0) ? 0 : (value >> (64 - acc_bits_));
+            acc_bits_ = total - 64;
+        } else {
+            acc_bits_ = total;
+        }
+    }
+
+    uint8_t* buffer_;
+    size_t capacity_;
+    size_t byte_pos_;   ///< Tampona aktarlm (flush) byte says.
+    uint64_t acc_;      ///< Henz aktarlmam bitler (LSB = en eski).
+    int acc_bits_;      ///< Akmlatrdeki geerli bit says (0..63).
+};
+
+
+// =========================================================================
+// II. BT OKUYUCU (BIT READER)
+// =========================================================================
+
+/**
+ * @brief BitWriter ile paketlenmi bir byte tamponundan alanlar okur.
+ *
+ * Tamponun sonunu aan okumalar sfr bitlerle tamamlanr ve overrun() true olur;
+ * bylece scak dngde okuma bana hata kontrol gerekmez, kontrol blok sonunda yaplr.
+ */
+class BitReader {
+public:
+    /**
+     * @param data Kaynak tampon.
+     * @param size Tampon boyutu (byte).
+     */
+    BitReader(const uint8_t* data, size_t size)
+        : data_(data), size_(size), byte_pos_(0), acc_(0), acc_bits_(0), overrun_(false) {}
+
+    /**
+     * @brief Sradaki 'width' biti aktan tketmeden dndrr.
+     * @param width Alan genilii (0..56).
+     * @return Alann deeri (saa hizal).
+     */
+    uint64_t peek(int width) {
+        if (acc_bits_ < width) refill();
+        return acc_ & CreateMask<uint64_t>(width, 0);
+    }
+
+    /**
+     * @brief Sradaki 'width' biti okur ve tketir.
+     * @param width Alan genilii (0..64).
+     * @return Alann deeri (saa hizal).
+     */
+    uint64_t read(int width) {
+        if (width > 56) {
+            // Tek refill en az 56 bit garanti eder; daha geni alanlar iki parada okunur.
+            const uint64_t lo = read(32);
+            return lo | (read(width - 32) << 32);
+        }
+        const uint64_t value = peek(width);
+        consume(width);
+        return value;
+    }
+
+    /**
+     * @brief Ayn genilikteki bir deer dizisini okur (toplu yol).
+     * @param out Hedef dizi.
+     * @param n Okunacak deer says.
+     * @param width Her deerin alan genilii (0..32 / 0..64).
+     */
+    void read_array(uint32_t* out, size_t n, int width);
+    void read_array(uint64_t* out, size_t n, int width);
+
+    /**
+     * @brief Akta 'nbits' bit ileri atlar (keyfi uzunluk).
+     * @param nbits Atlanacak bit says.
+     */
+    void skip(uint64_t nbits);
+
+    /// Bir sonraki byte snrna atlar (BitWriter::align_to_byte karl).
+    void align_to_byte() {
+        skip((8 - (bits_consumed() & 7)) & 7);
+    }
+
+    /// imdiye kadar tketilen toplam bit says.
+    uint64_t bits_consumed() const { return static_cast<uint64_t>(byte_pos_) * 8 - acc_bits_; }
+
+    /// Tamponda kalan bit says (am varsa 0).
+    uint64_t bits_remaining() const {
+        const uint64_t total = static_cast<uint64_t>(size_) * 8;
+        return (bits_consumed() >= total) ? 0 : total - bits_consumed();
+    }
+
+    /// Tamponun sonunun tesinde okuma yapld m?
+    bool overrun() const { return overrun_; }
+
+private:
+    /**
+     * MHENDSLK NOTU (Dallanmasz refill): 8 byte tek seferde okunur ve mevcut bitlerin
+     * stne OR'lanr; ancak yalnzca tam byte'lar saylr ((63 - acc_bits_) / 8 byte).
+     * Saylmayan st bitler zaten bir sonraki byte'larn doru bitleridir; bir sonraki
+     * refill ayn bitleri ayn konuma yeniden OR'lar, bu yzden sonu deimez.
+     */
+    void refill() {
+        if (byte_pos_ + 8 <= size_) {
+            acc_ |= bitstream_detail::load_le64(data_ + byte_pos_) << acc_bits_;
+            const int bytes = (63 - acc_bits_) >> 3;
+            byte_pos_ += bytes;
+            acc_bits_ += bytes * 8;      // Sonu: 56..63 geerli bit.
+        } else {
+            refill_tail();
+        }
+    }
+
+    void refill_tail();
+
+    template<typename T>
+    void read_array_narrow(T* out, size_t n, int width);
+
+    void consume(int width) {
+        if (width > acc_bits_) {
+            // Sadece tampon sonunda olur: Eksik bitler sfr kabul edilir.
+            overrun_ = true;
+            acc_ = 0;
+            acc_bits_ = 0;
+            return;
+        }
+        acc_ = (width == 64) ? 0 : (acc_ >> width);
+        acc_bits_ -= width;
+    }
+
+    const uint8_t* data_;
+    size_t size_;
+    size_t byte_pos_;   ///< Akmlatre alnm (saylm) byte says.
+    uint64_t acc_;      ///< Okunmam bitler (LSB = sradaki bit).
+    int acc_bits_;      ///< Akmlatrdeki geerli bit says (0..63).
+    bool overrun_;
+};
+
+#endif // BITSTREAM_H
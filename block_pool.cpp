@@ -0,0 +1,197 @@
+/**
+ * @file block_pool.cpp
+ * @brief Bitmap ndeksli Havuz: Doluluk Kelimesi zerinde CAS ile Ayrma, Toplu lemler ve nbellek.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "block_pool.h"
+#include "atomic_bitops.h" // atomic_claim_first_clear_bit, AtomicClearRegBit
+#include "bitops.h"     // ClearRegBit, CreateMask, find_first_set_bit, count_set_bits, is_power_of_two
+#include <new>          // std::align_val_t, std::nothrow
+
+namespace {
+
+const size_t kWordBits = 64;
+const uint64_t kFull = ~static_cast<uint64_t>(0);
+
+// free'nin en dk k '1' biti (k < popcount(free)).
+uint64_t lowest_bits(uint64_t free, size_t k) {
+	uint64_t rest = free;
+	for (size_t j = 0; j < k; j++) rest &= rest - 1;
+	return free ^ rest;
+}
+
+} // namespace
+
+
+// =========================================================================
+// I. YAAM DNGS
+// =========================================================================
+
+BlockPool::BlockPool()
+    : base_(nullptr), block_size_(0), stride_(0), stride_shift_(-1), alignment_(0),
+      capacity_(0), word_count_(0), words_(nullptr), hint_(0), epoch_(0) {}
+
+BlockPool::~BlockPool() {
+	release();
+}
+
+bool BlockPool::init(size_t block_size, size_t capacity, size_t alignment) {
+	release();
+	if (block_size == 0 || capacity == 0 || !is_power_of_two(static_cast<uint64_t>(alignment))) return false;
+	const size_t stride = (block_size + alignment - 1) & ~(alignment - 1);
+	if (capacity > static_cast<size_t>(-1) / stride) return false;
+
+	base_ = static_cast<uint8_t*>(::operator new(capacity * stride, std::align_val_t(alignment), std::nothrow));
+	alignment_ = alignment;     // release() blgeyi ayn hizalamayla brakr.
+	word_count_ = (capacity + kWordBits - 1) / kWordBits;
+	words_ = new (std::nothrow) std::atomic<uint64_t>[word_count_];
+	if (base_ == nullptr || words_ == nullptr) {
+		release();
+		return false;
+	}
+	block_size_ = block_size;
+	stride_ = stride;
+	stride_shift_ = is_power_of_two(static_cast<uint64_t>(stride)) ? find_first_set_bit(static_cast<uint64_t>(stride)) : -1;
+	capacity_ = capacity;
+	fill_words();
+	return true;
+}
+
+void BlockPool::release() {
+	if (base_ != nullptr) ::operator delete(base_, std::align_val_t(alignment_));
+	delete[] words_;
+	base_ = nullptr;
+	words_ = nullptr;
+	block_size_ = stride_ = alignment_ = capacity_ = word_count_ = 0;
+	stride_shift_ = -1;
+	// Eski blgeyi gsteren nbellek iaretileri bir sonraki ilemde atlr (init de buradan geer).
+	epoch_.fetch_add(1, std::memory_order_release);
+}
+
+void BlockPool::fill_words() {
+	for (size_t w = 0; w < word_count_; w++) words_[w].store(0, std::memory_order_relaxed);
+	// Kapasite tesindeki yuvalar kalc olarak 'dolu'dur.
+	const int tail = static_cast<int>(capacity_ % kWordBits);
+	if (tail != 0) words_[word_count_ - 1].store(~CreateMask<uint64_t>(tail, 0), std::memory_order_relaxed);
+	hint_.store(0, std::memory_order_relaxed);
+}
+
+void BlockPool::reset() {
+	fill_words();
+	epoch_.fetch_add(1, std::memory_order_release);
+}
+
+
+// =========================================================================
+// II. AYIRMA VE BIRAKMA
+// =========================================================================
+
+void* BlockPool::allocate() {
+	const size_t start = hint_.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < word_count_; i++) {
+		size_t w = start + i;
+		if (w >= word_count_) w -= word_count_;
+		const int bit = atomic_claim_first_clear_bit(words_[w], std::memory_order_acquire);
+		if (bit >= 0) {
+			if (w != start) hint_.store(w, std::memory_order_relaxed);
+			return block_at(w * kWordBits + static_cast<size_t>(bit));
+		}
+	}
+	return nullptr;
+}
+
+void BlockPool::deallocate(void* p) {
+	const size_t index = index_of(p);
+	const size_t w = index / kWordBits;
+	AtomicClearRegBit(words_[w], static_cast<int>(index % kWordBits), std::memory_order_release);
+	if (w < hint_.load(std::memory_order_relaxed)) hint_.store(w, std::memory_order_relaxed);
+}
+
+size_t BlockPool::allocate_bulk(void** out, size_t n) {
+	size_t got = 0;
+	const size_t start = hint_.load(std::memory_order_relaxed);
+	for (size_t i = 0; i < word_count_ && got < n; i++) {
+		size_t w = start + i;
+		if (w >= word_count_) w -= word_count_;
+		uint64_t cur = words_[w].load(std::memory_order_relaxed);
+		uint64_t take = 0;
+		while (cur != kFull) {
+			// Gerekenden fazla bo yuva varsa yalnzca en dk olanlar alnr.
+			const uint64_t free = ~cur;
+			const size_t want = n - got;
+			take = (static_cast<size_t>(count_set_bits(free)) <= want) ? free : lowest_bits(free, want);
+			if (words_[w].compare_exchange_weak(cur, cur | take, std::memory_order_acquire, std::memory_order_relaxed)) break;
+			take = 0;
+		}
+		if (take == 0) continue;
+		const size_t base_index = w * kWordBits;
+		while (take != 0) {
+			out[got++] = block_at(base_index + static_cast<size_t>(find_first_set_bit(take)));
+			take &= take - 1;
+		}
+		hint_.store(w, std::memory_order_relaxed);
+	}
+	return got;
+}
+
+void BlockPool::deallocate_bulk(void* const* ptrs, size_t n) {
+	size_t i = 0;
+	while (i < n) {
+		const size_t w = index_of(ptrs[i]) / kWordBits;
+		uint64_t mask = kFull;
+		for (; i < n; i++) {
+			const size_t index = index_of(ptrs[i]);
+			if (index / kWordBits != w) break;
+			mask = ClearRegBit(mask, static_cast<int>(index % kWordBits));
+		}
+		words_[w].fetch_and(mask, std::memory_order_release);
+		if (w < hint_.load(std::memory_order_relaxed)) hint_.store(w, std::memory_order_relaxed);
+	}
+}
+
+bool BlockPool::owns(const void* p) const {
+	const uint8_t* b = static_cast<const uint8_t*>(p);
+	if (base_ == nullptr || b < base_ || b >= base_ + capacity_ * stride_) return false;
+	return static_cast<size_t>(b - base_) % stride_ == 0;
+}
+
+size_t BlockPool::in_use() const {
+	size_t used = 0;
+	for (size_t w = 0; w < word_count_; w++) {
+		used += static_cast<size_t>(count_set_bits(words_[w].load(std::memory_order_relaxed)));
+	}
+	return used - (word_count_ * kWordBits - capacity_);    // Kalc dolu kuyruk bitleri hari.
+}
+
+
+// =========================================================================
+// III.  PARACII NBELLE
+// =========================================================================
+
+size_t BlockPool::Cache::refill() {
+	count_ = pool_.allocate_bulk(slots_, kCapacity / 2);
+	return count_;
+}
+
+void BlockPool::Cache::spill() {
+	if (pool_.capacity_ == 0) {     // Havuz brakld: aretilerin iade edilecei blge yok.
+		count_ = 0;
+		return;
+	}
+	// En eski (ynn dibindeki, souk) yar iade edilir; scak yar nbellekte kalr.
+	const size_t half = kCapacity / 2;
+	pool_.deallocate_bulk(slots_, half);
+	for (size_t i = half; i < count_; i++) slots_[i - half] = slots_[i];
+	count_ -= half;
+}
+
+void BlockPool::Cache::flush() {
+	sync_epoch();
+	if (pool_.capacity_ != 0) pool_.deallocate_bulk(slots_, count_);
+	count_ = 0;
+}
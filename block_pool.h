@@ -0,0 +1,187 @@
+/**
+ * @file block_pool.h
+ * @brief Bitmap ndeksli Sabit Bloklu Havuz (Pool/Arena) Ayrc.
+ *
+ * Tampon hattnn saniyede milyonlarca ayrp brakt sabit boyutlu ereve (frame)
+ * nesneleri iin malloc yerine kullanlr. Havuz, init() ile bir kez ayrlan tek bir
+ * bellek blgesini eit bloklara bler; bo/dolu durumu blok bana bir bit olan uint64_t
+ * doluluk (occupancy) kelimelerinde tutulur:
+ * - Ayrma: Kelimenin tersinde (~word) find_first_set_bit ile ilk bo yuva bulunur ve
+ *   SetRegBit ile CAS zerinden sahiplenilir.
+ * - Brakma: Tek bir atomik ClearRegBit (fetch_and).
+ * - Toplu ayrma/brakma: Bir kelimedeki yuvalar tek CAS / fetch_and ile ilenir.
+ * -  parac nbellei (BlockPool::Cache): Paylalan kelimelere yalnzca toplu
+ *   dolum/boaltmada dokunur; scak yolda atomik okuma-deitirme-yazma (CAS) yoktur.
+ * - Arena sfrlama (reset): Tm bloklar tek geite boaltlr (ereve/istek sonu).
+ *
+ * Blok adresleri sabittir ve havuz bymez; dolu havuzda allocate() nullptr dner (aran
+ * malloc'a debilir). Paralanma (fragmentation) olumaz: Her yuva ayn boyuttadr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef BLOCK_POOL_H
+#define BLOCK_POOL_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Sabit boyutlu bloklardan oluan, i parac gvenli havuz.
+ *
+ * MHENDSLK NOTU (Doluluk kelimeleri): Bit '1' = blok kullanmda. Kapasite 64'n kat
+ * deilse son kelimenin kapasite tesindeki bitleri kalc olarak '1' tutulur; bylece
+ * arama dngs kuyruk kontrol yapmaz (DynamicBitset'in sfr kuyruk deimezinin tersi).
+ * Arama, son baarl kelimeden (ipucu) balar ve sarar; dolu kelimeler tek karlatrmayla
+ * geilir. Brakma release, ayrma acquire sraldr: Blou brakan i paracnn
+ * yazmalar, blou sonra alan i paracna grnr.
+ *
+ * allocate / deallocate / *_bulk ayn anda farkl i paracklarndan arlabilir;
+ * init ve reset arlrken havuz baka bir i paracnda kullanlmamaldr. init ve reset
+ * dnem sayacn artrr: Yaayan nbellekler sfrlanan veya braklan blgeye ait
+ * iaretilerini havuza iade etmeden atar.
+ */
+class BlockPool {
+public:
+    BlockPool();
+    ~BlockPool();
+
+    BlockPool(const BlockPool&) = delete;
+    BlockPool& operator=(const BlockPool&) = delete;
+
+    /**
+     * @brief Havuz blgesini ayrr. nceki blge varsa braklr.
+     * @param block_size Blok boyutu (byte, > 0). Adm (stride), hizalamann katna yuvarlanr.
+     * @param capacity Blok says (> 0).
+     * @param alignment Blok hizalamas (2'nin kuvveti; rn. nbellek satr iin 64).
+     * @return Bellek ayrlamadysa veya parametreler geersizse false.
+     */
+    bool init(size_t block_size, size_t capacity, size_t alignment = alignof(std::max_align_t));
+
+    bool is_initialized() const { return base_ != nullptr; }
+
+    /// Bir blok ayrr; havuz doluysa nullptr.
+    void* allocate();
+
+    /// Blou havuza iade eder. p, bu havuzun allocate'inden gelmeli ve bir kez braklmaldr.
+    void deallocate(void* p);
+
+    /**
+     * @brief En fazla n blok ayrr (kelime bana tek CAS).
+     * @param out En az n iaretilik hedef.
+     * @param n stenen blok says.
+     * @return Ayrlan blok says (havuz dolarsa n'den az).
+     */
+    size_t allocate_bulk(void** out, size_t n);
+
+    /**
+     * @brief n blou iade eder. Ayn doluluk kelimesine den ardk iaretiler tek
+     * fetch_and ile braklr (allocate_bulk kts bu sradadr).
+     */
+    void deallocate_bulk(void* const* ptrs, size_t n);
+
+    /**
+     * @brief Arena sfrlama: Tm bloklar tek geite bo iaretler.
+     *
+     * nceden ayrlm tm iaretiler geersiz olur ve braklmamaldr. nbellekler
+     * (Cache) bir sonraki ilemlerinde sfrlamay dnem (epoch) sayacndan fark eder ve
+     * ieriklerini atar.
+     */
+    void reset();
+
+    /// p bu havuzun bir blounun balangc m?
+    bool owns(const void* p) const;
+
+    size_t block_size() const { return block_size_; }
+    size_t stride() const { return stride_; }
+    size_t capacity() const { return capacity_; }
+    /// Kullanmdaki blok says (ezamanl kullanmda anlk bir grntdr).
+    size_t in_use() const;
+
+    /**
+     * @brief  paracna zel blok nbellei (her i parac kendi nesnesini tutar).
+     *
+     * MHENDSLK NOTU (Yerel yn): nbellek, bo blok iaretilerinden oluan kk bir
+     * LIFO yndr. allocate/deallocate yalnzca yn deitirir ve havuzun dnem sayacn
+     * okur (CAS yok, paylalan satra yazma yok); en son braklan (nbellekte scak) blok
+     * ilk geri verilir. Yn boalnca havuzdan kCapacity / 2 blok toplu alnr, dolunca yars
+     * toplu iade edilir; bylece ayrma/brakma arasnda gidip gelen bir i parac
+     * havuza srekli dokunmaz. Farkl nbellekten ayrlm bir blok da braklabilir.
+     */
+    class Cache {
+    public:
+        static constexpr size_t kCapacity = 128;
+
+        explicit Cache(BlockPool& pool) : pool_(pool), count_(0), epoch_(pool.epoch()) {}
+        /// nbellekteki bloklar havuza iade eder (havuz yeniden kurulduysa atar).
+        ~Cache() { flush(); }
+
+        Cache(const Cache&) = delete;
+        Cache& operator=(const Cache&) = delete;
+
+        /// Bir blok ayrr; havuz doluysa nullptr.
+        void* allocate() {
+            sync_epoch();
+            if (count_ == 0 && refill() == 0) return nullptr;
+            return slots_[--count_];
+        }
+
+        void deallocate(void* p) {
+            sync_epoch();
+            if (count_ == kCapacity) spill();
+            slots_[count_++] = p;
+        }
+
+        /// Tm nbellei havuza iade eder; havuzda blok yoksa yalnzca boaltr.
+        void flush();
+
+        size_t cached() const { return count_; }
+
+    private:
+        // Havuz sfrlandysa veya yeniden kurulduysa nbellekteki iaretiler artk bo yuvalardr; atlrlar.
+        void sync_epoch() {
+            const uint64_t e = pool_.epoch();
+            if (e != epoch_) {
+                epoch_ = e;
+                count_ = 0;
+            }
+        }
+
+        size_t refill();
+        void spill();
+
+        BlockPool& pool_;
+        size_t count_;
+        uint64_t epoch_;
+        void* slots_[kCapacity];
+    };
+
+private:
+    uint64_t epoch() const { return epoch_.load(std::memory_order_acquire); }
+
+    uint8_t* block_at(size_t index) const { return base_ + index * stride_; }
+    size_t index_of(const void* p) const {
+        const size_t offset = static_cast<size_t>(static_cast<const uint8_t*>(p) - base_);
+        return (stride_shift_ >= 0) ? (offset >> stride_shift_) : (offset / stride_);
+    }
+
+    void release();
+    void fill_words();
+
+    uint8_t* base_;
+    size_t block_size_;
+    size_t stride_;
+    int stride_shift_;          ///< stride 2'nin kuvvetiyse log2(stride), deilse -1 (blme yerine kaydrma).
+    size_t alignment_;
+    size_t capacity_;
+    size_t word_count_;
+    std::atomic<uint64_t>* words_;
+    std::atomic<size_t> hint_;  ///< Son baarl aramann kelimesi (yalnzca ipucu).
+    std::atomic<uint64_t> epoch_;
+};
+
+#endif // BLOCK_POOL_H
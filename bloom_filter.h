@@ -0,0 +1,174 @@
+/**
+ * @file bloom_filter.h
+ * @brief nbellek Satr Bloklu (Split-Block) Bloom Filtresi: Sorgu Bana Tek nbellek Iskas.
+ *
+ * Klasik Bloom filtresi k biti tm tabloya datr; byk bir tabloda her sorgu k ayr
+ * nbellek skas (cache miss) demektir. Bu filtrede her anahtar 64 byte'lk (bir nbellek
+ * satr) tek bir bloa elenir ve k = 8 bitin tamam o blokta tutulur: Blok 8 kelimedir
+ * ve her kelimeye tam bir bit der (split block). Bylece:
+ * - Sorgu bana tek nbellek satr okunur.
+ * - 8 bitlik maske tek SIMD ilemiyle retilir ve test edilir (AVX-512: bir 512-bit
+ *   karlatrma, AVX2: iki 256-bit VPTEST).
+ * - Toplu (batch) API'ler sonraki anahtarlarn bloklarn nceden getirir (prefetch);
+ *   bellek eriimleri ardk dzende (pipelined) rtr.
+ *
+ * Anahtarlar nceden kartrlm 64-bit deerlerdir: st 32 bit blou, alt 32 bit blok
+ * iindeki bitleri seer. Tamsay kimlikler iin bloom_hash() kullanlabilir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef BLOOM_FILTER_H
+#define BLOOM_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "bitops.h" // CreateMask
+
+class DynamicBitset;    // dynamic_bitset.h
+
+namespace bloom_filter_detail {
+
+/// Blok kelimesi j'deki bit konumu (h * kSalts[j]) >> 26 ile seilir (tek say arpanlar).
+constexpr uint32_t kSalts[8] = {
+    0x47b6137bu, 0x44974d91u, 0x8824ad5bu, 0xa2b7289du,
+    0x705495c7u, 0x2df1424bu, 0x9efc4947u, 0x5c6bfb31u
+};
+
+} // namespace bloom_filter_detail
+
+/**
+ * @brief 64-bit kimlii filtre iin kartrr (MurmurHash3 fmix64 sonlandrcs).
+ *
+ * Ardk kimlikler bile tm 64 bite yaylr; filtre hem st hem alt yary kullanr.
+ */
+inline uint64_t bloom_hash(uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ull;
+    key ^= key >> 33;
+    return key;
+}
+
+/**
+ * @brief Bloklu Bloom filtresi (ekleme tek i parackl; ezamanl salt okuma gvenli).
+ *
+ * Yanl negatif yoktur: insert(h) sonras contains(h) daima true dner. Yanl pozitif
+ * oran init() srasnda istenen hedefe gre blok says seilerek ayarlanr. Ekleme ve
+ * sorgular baarl bir init() sonrasnda arlmaldr (snr kontrol yaplmaz).
+ *
+ * MHENDSLK NOTU (Blok seimi ve maske): Blok indeksi ((h >> 32) * blok_says) >> 32
+ * arpmyla bulunur (fastrange); modulo blmesi gerekmez ve blok says ikinin kuvveti
+ * olmak zorunda deildir. Blok iinde kelime j'nin biti, alt 32 bitin tek say bir tuzla
+ * (salt) arpmnn st 6 bitidir; maske CreateMask<uint64_t>(1, konum) ile kurulur. Sekiz
+ * arpm tek bir VPMULLD, sekiz maske tek bir VPSLLVQ ile retilir.
+ *
+ * MHENDSLK NOTU (Yanl pozitif): Bloklu filtrede anahtarlar bloklara eit dalmaz
+ * (Poisson); dolu bloklar oran klasik filtreye gre biraz artrr. false_positive_rate(),
+ * blok doluluunun Poisson dalm zerinden beklenen oran hesaplar; init() bu tahmini
+ * hedefin altnda tutan en kk blok saysn seer (tipik olarak %1 iin ~10 bit/anahtar).
+ */
+class BlockedBloomFilter {
+public:
+    /// Blok bana kelime (= anahtar bana bit says k).
+    static constexpr int kBlockWords = 8;
+    static constexpr size_t kBlockBytes = kBlockWords * sizeof(uint64_t);
+
+    BlockedBloomFilter();
+    ~BlockedBloomFilter();
+
+    BlockedBloomFilter(const BlockedBloomFilter&) = delete;
+    BlockedBloomFilter& operator=(const BlockedBloomFilter&) = delete;
+
+    /**
+     * @brief Filtreyi bo olarak (yeniden) kurar.
+     * @param expected_keys Eklenmesi beklenen anahtar says.
+     * @param false_positive_rate Hedef yanl pozitif oran (0, 1).
+     * @return Parametreler geersizse veya bellek ayrlamazsa false.
+     */
+    bool init(size_t expected_keys, double false_positive_rate);
+
+    /// Bellei brakr; init() ncesi duruma dner.
+    void release();
+
+    /// Tm bitleri '0' yapar (boyut korunur).
+    void clear();
+
+    /**
+     * @brief Hedef oran iin gereken en kk blok says (en fazla 2^32 - 1).
+     * @return Hedefe ulalamyorsa 0.
+     */
+    static size_t blocks_for(size_t expected_keys, double false_positive_rate);
+
+    /// 'keys' anahtar eklenmi 'blocks' bloklu bir filtrenin beklenen yanl pozitif oran.
+    static double false_positive_rate(size_t keys, size_t blocks);
+
+    size_t block_count() const { return blocks_; }
+    size_t size_bytes() const { return blocks_ * kBlockBytes; }
+    /// Ham kelimeler (64 byte hizal; blok b, data()[8 * b, 8 * b + 8)).
+    const uint64_t* data() const { return words_; }
+
+    void insert(uint64_t hash) {
+        uint64_t* block = block_at(hash);
+        const uint32_t h = static_cast<uint32_t>(hash);
+        for (int j = 0; j < kBlockWords; j++) block[j] |= bit_mask(h, j);
+    }
+
+    /// Olas yelik: false ise anahtar kesinlikle eklenmemitir.
+    bool contains(uint64_t hash) const {
+        const uint64_t* block = block_at(hash);
+        const uint32_t h = static_cast<uint32_t>(hash);
+        uint64_t missing = 0;
+        for (int j = 0; j < kBlockWords; j++) missing |= ~block[j] & bit_mask(h, j);
+        return missing == 0;
+    }
+
+    /**
+     * @brief Bir anahtar dizisini ekler (toplu yol: SIMD maske + nceden getirme).
+     * @param hashes Kartrlm anahtarlar.
+     * @param n Anahtar says.
+     */
+    void insert_batch(const uint64_t* hashes, size_t n);
+
+    /**
+     * @brief Bir anahtar dizisini sorgular: out'un i. biti = contains(hashes[i]).
+     *
+     * Sonu maskesi predicate_filter.h ile ayn biimdedir; dier yklem maskeleriyle
+     * birletirilebilir veya predicate_compact / predicate_select_indices ile kullanlabilir.
+     *
+     * @param hashes Kartrlm anahtarlar.
+     * @param n Anahtar says.
+     * @param out Sonu maskesi; n bite yeniden boyutlandrlr.
+     */
+    void contains_batch(const uint64_t* hashes, size_t n, DynamicBitset& out) const;
+
+    /**
+     * @brief Ayn boyutlu bir filtrenin anahtarlarn ekler (kelime bazl OR).
+     *
+     *  parac bana ayr filtreler kurulup sonra birletirilebilir.
+     *
+     * @return Blok saylar farklysa false (filtre deimez).
+     */
+    bool merge(const BlockedBloomFilter& other);
+
+private:
+    static uint64_t bit_mask(uint32_t h, int j) {
+        return CreateMask<uint64_t>(1, static_cast<int>((h * bloom_filter_detail::kSalts[j]) >> 26));
+    }
+
+    uint64_t* block_at(uint64_t hash) const {
+        return words_ + kBlockWords * (((hash >> 32) * blocks_) >> 32);
+    }
+
+    uint64_t* words_;
+    size_t blocks_;
+};
+
+/// Seilen toplu ekirdein ad ("avx512", "avx2" veya "scalar").
+const char* bloom_kernel_name();
+
+#endif // BLOOM_FILTER_H
@@ -0,0 +1,885 @@
+/**
+ * @file compressed_bitmap.cpp
+ * @brief Sktrlm Bitmap: Kap Dnmleri, Trler Aras Kme lemleri ve Tanabilir Biim.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "compressed_bitmap.h"
+#include "bitstream.h"  // bitstream_detail::load_le64 / store_le64 (hizasz little-endian)
+#include <algorithm>    // std::lower_bound, std::copy, std::min
+#include <cstring>      // std::memcpy, std::memset, std::memcmp
+#include <utility>      // std::move, std::swap
+
+namespace {
+
+using compressed_bitmap_detail::Container;
+using Kind = compressed_bitmap_detail::ContainerKind;
+
+const size_t kWords = CompressedBitmap::kBitsetWords;
+const uint32_t kChunkValues = 65536;
+const uint32_t kCookieNoRun = 12346;
+const uint32_t kCookieRun = 12347;
+const size_t kNoOffsetThreshold = 4;
+const size_t kBitsetBytes = kWords * sizeof(uint64_t);
+const size_t kNotFound = static_cast<size_t>(-1);
+
+enum class SetOp { And, Or, Xor, AndNot };
+
+/**
+ * MHENDSLK NOTU (Dallanmasz ikili arama): Rastgele sorgularda std::lower_bound'un her
+ * adm yar yarya yanl tahmin edilen bir dallanmadr (256 anahtarda ~8 yanl tahmin).
+ * Burada aralk her admda yarya iner ve taban koullu atama (CMOV) ile ilerler; adm
+ * says yalnzca n'ye baldr.
+ *
+ * @return pred(i)'nin true olduu n ekin uzunluu (pred nce true, sonra false olmaldr).
+ */
+template<typename Pred>
+size_t partition_point(size_t n, Pred pred) {
+	if (n == 0) return 0;
+	size_t base = 0;
+	while (n > 1) {
+		const size_t half = n / 2;
+		base = pred(base + half) ? base + half : base;
+		n -= half;
+	}
+	return base + (pred(base) ? 1 : 0);
+}
+
+// --- Hizasz little-endian eriim (bitstream.h'deki 64-bit yardmclarla ayn kalp) ---
+
+uint16_t load_le16(const uint8_t* p) {
+	uint16_t v;
+	std::memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap16(v);
+#endif
+	return v;
+}
+
+uint32_t load_le32(const uint8_t* p) {
+	uint32_t v;
+	std::memcpy(&v, p, sizeof(v));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap32(v);
+#endif
+	return v;
+}
+
+void store_le16(uint8_t* p, uint16_t v) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap16(v);
+#endif
+	std::memcpy(p, &v, sizeof(v));
+}
+
+void store_le32(uint8_t* p, uint32_t v) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+	v = __builtin_bswap32(v);
+#endif
+	std::memcpy(p, &v, sizeof(v));
+}
+
+// --- Kelime yardmclar ---
+
+// [begin, end) bitlerini '1' yapar (0 <= begin < end <= 65536).
+void set_range(uint64_t* words, uint32_t begin, uint32_t end) {
+	const uint32_t first = begin / 64;
+	const uint32_t last = (end - 1) / 64;
+	const int head = static_cast<int>(begin % 64);
+	const int tail = static_cast<int>((end - 1) % 64) + 1;
+	if (first == last) {
+		words[first] |= CreateMask<uint64_t>(tail - head, head);
+		return;
+	}
+	words[first] |= CreateMask<uint64_t>(64 - head, head);
+	for (uint32_t w = first + 1; w < last; w++) words[w] = ~static_cast<uint64_t>(0);
+	words[last] |= CreateMask<uint64_t>(tail, 0);
+}
+
+// pos ve sonrasnda deeri 'value' olan ilk bit; yoksa 65536.
+uint32_t next_bit(const uint64_t* words, uint32_t pos, bool value) {
+	if (pos >= kChunkValues) return kChunkValues;
+	size_t w = pos / 64;
+	const uint64_t flip = value ? 0 : ~static_cast<uint64_t>(0);
+	uint64_t word = (words[w] ^ flip) & ReverseMask<uint64_t>(static_cast<int>(pos % 64), 0);
+	while (word == 0) {
+		if (++w == kWords) return kChunkValues;
+		word = words[w] ^ flip;
+	}
+	return static_cast<uint32_t>(w * 64 + static_cast<size_t>(find_first_set_bit(word)));
+}
+
+// Kou says: Her kou, nceki biti '0' olan bir '1' bitle balar. Kelime snrnda
+// nceki bit, bir nceki kelimenin en st bitidir (tama).
+uint32_t count_runs(const uint64_t* words) {
+	uint32_t runs = 0;
+	uint64_t carry = 0;
+	for (size_t w = 0; w < kWords; w++) {
+		const uint64_t word = words[w];
+		runs += static_cast<uint32_t>(count_set_bits(static_cast<uint64_t>(word & ~((word << 1) | carry))));
+		carry = word >> 63;
+	}
+	return runs;
+}
+
+uint32_t count_runs(const std::vector<uint16_t>& array) {
+	uint32_t runs = array.empty() ? 0 : 1;
+	for (size_t i = 1; i < array.size(); i++) runs += (array[i] != array[i - 1] + 1) ? 1 : 0;
+	return runs;
+}
+
+// --- Gsterim dnmleri ---
+
+void to_words(const Container& c, uint64_t* words) {
+	if (c.kind == Kind::Bitset) {
+		std::copy(c.words.begin(), c.words.end(), words);
+		return;
+	}
+	std::memset(words, 0, kBitsetBytes);
+	if (c.kind == Kind::Array) {
+		for (uint16_t v : c.values) words[v / 64] = SetRegBit(words[v / 64], v % 64);
+	} else {
+		for (size_t r = 0; r < c.values.size(); r += 2) {
+			set_range(words, c.values[r], static_cast<uint32_t>(c.values[r]) + c.values[r + 1] + 1);
+		}
+	}
+}
+
+void array_from_words(const uint64_t* words, uint32_t cardinality, std::vector<uint16_t>& out) {
+	out.clear();
+	out.reserve(cardinality);
+	for (size_t w = 0; w < kWords; w++) {
+		uint64_t word = words[w];
+		while (word != 0) {
+			out.push_back(static_cast<uint16_t>(w * 64 + static_cast<size_t>(find_first_set_bit(word))));
+			word &= word - 1;
+		}
+	}
+}
+
+void runs_from_words(const uint64_t* words, uint32_t runs, std::vector<uint16_t>& out) {
+	out.clear();
+	out.reserve(2 * static_cast<size_t>(runs));
+	uint32_t pos = 0;
+	for (;;) {
+		const uint32_t start = next_bit(words, pos, true);
+		if (start == kChunkValues) break;
+		const uint32_t end = next_bit(words, start, false);
+		out.push_back(static_cast<uint16_t>(start));
+		out.push_back(static_cast<uint16_t>(end - start - 1));
+		pos = end;
+	}
+}
+
+void runs_from_array(const std::vector<uint16_t>& array, std::vector<uint16_t>& out) {
+	out.clear();
+	for (size_t i = 0; i < array.size();) {
+		size_t j = i + 1;
+		while (j < array.size() && array[j] == array[j - 1] + 1) j++;
+		out.push_back(array[i]);
+		out.push_back(static_cast<uint16_t>(j - i - 1));
+		i = j;
+	}
+}
+
+void array_from_runs(const std::vector<uint16_t>& runs, uint32_t cardinality, std::vector<uint16_t>& out) {
+	out.clear();
+	out.reserve(cardinality);
+	for (size_t r = 0; r < runs.size(); r += 2) {
+		const uint32_t last = static_cast<uint32_t>(runs[r]) + runs[r + 1];
+		for (uint32_t v = runs[r]; v <= last; v++) out.push_back(static_cast<uint16_t>(v));
+	}
+}
+
+void make_bitset(Container& c) {
+	std::vector<uint64_t> words(kWords);
+	to_words(c, words.data());
+	c.words.swap(words);
+	c.values.clear();
+	c.values.shrink_to_fit();
+	c.kind = Kind::Bitset;
+}
+
+void make_array(Container& c) {
+	std::vector<uint16_t> array;
+	if (c.kind == Kind::Bitset) {
+		array_from_words(c.words.data(), c.cardinality, array);
+	} else if (c.kind == Kind::Run) {
+		array_from_runs(c.values, c.cardinality, array);
+	} else {
+		return;
+	}
+	c.values.swap(array);
+	c.words.clear();
+	c.words.shrink_to_fit();
+	c.kind = Kind::Array;
+}
+
+size_t run_count(const Container& c) {
+	if (c.kind == Kind::Run) return c.values.size() / 2;
+	if (c.kind == Kind::Array) return count_runs(c.values);
+	return count_runs(c.words.data());
+}
+
+// Kab seri boyutu en kk gsterime evirir (dizi 2 * kard., bit kmesi 8192, kou 2 + 4 * kou).
+void optimize_container(Container& c) {
+	const size_t runs = run_count(c);
+	const size_t run_bytes = 2 + 4 * runs;
+	const size_t plain_bytes = (c.cardinality <= CompressedBitmap::kArrayMax) ? 2 * static_cast<size_t>(c.cardinality) : kBitsetBytes;
+	if (run_bytes < plain_bytes) {
+		if (c.kind == Kind::Run) return;
+		std::vector<uint16_t> pairs;
+		if (c.kind == Kind::Array) {
+			runs_from_array(c.values, pairs);
+		} else {
+			runs_from_words(c.words.data(), static_cast<uint32_t>(runs), pairs);
+		}
+		c.values.swap(pairs);
+		c.words.clear();
+		c.words.shrink_to_fit();
+		c.kind = Kind::Run;
+	} else if (c.cardinality <= CompressedBitmap::kArrayMax) {
+		make_array(c);
+	} else if (c.kind != Kind::Bitset) {
+		make_bitset(c);
+	}
+}
+
+// --- Tek kap yelik / ekleme / karma ---
+
+bool container_contains(const Container& c, uint16_t low) {
+	if (c.kind == Kind::Bitset) return isBitSet(c.words[low / 64], low % 64);
+	const uint16_t* v = c.values.data();
+	if (c.kind == Kind::Array) {
+		const size_t i = partition_point(c.values.size(), [v, low](size_t k) { return v[k] < low; });
+		return i < c.values.size() && v[i] == low;
+	}
+	// Kou: Balangc low'dan byk olmayan son kou (iftlerin ift indeksleri balangtr).
+	const size_t lo = partition_point(c.values.size() / 2, [v, low](size_t k) { return v[2 * k] <= low; });
+	return lo != 0 && low <= static_cast<uint32_t>(c.values[2 * (lo - 1)]) + c.values[2 * (lo - 1) + 1];
+}
+
+// Kou kabnda low'u ieren veya low'dan nce balayan son kounun indeksi; yoksa kNotFound.
+size_t run_before(const std::vector<uint16_t>& runs, uint16_t low) {
+	size_t lo = 0;
+	size_t hi = runs.size() / 2;
+	while (lo < hi) {
+		const size_t mid = (lo + hi) / 2;
+		if (runs[2 * mid] <= low) lo = mid + 1; else hi = mid;
+	}
+	return (lo == 0) ? kNotFound : lo - 1;
+}
+
+bool run_add(std::vector<uint16_t>& runs, uint16_t low) {
+	const size_t i = run_before(runs, low);
+	const size_t n = runs.size() / 2;
+	if (i != kNotFound) {
+		const uint32_t last = static_cast<uint32_t>(runs[2 * i]) + runs[2 * i + 1];
+		if (low <= last) return false;
+		if (low == last + 1) {
+			runs[2 * i + 1]++;
+			// Sonraki kouya dediyse ikisi birletirilir.
+			if (i + 1 < n && runs[2 * (i + 1)] == low + 1) {
+				runs[2 * i + 1] = static_cast<uint16_t>(runs[2 * i + 1] + runs[2 * (i + 1) + 1] + 1);
+				runs.erase(runs.begin() + 2 * (i + 1), runs.begin() + 2 * (i + 2));
+			}
+			return true;
+		}
+	}
+	const size_t next = (i == kNotFound) ? 0 : i + 1;
+	if (next < n && runs[2 * next] == low + 1) {
+		runs[2 * next] = low;
+		runs[2 * next + 1]++;
+		return true;
+	}
+	const uint16_t pair[2] = { low, 0 };
+	runs.insert(runs.begin() + 2 * next, pair, pair + 2);
+	return true;
+}
+
+bool run_remove(std::vector<uint16_t>& runs, uint16_t low) {
+	const size_t i = run_before(runs, low);
+	if (i == kNotFound) return false;
+	const uint16_t start = runs[2 * i];
+	const uint32_t last = static_cast<uint32_t>(start) + runs[2 * i + 1];
+	if (low > last) return false;
+	if (start == last) {
+		runs.erase(runs.begin() + 2 * i, runs.begin() + 2 * i + 2);
+	} else if (low == start) {
+		runs[2 * i]++;
+		runs[2 * i + 1]--;
+	} else if (low == last) {
+		runs[2 * i + 1]--;
+	} else {
+		// Ortadan blnr: [start, low - 1] ve [low + 1, last].
+		runs[2 * i + 1] = static_cast<uint16_t>(low - start - 1);
+		const uint16_t pair[2] = { static_cast<uint16_t>(low + 1), static_cast<uint16_t>(last - low - 1) };
+		runs.insert(runs.begin() + 2 * (i + 1), pair, pair + 2);
+	}
+	return true;
+}
+
+// --- Trler aras kap ilemleri ---
+
+// Dallanmasz sral birletirme: Her admda kk (veya eit) deer yazlr ve yazma
+// indeksi, ilemin o deeri tutup tutmadna gre 0 / 1 ilerler. Rastgele dizilerde
+// adm bana bir yanl tahmin edilen dallanma yerine yalnzca karlatrmalar kalr.
+void merge_arrays(const std::vector<uint16_t>& a, const std::vector<uint16_t>& b, SetOp op, std::vector<uint16_t>& out) {
+	const size_t na = a.size();
+	const size_t nb = b.size();
+	out.resize((op == SetOp::And) ? std::min(na, nb) : (op == SetOp::AndNot) ? na : na + nb);
+	uint16_t* dst = out.data();
+	size_t i = 0;
+	size_t j = 0;
+	size_t k = 0;
+	while (i < na && j < nb) {
+		const uint16_t x = a[i];
+		const uint16_t y = b[j];
+		bool keep;
+		switch (op) {
+		case SetOp::And:    keep = x == y; break;
+		case SetOp::Or:     keep = true; break;
+		case SetOp::Xor:    keep = x != y; break;
+		default:            keep = x < y; break;     // AndNot
+		}
+		dst[k] = (x < y) ? x : y;
+		k += keep;
+		i += (x <= y);
+		j += (y <= x);
+	}
+	if (op != SetOp::And) {
+		std::copy(a.begin() + i, a.end(), dst + k);
+		k += na - i;
+	}
+	if (op == SetOp::Or || op == SetOp::Xor) {
+		std::copy(b.begin() + j, b.end(), dst + k);
+		k += nb - j;
+	}
+	out.resize(k);
+}
+
+// Dizi elemanlarn dier kapta yelie gre szer (keep == true: kesiim, false: fark).
+void filter_array(const std::vector<uint16_t>& array, const Container& other, bool keep,
+                  std::vector<uint16_t>& out) {
+	out.clear();
+	for (uint16_t v : array) {
+		if (container_contains(other, v) == keep) out.push_back(v);
+	}
+}
+
+// a op b sonucunu out'a yazar; sonu bosa false.
+bool combine(const Container& a, const Container& b, SetOp op,
+             Container& out) {
+	out.words.clear();
+	if (a.kind == Kind::Array && b.kind == Kind::Array) {
+		merge_arrays(a.values, b.values, op, out.values);
+		out.kind = Kind::Array;
+		out.cardinality = static_cast<uint32_t>(out.values.size());
+	} else if (a.kind == Kind::Array && (op == SetOp::And || op == SetOp::AndNot)) {
+		filter_array(a.values, b, op == SetOp::And, out.values);
+		out.kind = Kind::Array;
+		out.cardinality = static_cast<uint32_t>(out.values.size());
+	} else if (b.kind == Kind::Array && op == SetOp::And) {
+		filter_array(b.values, a, true, out.values);
+		out.kind = Kind::Array;
+		out.cardinality = static_cast<uint32_t>(out.values.size());
+	} else {
+		// Bit kmesi yolu: 1024 kelimelik ilem (otomatik vektrlenir) + bulk popcount.
+		out.words.resize(kWords);
+		out.values.clear();
+		uint64_t* dst = out.words.data();
+		to_words(a, dst);
+		uint64_t rhs[kWords];
+		const uint64_t* src = rhs;
+		if (b.kind == Kind::Bitset) {
+			src = b.words.data();
+		} else {
+			to_words(b, rhs);
+		}
+		switch (op) {
+		case SetOp::And:    for (size_t w = 0; w < kWords; w++) dst[w] &= src[w]; break;
+		case SetOp::Or:     for (size_t w = 0; w < kWords; w++) dst[w] |= src[w]; break;
+		case SetOp::Xor:    for (size_t w = 0; w < kWords; w++) dst[w] ^= src[w]; break;
+		case SetOp::AndNot: for (size_t w = 0; w < kWords; w++) dst[w] &= ~src[w]; break;
+		}
+		out.kind = Kind::Bitset;
+		out.cardinality = static_cast<uint32_t>(count_set_bits(dst, kWords));
+	}
+	if (out.cardinality == 0) return false;
+	optimize_container(out);
+	return true;
+}
+
+size_t container_bytes(const Container& c) {
+	if (c.kind == Kind::Run) return 2 + 2 * c.values.size();
+	return (c.kind == Kind::Array) ? 2 * c.values.size() : kBitsetBytes;
+}
+
+// OR ve XOR: Anahtar birleimi yeni dizilere yazlr (tek tarafl kaplar kopyalanr).
+void merge_union(std::vector<uint16_t>& keys, std::vector<Container>& containers,
+                 const std::vector<uint16_t>& other_keys, const std::vector<Container>& other_containers,
+                 SetOp op) {
+	std::vector<uint16_t> out_keys;
+	std::vector<Container> out;
+	out_keys.reserve(keys.size() + other_keys.size());
+	out.reserve(keys.size() + other_keys.size());
+	size_t i = 0;
+	size_t j = 0;
+	Container result;
+	while (i < keys.size() || j < other_keys.size()) {
+		if (j == other_keys.size() || (i < keys.size() && keys[i] < other_keys[j])) {
+			out_keys.push_back(keys[i]);
+			out.push_back(std::move(containers[i++]));
+		} else if (i == keys.size() || other_keys[j] < keys[i]) {
+			out_keys.push_back(other_keys[j]);
+			out.push_back(other_containers[j++]);
+		} else {
+			if (combine(containers[i], other_containers[j], op, result)) {
+				out_keys.push_back(keys[i]);
+				out.push_back(std::move(result));
+			}
+			i++;
+			j++;
+		}
+	}
+	keys.swap(out_keys);
+	containers.swap(out);
+}
+
+} // namespace
+
+
+// =========================================================================
+// I. TEK DEER LEMLER
+// =========================================================================
+
+size_t CompressedBitmap::find_key(uint16_t key) const {
+	const uint16_t* k = keys_.data();
+	const size_t i = partition_point(keys_.size(), [k, key](size_t j) { return k[j] < key; });
+	return (i < keys_.size() && k[i] == key) ? i : kNotFound;
+}
+
+bool CompressedBitmap::contains(uint32_t value) const {
+	const size_t i = find_key(static_cast<uint16_t>(value >> 16));
+	return i != kNotFound && container_contains(containers_[i], static_cast<uint16_t>(value));
+}
+
+bool CompressedBitmap::add(uint32_t value) {
+	const uint16_t key = static_cast<uint16_t>(value >> 16);
+	const uint16_t low = static_cast<uint16_t>(value);
+	const std::vector<uint16_t>::iterator it = std::lower_bound(keys_.begin(), keys_.end(), key);
+	const size_t i = static_cast<size_t>(it - keys_.begin());
+	if (it == keys_.end() || *it != key) {
+		Container c;
+		c.kind = Kind::Array;
+		c.cardinality = 1;
+		c.values.push_back(low);
+		keys_.insert(it, key);
+		containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(i), std::move(c));
+		return true;
+	}
+	Container& c = containers_[i];
+	if (c.kind == Kind::Array) {
+		const std::vector<uint16_t>::iterator pos = std::lower_bound(c.values.begin(), c.values.end(), low);
+		if (pos != c.values.end() && *pos == low) return false;
+		if (c.cardinality < kArrayMax) {
+			c.values.insert(pos, low);
+			c.cardinality++;
+			return true;
+		}
+		make_bitset(c);     // 4097. eleman: Dizi 8 KiB' aar.
+	}
+	if (c.kind == Kind::Bitset) {
+		uint64_t& word = c.words[low / 64];
+		if (isBitSet(word, low % 64)) return false;
+		word = SetRegBit(word, low % 64);
+	} else if (!run_add(c.values, low)) {
+		return false;
+	}
+	c.cardinality++;
+	return true;
+}
+
+bool CompressedBitmap::remove(uint32_t value) {
+	const size_t i = find_key(static_cast<uint16_t>(value >> 16));
+	if (i == kNotFound) return false;
+	Container& c = containers_[i];
+	const uint16_t low = static_cast<uint16_t>(value);
+	if (c.kind == Kind::Array) {
+		const std::vector<uint16_t>::iterator pos = std::lower_bound(c.values.begin(), c.values.end(), low);
+		if (pos == c.values.end() || *pos != low) return false;
+		c.values.erase(pos);
+	} else if (c.kind == Kind::Bitset) {
+		uint64_t& word = c.words[low / 64];
+		if (!isBitSet(word, low % 64)) return false;
+		word = ClearRegBit(word, low % 64);
+	} else if (!run_remove(c.values, low)) {
+		return false;
+	}
+	if (--c.cardinality == 0) {
+		keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(i));
+		containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(i));
+	} else if (c.kind == Kind::Bitset && c.cardinality <= kArrayMax) {
+		make_array(c);
+	}
+	return true;
+}
+
+void CompressedBitmap::add_range(uint32_t begin, uint64_t end) {
+	if (end > (static_cast<uint64_t>(1) << 32)) end = static_cast<uint64_t>(1) << 32;
+	if (begin >= end) return;
+	const uint32_t first_key = begin >> 16;
+	const uint32_t last_key = static_cast<uint32_t>((end - 1) >> 16);
+	for (uint32_t key = first_key; key <= last_key; key++) {
+		const uint64_t base = static_cast<uint64_t>(key) << 16;
+		const uint32_t lo = (key == first_key) ? (begin & 0xFFFFu) : 0;
+		const uint32_t hi = (key == last_key) ? static_cast<uint32_t>(end - base) : kChunkValues;
+		const std::vector<uint16_t>::iterator it = std::lower_bound(keys_.begin(), keys_.end(), static_cast<uint16_t>(key));
+		const size_t i = static_cast<size_t>(it - keys_.begin());
+		if (it == keys_.end() || *it != key) {
+			Container c;
+			c.kind = Kind::Run;
+			c.cardinality = hi - lo;
+			c.values.push_back(static_cast<uint16_t>(lo));
+			c.values.push_back(static_cast<uint16_t>(hi - lo - 1));
+			optimize_container(c);
+			keys_.insert(it, static_cast<uint16_t>(key));
+			containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(i), std::move(c));
+			continue;
+		}
+		Container& c = containers_[i];
+		make_bitset(c);
+		set_range(c.words.data(), lo, hi);
+		c.cardinality = static_cast<uint32_t>(count_set_bits(c.words.data(), kWords));
+		optimize_container(c);
+	}
+}
+
+uint64_t CompressedBitmap::cardinality() const {
+	uint64_t total = 0;
+	for (const Container& c : containers_) total += c.cardinality;
+	return total;
+}
+
+void CompressedBitmap::clear() {
+	keys_.clear();
+	containers_.clear();
+}
+
+void CompressedBitmap::optimize() {
+	for (Container& c : containers_) optimize_container(c);
+}
+
+
+// =========================================================================
+// II. KME LEMLER
+// =========================================================================
+
+CompressedBitmap& CompressedBitmap::operator&=(const CompressedBitmap& other) {
+	size_t kept = 0;
+	size_t j = 0;
+	Container result;
+	for (size_t i = 0; i < keys_.size(); i++) {
+		while (j < other.keys_.size() && other.keys_[j] < keys_[i]) j++;
+		if (j == other.keys_.size()) break;
+		if (other.keys_[j] != keys_[i]) continue;
+		if (combine(containers_[i], other.containers_[j], SetOp::And, result)) {
+			keys_[kept] = keys_[i];
+			std::swap(containers_[kept], result);
+			kept++;
+		}
+	}
+	keys_.resize(kept);
+	containers_.resize(kept);
+	return *this;
+}
+
+CompressedBitmap& CompressedBitmap::and_not(const CompressedBitmap& other) {
+	size_t kept = 0;
+	size_t j = 0;
+	Container result;
+	for (size_t i = 0; i < keys_.size(); i++) {
+		while (j < other.keys_.size() && other.keys_[j] < keys_[i]) j++;
+		if (j < other.keys_.size() && other.keys_[j] == keys_[i]) {
+			if (!combine(containers_[i], other.containers_[j], SetOp::AndNot, result)) continue;
+			std::swap(containers_[i], result);
+		}
+		if (kept != i) {
+			keys_[kept] = keys_[i];
+			std::swap(containers_[kept], containers_[i]);
+		}
+		kept++;
+	}
+	keys_.resize(kept);
+	containers_.resize(kept);
+	return *this;
+}
+
+
+CompressedBitmap& CompressedBitmap::operator|=(const CompressedBitmap& other) {
+	if (this != &other) merge_union(keys_, containers_, other.keys_, other.containers_, SetOp::Or);
+	return *this;
+}
+
+CompressedBitmap& CompressedBitmap::operator^=(const CompressedBitmap& other) {
+	if (this == &other) {
+		clear();
+	} else {
+		merge_union(keys_, containers_, other.keys_, other.containers_, SetOp::Xor);
+	}
+	return *this;
+}
+
+bool CompressedBitmap::operator==(const CompressedBitmap& other) const {
+	if (keys_ != other.keys_) return false;
+	uint64_t a[kWords];
+	uint64_t b[kWords];
+	for (size_t i = 0; i < containers_.size(); i++) {
+		const Container& x = containers_[i];
+		const Container& y = other.containers_[i];
+		if (x.cardinality != y.cardinality) return false;
+		if (x.kind == y.kind && x.kind != Kind::Run) {
+			if (x.values != y.values || x.words != y.words) return false;
+			continue;
+		}
+		to_words(x, a);
+		to_words(y, b);
+		if (std::memcmp(a, b, kBitsetBytes) != 0) return false;
+	}
+	return true;
+}
+
+
+// =========================================================================
+// III. TAINABLR BM
+// =========================================================================
+
+size_t CompressedBitmap::serialized_size() const {
+	const size_t n = keys_.size();
+	bool has_run = false;
+	size_t bytes = 0;
+	for (const Container& c : containers_) {
+		has_run = has_run || c.kind == Kind::Run;
+		bytes += container_bytes(c);
+	}
+	bytes += has_run ? 4 + (n + 7) / 8 : 8;
+	bytes += 4 * n;
+	if (!has_run || n >= kNoOffsetThreshold) bytes += 4 * n;
+	return bytes;
+}
+
+size_t CompressedBitmap::serialize(uint8_t* out) const {
+	const size_t n = keys_.size();
+	bool has_run = false;
+	for (const Container& c : containers_) has_run = has_run || c.kind == Kind::Run;
+
+	uint8_t* p = out;
+	if (has_run) {
+		store_le32(p, kCookieRun | static_cast<uint32_t>(n - 1) << 16);
+		p += 4;
+		std::memset(p, 0, (n + 7) / 8);
+		for (size_t i = 0; i < n; i++) {
+			if (containers_[i].kind == Kind::Run) p[i / 8] = SetRegBit(p[i / 8], static_cast<int>(i % 8));
+		}
+		p += (n + 7) / 8;
+	} else {
+		store_le32(p, kCookieNoRun);
+		store_le32(p + 4, static_cast<uint32_t>(n));
+		p += 8;
+	}
+	for (size_t i = 0; i < n; i++) {
+		store_le16(p, keys_[i]);
+		store_le16(p + 2, static_cast<uint16_t>(containers_[i].cardinality - 1));
+		p += 4;
+	}
+	if (!has_run || n >= kNoOffsetThreshold) {
+		size_t offset = static_cast<size_t>(p - out) + 4 * n;
+		for (size_t i = 0; i < n; i++) {
+			store_le32(p, static_cast<uint32_t>(offset));
+			offset += container_bytes(containers_[i]);
+			p += 4;
+		}
+	}
+	for (const Container& c : containers_) {
+		if (c.kind == Kind::Bitset) {
+			for (size_t w = 0; w < kWords; w++) bitstream_detail::store_le64(p + 8 * w, c.words[w]);
+			p += kBitsetBytes;
+			continue;
+		}
+		if (c.kind == Kind::Run) {
+			store_le16(p, static_cast<uint16_t>(c.values.size() / 2));
+			p += 2;
+		}
+		for (uint16_t v : c.values) {
+			store_le16(p, v);
+			p += 2;
+		}
+	}
+	return static_cast<size_t>(p - out);
+}
+
+bool CompressedBitmap::deserialize(const void* data, size_t bytes) {
+	clear();
+	CompressedBitmapView view;
+	if (!view.open(data, bytes)) return false;
+	keys_.resize(view.count_);
+	containers_.resize(view.count_);
+	for (size_t i = 0; i < view.count_; i++) {
+		keys_[i] = view.key_at(i);
+		Container& c = containers_[i];
+		c.kind = view.kind_at(i);
+		c.cardinality = view.cardinality_at(i);
+		const uint8_t* p = view.container_at(i);
+		bool valid = true;
+		if (c.kind == Kind::Bitset) {
+			c.words.resize(kWords);
+			for (size_t w = 0; w < kWords; w++) c.words[w] = bitstream_detail::load_le64(p + 8 * w);
+			valid = count_set_bits(c.words.data(), kWords) == c.cardinality;
+		} else if (c.kind == Kind::Array) {
+			c.values.resize(c.cardinality);
+			for (size_t k = 0; k < c.cardinality; k++) {
+				c.values[k] = load_le16(p + 2 * k);
+				valid = valid && (k == 0 || c.values[k] > c.values[k - 1]);
+			}
+		} else {
+			const size_t runs = load_le16(p);
+			c.values.resize(2 * runs);
+			uint64_t total = 0;
+			uint32_t next_start = 0;    // Koular sral ve rtmez olmaldr.
+			for (size_t r = 0; r < runs; r++) {
+				const uint16_t start = load_le16(p + 2 + 4 * r);
+				const uint16_t length = load_le16(p + 4 + 4 * r);
+				valid = valid && start >= next_start && static_cast<uint32_t>(start) + length < kChunkValues;
+				next_start = static_cast<uint32_t>(start) + length + 1;
+				total += static_cast<uint64_t>(length) + 1;
+				c.values[2 * r] = start;
+				c.values[2 * r + 1] = length;
+			}
+			valid = valid && total == c.cardinality;
+		}
+		if (!valid) {
+			clear();
+			return false;
+		}
+	}
+	return true;
+}
+
+
+// =========================================================================
+// IV. KOPYASIZ GRNM
+// =========================================================================
+
+bool CompressedBitmapView::open(const void* data, size_t bytes) {
+	data_ = static_cast<const uint8_t*>(data);
+	bytes_ = bytes;
+	count_ = 0;
+	size_ = 0;
+	run_flags_ = nullptr;
+	offsets_ = nullptr;
+	if (bytes < 4) return false;
+	const uint32_t cookie = load_le32(data_);
+	size_t pos = 4;
+	if ((cookie & 0xFFFFu) == kCookieRun) {
+		count_ = (cookie >> 16) + 1;
+		if (bytes - pos < (count_ + 7) / 8) return false;
+		run_flags_ = data_ + pos;
+		pos += (count_ + 7) / 8;
+		has_offsets_ = count_ >= kNoOffsetThreshold;
+	} else if (cookie == kCookieNoRun) {
+		if (bytes < 8) return false;
+		count_ = load_le32(data_ + 4);
+		if (count_ > kChunkValues) return false;
+		pos = 8;
+		has_offsets_ = true;
+	} else {
+		return false;
+	}
+	if ((bytes - pos) / 4 < count_) return false;
+	header_ = data_ + pos;
+	pos += 4 * count_;
+	for (size_t i = 1; i < count_; i++) {
+		if (key_at(i) <= key_at(i - 1)) return false;   // kili arama sral anahtar ister.
+	}
+	if (has_offsets_) {
+		if ((bytes - pos) / 4 < count_) return false;
+		offsets_ = data_ + pos;
+		pos += 4 * count_;
+	}
+	// Her kap tampon iinde kalmaldr; kme sonu en byk kap sonudur.
+	size_ = pos;
+	for (size_t i = 0; i < count_; i++) {
+		size_t offset = pos;
+		if (has_offsets_) {
+			offset = load_le32(offsets_ + 4 * i);
+		} else {
+			inline_offsets_[i] = static_cast<uint32_t>(pos);
+		}
+		const size_t length = container_bytes(i, offset);
+		if (length == kNotFound) return false;
+		pos = offset + length;
+		if (pos > size_) size_ = pos;
+	}
+	return true;
+}
+
+size_t CompressedBitmapView::container_bytes(size_t i, size_t offset) const {
+	if (offset > bytes_) return kNotFound;
+	size_t length = kBitsetBytes;
+	const CompressedBitmap::Kind kind = kind_at(i);
+	if (kind == Kind::Array) {
+		length = 2 * static_cast<size_t>(cardinality_at(i));
+	} else if (kind == Kind::Run) {
+		if (bytes_ - offset < 2) return kNotFound;
+		length = 2 + 4 * static_cast<size_t>(load_le16(data_ + offset));
+	}
+	return (bytes_ - offset < length) ? kNotFound : length;
+}
+
+uint16_t CompressedBitmapView::key_at(size_t i) const {
+	return load_le16(header_ + 4 * i);
+}
+
+uint32_t CompressedBitmapView::cardinality_at(size_t i) const {
+	return static_cast<uint32_t>(load_le16(header_ + 4 * i + 2)) + 1;
+}
+
+CompressedBitmap::Kind CompressedBitmapView::kind_at(size_t i) const {
+	if (run_flags_ != nullptr && isBitSet(run_flags_[i / 8], static_cast<int>(i % 8))) return Kind::Run;
+	return (cardinality_at(i) <= CompressedBitmap::kArrayMax) ? Kind::Array : Kind::Bitset;
+}
+
+const uint8_t* CompressedBitmapView::container_at(size_t i) const {
+	return data_ + (has_offsets_ ? load_le32(offsets_ + 4 * i) : inline_offsets_[i]);
+}
+
+uint64_t CompressedBitmapView::cardinality() const {
+	uint64_t total = 0;
+	for (size_t i = 0; i < count_; i++) total += cardinality_at(i);
+	return total;
+}
+
+bool CompressedBitmapView::contains(uint32_t value) const {
+	const uint16_t key = static_cast<uint16_t>(value >> 16);
+	const uint16_t low = static_cast<uint16_t>(value);
+	const size_t lo = partition_point(count_, [this, key](size_t i) { return key_at(i) < key; });
+	if (lo == count_ || key_at(lo) != key) return false;
+	const uint8_t* p = container_at(lo);
+	const CompressedBitmap::Kind kind = kind_at(lo);
+	if (kind == Kind::Bitset) {
+		// Little-endian kelime dzeninde bit i, (i / 8). byte'n (i % 8). bitidir.
+		return isBitSet(p[low / 8], low % 8);
+	}
+	if (kind == Kind::Array) {
+		const size_t n = cardinality_at(lo);
+		const size_t a = partition_point(n, [p, low](size_t i) { return load_le16(p + 2 * i) < low; });
+		return a < n && load_le16(p + 2 * a) == low;
+	}
+	// Kou: Balangc low'dan byk olmayan son kou.
+	const size_t a = partition_point(load_le16(p), [p, low](size_t i) { return load_le16(p + 2 + 4 * i) <= low; });
+	return a != 0 && low <= static_cast<uint32_t>(load_le16(p + 2 + 4 * (a - 1))) + load_le16(p + 4 + 4 * (a - 1));
+}
@@ -0,0 +1,230 @@
+/**
+ * @file compressed_bitmap.h
+ * @brief Roaring Tarz Sktrlm Bitmap: Dizi / Bit Kmesi / Kou (Run) Kaplar.
+ *
+ * DynamicBitset, 32-bit bir kimlik (ID) uzaynda tek bir kimlik iin bile 512 MiB'a kadar
+ * kelime ayrr ve uzun ardk aralklar (run) sktramaz. CompressedBitmap, 32-bit
+ * anahtar uzayn st 16 bite gre 2^16 deerlik kaplara (container) bler; yalnzca en az
+ * bir deer ieren kaplar tutulur. Her kap ieriine gre en kk gsterimi seer:
+ * - Dizi (Array): Sral uint16_t deerler; kardinalite <= 4096 (en fazla 8 KiB).
+ * - Bit kmesi (Bitset): 1024 uint64_t kelime (sabit 8 KiB); kardinalite > 4096.
+ * - Kou (Run): (balang, uzunluk - 1) uint16_t iftleri; uzun aralklar iin.
+ *
+ * Kme ilemleri (AND/OR/XOR/ANDNOT) kap tr iftine gre en ucuz yolu seer: ki dizi
+ * dallanmasz sral birletirme (merge), dizi ile dierleri yelik filtresi, geri kalanlar 1024
+ * kelimelik bit kmesi zerinde kelime ilemi + bulk count_set_bits ile alr.
+ *
+ * Seri hale getirme (serialization), Roaring tanabilir (portable) biimindedir
+ * (little-endian; dier Roaring kitaplklaryla uyumlu). CompressedBitmapView bu biimi
+ * kopyalamadan, rn. MappedBitmap ile elenmi bir dosya zerinde sorgular.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef COMPRESSED_BITMAP_H
+#define COMPRESSED_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "bitops.h" // find_first_set_bit
+
+namespace compressed_bitmap_detail {
+
+/// Kap gsterimi (CompressedBitmap::Kind).
+enum class ContainerKind : uint8_t {
+    Array = 0,      ///< Sral uint16_t deerler.
+    Bitset = 1,     ///< 1024 kelimelik bit kmesi.
+    Run = 2         ///< (balang, uzunluk - 1) iftleri.
+};
+
+/// Bir 2^16 deerlik kap. Yalnzca gsterime ait vektr doludur.
+struct Container {
+    ContainerKind kind;
+    uint32_t cardinality;
+    std::vector<uint16_t> values;   ///< Dizi: Sral deerler. Kou: (balang, uzunluk - 1) iftleri.
+    std::vector<uint64_t> words;    ///< Bit kmesi: 1024 kelime.
+};
+
+} // namespace compressed_bitmap_detail
+
+/**
+ * @brief Sktrlm 32-bit tamsay kmesi (tek i parackl).
+ *
+ * MHENDSLK NOTU (Uyarlanr gsterim): add/remove yalnzca dizi <-> bit kmesi eiini
+ * (4096) uygular; bu eikte iki gsterim de 8 KiB'tr. Kou gsterimi add_range, kme
+ * ilemleri ve optimize() tarafndan seilir: Kou says bit kmesinde kelime bana bir
+ * popcount(w & ~(w << 1 | tama)) ile saylr ve seri boyutu (2 + 4 * kou) dizi
+ * (2 * kardinalite) ve bit kmesi (8192) boyutlarndan kkse kap kouya evrilir.
+ * Mevcut kou kabna add/remove koular yerinde geniletir, birletirir veya bler.
+ */
+class CompressedBitmap {
+public:
+    using Kind = compressed_bitmap_detail::ContainerKind;
+
+    /// Dizi kabnn en byk kardinalitesi (alnca bit kmesine geilir).
+    static constexpr uint32_t kArrayMax = 4096;
+    static constexpr size_t kBitsetWords = 1024;
+
+    CompressedBitmap() {}
+
+    /// Deeri ekler; zaten varsa false.
+    bool add(uint32_t value);
+
+    /// [begin, end) araln ekler (end en fazla 2^32). Bo kaplar tek kou olarak oluur.
+    void add_range(uint32_t begin, uint64_t end);
+
+    /// Deeri karr; yoksa false.
+    bool remove(uint32_t value);
+
+    bool contains(uint32_t value) const;
+
+    /// Toplam eleman says (kap bana tutulan kardinalitelerin toplam).
+    uint64_t cardinality() const;
+    bool empty() const { return keys_.empty(); }
+    void clear();
+
+    /// Her kab en kk gsterimine (dizi, bit kmesi veya kou) evirir.
+    void optimize();
+
+    // --- Tehis ---
+    size_t container_count() const { return keys_.size(); }
+    /// i. kabn st 16 biti (artan srada).
+    uint16_t container_key(size_t i) const { return keys_[i]; }
+    Kind container_kind(size_t i) const { return containers_[i].kind; }
+
+    /**
+     * MHENDSLK NOTU (Kme ilemleri): Anahtarlar sral iki dizide birletirilir; yalnzca
+     * iki tarafta da bulunan anahtarlarn kaplar birletirilir, dierleri kopyalanr veya
+     * atlanr. Sonu kaplar yeniden optimize edilir; boalan kaplar silinir.
+     */
+    CompressedBitmap& operator&=(const CompressedBitmap& other);
+    CompressedBitmap& operator|=(const CompressedBitmap& other);
+    CompressedBitmap& operator^=(const CompressedBitmap& other);
+    /// *this &= ~other (kme fark).
+    CompressedBitmap& and_not(const CompressedBitmap& other);
+
+    /// Ayn kme mi? Gsterimden bamszdr (dizi ve kou kab ayn deerleri tutabilir).
+    bool operator==(const CompressedBitmap& other) const;
+    bool operator!=(const CompressedBitmap& other) const { return !(*this == other); }
+
+    /**
+     * @brief Her deer iin fn(value) arr (artan srada).
+     * @tparam Fn void(uint32_t) imzal arlabilir nesne.
+     */
+    template<typename Fn>
+    void for_each(Fn fn) const {
+        for (size_t i = 0; i < keys_.size(); i++) {
+            const uint32_t high = static_cast<uint32_t>(keys_[i]) << 16;
+            const Container& c = containers_[i];
+            if (c.kind == Kind::Array) {
+                for (uint16_t low : c.values) fn(high | low);
+            } else if (c.kind == Kind::Bitset) {
+                for (size_t w = 0; w < kBitsetWords; w++) {
+                    uint64_t word = c.words[w];
+                    while (word != 0) {
+                        fn(high | static_cast<uint32_t>(w * 64 + static_cast<size_t>(find_first_set_bit(word))));
+                        word &= word - 1;
+                    }
+                }
+            } else {
+                for (size_t r = 0; r < c.values.size(); r += 2) {
+                    const uint32_t last = static_cast<uint32_t>(c.values[r]) + c.values[r + 1];
+                    for (uint32_t low = c.values[r]; low <= last; low++) fn(high | low);
+                }
+            }
+        }
+    }
+
+    /**
+     * MHENDSLK NOTU (Seri biim): Roaring tanabilir biimi, tm alanlar little-endian:
+     * 1. Kou kab yoksa: uint32 12346, uint32 kap says. Varsa: uint32 12347 | (n - 1) << 16
+     *    ve ardndan hangi kaplarn kou olduunu gsteren (n + 7) / 8 byte'lk bitmap.
+     * 2. Kap bana (uint16 anahtar, uint16 kardinalite - 1).
+     * 3. Kou kab yoksa veya n >= 4 ise kap bana uint32 byte ofseti (ak bandan).
+     * 4. Kaplar: Dizi 2 * kardinalite byte, bit kmesi 8192 byte, kou uint16 kou says +
+     *    kou bana (balang, uzunluk - 1). Dizi / bit kmesi ayrm kardinaliteden
+     *    (<= 4096) karlr; bu yzden bellek ii eik de 4096'dr.
+     */
+
+    /// serialize()'n yazaca byte says.
+    size_t serialized_size() const;
+
+    /**
+     * @brief Kmeyi tanabilir biimde yazar.
+     * @param out En az serialized_size() byte'lk hedef (hizal olmas gerekmez).
+     * @return Yazlan byte says.
+     */
+    size_t serialize(uint8_t* out) const;
+
+    /**
+     * @brief Tanabilir biimdeki kmeyi kopyalayarak ykler.
+     * @return Tampon bozuk veya ksaysa (ya da ierik balkla tutarszsa) false; kme boalr.
+     */
+    bool deserialize(const void* data, size_t bytes);
+
+private:
+    using Container = compressed_bitmap_detail::Container;
+
+    size_t find_key(uint16_t key) const;
+
+    std::vector<uint16_t> keys_;        ///< Artan sral kap anahtarlar (st 16 bit).
+    std::vector<Container> containers_;
+};
+
+/**
+ * @brief Tanabilir biimdeki bir CompressedBitmap zerinde kopyasz salt okunur grnm.
+ *
+ * open() yalnzca bal dorular (erez, kap says, anahtar sras, her kabn tampon
+ * iinde kalmas); hibir kap kopyalanmaz. Sorgular tampondaki hizasz little-endian
+ * deerleri dorudan okur; tampon grnm yaad srece geerli kalmaldr. erik
+ * tutarll (dizi sras, popcount == kardinalite) CompressedBitmap::deserialize ile
+ * dorulanr.
+ */
+class CompressedBitmapView {
+public:
+    CompressedBitmapView() : data_(nullptr), bytes_(0), size_(0), count_(0), has_offsets_(false),
+                             run_flags_(nullptr), header_(nullptr), offsets_(nullptr) {}
+
+    /**
+     * @brief Tampondaki seri kmeyi aar.
+     * @param data Tampon (rn. MappedBitmap::words()); hizal olmas gerekmez.
+     * @param bytes Tampon boyutu; kme sonras artk byte'lar yok saylr.
+     * @return Balk bozuk veya tampon ksaysa false.
+     */
+    bool open(const void* data, size_t bytes);
+
+    size_t container_count() const { return count_; }
+    /// Kmenin tampondaki byte uzunluu.
+    size_t serialized_size() const { return size_; }
+
+    /// Toplam eleman says (yalnzca balk okunur).
+    uint64_t cardinality() const;
+
+    /// yelik sorgusu: Anahtar balkta, deer kapta ikili aramayla bulunur.
+    bool contains(uint32_t value) const;
+
+private:
+    friend class CompressedBitmap;
+
+    uint16_t key_at(size_t i) const;
+    uint32_t cardinality_at(size_t i) const;
+    CompressedBitmap::Kind kind_at(size_t i) const;
+    const uint8_t* container_at(size_t i) const;
+    size_t container_bytes(size_t i, size_t offset) const;
+
+    const uint8_t* data_;
+    size_t bytes_;
+    size_t size_;
+    size_t count_;
+    bool has_offsets_;
+    const uint8_t* run_flags_;      ///< Kou kab bitmap'i (kou yoksa nullptr).
+    const uint8_t* header_;         ///< (anahtar, kardinalite - 1) iftleri.
+    const uint8_t* offsets_;        ///< Ofset bal (yoksa nullptr).
+    uint32_t inline_offsets_[4];    ///< Ofset bal olmayan kk kmelerde (n < 4) hesaplanan ofsetler.
+};
+
+#endif // COMPRESSED_BITMAP_H
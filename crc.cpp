@@ -0,0 +1,209 @@
+/**
+ * @file crc.cpp
+ * @brief CRC Motoru Implementasyonu: Derleme Zaman Slicing-by-8 Tablolar ve SSE4.2 ekirdei.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "crc.h"
+#include "bitops.h"     // bitops_cpu_features
+#include "thread_pool.h" // ThreadPool::parallel_for, kParallelGrainBytes
+#include <cstring>      // std::memcpy (hizasz okumalar)
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define CRC_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define CRC_X86_SIMD 0
+#endif
+
+namespace {
+
+// =========================================================================
+// I. SLICING-BY-8 TABLOLARI
+// =========================================================================
+
+struct Slice8Tables {
+	uint32_t t[8][256];
+};
+
+// t[0]: Klasik byte tablosu. t[k][i] = (t[k-1][i] >> 8) ^ t[0][t[k-1][i] & 0xFF]:
+// byte i'nin, ardndan k adet sfr byte ilendiindeki katks.
+constexpr Slice8Tables build_slice8_tables(uint32_t poly) {
+	Slice8Tables tables = {};
+	for (uint32_t i = 0; i < 256; i++) {
+		uint32_t crc = i;
+		for (int bit = 0; bit < 8; bit++) crc = (crc >> 1) ^ ((crc & 1u) ? poly : 0u);
+		tables.t[0][i] = crc;
+	}
+	for (int k = 1; k < 8; k++) {
+		for (uint32_t i = 0; i < 256; i++) {
+			const uint32_t prev = tables.t[k - 1][i];
+			tables.t[k][i] = (prev >> 8) ^ tables.t[0][prev & 0xFFu];
+		}
+	}
+	return tables;
+}
+
+// Polinom bana 8 KB; derleme zamannda retilir (.rodata), balatma maliyeti yoktur.
+template<uint32_t Poly>
+struct Slice8 {
+	static constexpr Slice8Tables kTables = build_slice8_tables(Poly);
+};
+
+template<uint32_t Poly>
+constexpr Slice8Tables Slice8<Poly>::kTables;
+
+// =========================================================================
+// II. DONANIM CRC32C (SSE4.2)
+// =========================================================================
+
+#if CRC_X86_SIMD
+
+// CRC32 komutu: 64-bit kelime bana 1 komut (gecikme 3 dng, ardk baml zincir).
+__attribute__((target("sse4.2")))
+uint32_t update_crc32c_sse42(uint32_t state, const uint8_t* data, size_t n) {
+	uint64_t crc = state;
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		uint64_t word;
+		std::memcpy(&word, data + i, sizeof(word));
+		crc = _mm_crc32_u64(crc, word);
+	}
+	uint32_t crc32 = static_cast<uint32_t>(crc);
+	for (; i < n; i++) crc32 = _mm_crc32_u8(crc32, data[i]);
+	return crc32;
+}
+
+#endif // CRC_X86_SIMD
+
+struct Crc32cDispatch {
+	uint32_t (*update)(uint32_t, const uint8_t*, size_t);
+	const char* name;
+};
+
+Crc32cDispatch build_crc32c_dispatch() {
+	Crc32cDispatch d = { crc_detail::update_slice8<crc_detail::kCastagnoli>, "slice8" };
+#if CRC_X86_SIMD
+	if (bitops_cpu_features().sse4_2) { d.update = update_crc32c_sse42; d.name = "sse4.2"; }
+#endif
+	return d;
+}
+
+const Crc32cDispatch& crc32c_dispatch() {
+	static const Crc32cDispatch d = build_crc32c_dispatch();
+	return d;
+}
+
+// =========================================================================
+// III. BRLETRME (GF(2) OPERATRLER)
+// =========================================================================
+
+// Stun i, durumun i. bitinin operatr altndaki grntsdr.
+struct Gf2Matrix {
+	uint32_t col[32];
+};
+
+uint32_t gf2_apply(const Gf2Matrix& m, uint32_t v) {
+	uint32_t r = 0;
+	for (int i = 0; v != 0; i++, v >>= 1) {
+		if (v & 1u) r ^= m.col[i];
+	}
+	return r;
+}
+
+Gf2Matrix gf2_square(const Gf2Matrix& m) {
+	Gf2Matrix sq;
+	for (int i = 0; i < 32; i++) sq.col[i] = gf2_apply(m, m.col[i]);
+	return sq;
+}
+
+// Tek sfr byte operatr: Her birim durum, ekirdein kendisiyle bir sfr byte ilerletilir.
+Gf2Matrix zero_byte_operator(crc_detail::UpdateFn update) {
+	const uint8_t zero = 0;
+	Gf2Matrix m;
+	for (int i = 0; i < 32; i++) m.col[i] = update(1u << i, &zero, 1);
+	return m;
+}
+
+// n sfr byte operatr: n'nin ikili almndaki kuvvetlerin arpm (kare alarak s).
+Gf2Matrix zero_bytes_operator(size_t nbytes, crc_detail::UpdateFn update) {
+	Gf2Matrix power = zero_byte_operator(update);
+	Gf2Matrix result;
+	for (int i = 0; i < 32; i++) result.col[i] = 1u << i;
+	for (;;) {
+		if (nbytes & 1) {
+			Gf2Matrix next;
+			for (int i = 0; i < 32; i++) next.col[i] = gf2_apply(power, result.col[i]);
+			result = next;
+		}
+		nbytes >>= 1;
+		if (nbytes == 0) break;
+		power = gf2_square(power);
+	}
+	return result;
+}
+
+} // namespace
+
+
+// =========================================================================
+// IV. GENEL API
+// =========================================================================
+
+template<uint32_t Poly>
+uint32_t crc_detail::update_slice8(uint32_t state, const uint8_t* data, size_t n) {
+	const Slice8Tables& tb = Slice8<Poly>::kTables;
+	uint32_t crc = state;
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		uint32_t lo, hi;
+		std::memcpy(&lo, data + i, sizeof(lo));
+		std::memcpy(&hi, data + i + 4, sizeof(hi));
+		lo ^= crc;
+		crc = tb.t[7][lo & 0xFFu] ^ tb.t[6][(lo >> 8) & 0xFFu] ^ tb.t[5][(lo >> 16) & 0xFFu] ^ tb.t[4][lo >> 24]
+		    ^ tb.t[3][hi & 0xFFu] ^ tb.t[2][(hi >> 8) & 0xFFu] ^ tb.t[1][(hi >> 16) & 0xFFu] ^ tb.t[0][hi >> 24];
+	}
+	for (; i < n; i++) crc = (crc >> 8) ^ tb.t[0][(crc ^ data[i]) & 0xFFu];
+	return crc;
+}
+
+uint32_t crc_detail::update_crc32c(uint32_t state, const uint8_t* data, size_t n) {
+	return crc32c_dispatch().update(state, data, n);
+}
+
+uint32_t crc_detail::shift_state(uint32_t state, size_t nbytes, UpdateFn update) {
+	if (nbytes == 0 || state == 0) return state;
+	return gf2_apply(zero_bytes_operator(nbytes, update), state);
+}
+
+uint32_t crc_detail::update_parallel(ThreadPool& pool, uint32_t state, const uint8_t* data, size_t n, UpdateFn update) {
+	const size_t grain = kParallelGrainBytes;
+	const size_t blocks = ThreadPool::block_count(n, grain);
+	if (blocks <= 1) return update(state, data, n);
+	std::vector<uint32_t> partial(blocks);
+	pool.parallel_for(0, n, grain, [&](size_t lo, size_t hi) {
+		partial[lo / grain] = update(0, data + lo, hi - lo);
+	});
+	// Sral birletirme: Tam bloklar iin operatr bir kez kurulur; ksa son blok ayrca kaydrlr.
+	const Gf2Matrix block_shift = zero_bytes_operator(grain, update);
+	for (size_t b = 0; b < blocks; b++) {
+		const size_t len = (n - b * grain < grain) ? n - b * grain : grain;
+		state = ((len == grain) ? gf2_apply(block_shift, state) : shift_state(state, len, update)) ^ partial[b];
+	}
+	return state;
+}
+
+const char* crc32c_kernel_name() {
+	return crc32c_dispatch().name;
+}
+
+// Ak rnekleme (explicit instantiation): Desteklenen polinomlar.
+template uint32_t crc_detail::update_slice8<0x82F63B78u>(uint32_t, const uint8_t*, size_t);
+template uint32_t crc_detail::update_slice8<0xEDB88320u>(uint32_t, const uint8_t*, size_t);
+template uint32_t crc_detail::update_slice8<0x8408u>(uint32_t, const uint8_t*, size_t);
+template uint32_t crc_detail::update_slice8<0xA001u>(uint32_t, const uint8_t*, size_t);
@@ -0,0 +1,148 @@
+/**
+ * @file crc.h
+ * @brief Artml (Incremental) CRC Motoru: Donanm CRC32C (SSE4.2) ve Slicing-by-8 Tablo Yolu.
+ *
+ * ereve (frame) btnlk kontrolleri iin ak tabanl salama toplam. Byk aklar
+ * para para ilenebilir: update() istenildii kadar arlr, finalize() sonucu verir.
+ * Tm CRC'ler yanstlm (reflected, LSB-first) biimdedir:
+ *
+ * | Tip          | Polinom (yanstlm) | Init   | XorOut | "123456789" |
+ * |--------------|-----------------------|--------|--------|-------------|
+ * | Crc32c       | 0x82F63B78            | ~0     | ~0     | 0xE3069283  |
+ * | Crc32        | 0xEDB88320 (IEEE)     | ~0     | ~0     | 0xCBF43926  |
+ * | Crc16X25     | 0x8408 (HDLC)         | 0xFFFF | 0xFFFF | 0x906E      |
+ * | Crc16Modbus  | 0xA001                | 0xFFFF | 0x0000 | 0x4B37      |
+ *
+ * Crc32c, ilemci SSE4.2 destekliyorsa CRC32 komutunu kullanr (8 byte/komut); dierleri
+ * ve SSE4.2'siz ilemciler slicing-by-8 tablo yolunu (8 tablo x 256 giri) kullanr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef CRC_H
+#define CRC_H
+
+#include <cstddef>
+#include <cstdint>
+
+class ThreadPool;   // thread_pool.h
+
+namespace crc_detail {
+
+/**
+ * @brief Yanstlm polinom iin slicing-by-8 tablo gncelleme ekirdei. Yalnzca aadaki
+ * takma adlarn (alias) polinomlar iin rneklenir (crc.cpp).
+ * @param state Yanstlm CRC yazmac (Init/XorOut uygulanmam ham durum).
+ * @return Gncellenmi ham durum.
+ */
+template<uint32_t Poly>
+uint32_t update_slice8(uint32_t state, const uint8_t* data, size_t n);
+
+/// CRC32C ham durum gncellemesi (SSE4.2 veya slicing-by-8, alma zamannda seilir).
+uint32_t update_crc32c(uint32_t state, const uint8_t* data, size_t n);
+
+constexpr uint32_t kCastagnoli = 0x82F63B78u;
+
+/// Ham durum gncelleme ekirdei (update_slice8<Poly> veya update_crc32c).
+using UpdateFn = uint32_t (*)(uint32_t state, const uint8_t* data, size_t n);
+
+/**
+ * @brief Ham durumu n adet sfr byte ilenmi gibi ilerletir (durum * x^(8n) mod P).
+ *
+ * Dorusal operatr (32x32 GF(2) matrisi), tek sfr byte'n birim durumlara etkisi
+ * 'update' ile llerek kurulur ve kare alarak kuvvetlendirilir: O(log n) matris ilemi.
+ * Polinom genilii bilinmesine gerek kalmaz; 16-bit CRC'lerde st bitler sfr kalr.
+ */
+uint32_t shift_state(uint32_t state, size_t nbytes, UpdateFn update);
+
+/// Ham durumu verinin bloklar paralel ilenerek gnceller (bkz. ReflectedCrc::update(pool, ...)).
+uint32_t update_parallel(ThreadPool& pool, uint32_t state, const uint8_t* data, size_t n, UpdateFn update);
+
+} // namespace crc_detail
+
+/**
+ * @brief Yanstlm CRC hesaplaycs (en fazla 32 bit genilik).
+ *
+ * MHENDSLK NOTU (Slicing-by-8): Klasik tablo yolu byte bana bir baml tablo okumas
+ * yapar (gecikme zinciri). Slicing-by-8, 8 byte' sekiz bamsz tablodan okuyup XOR'lar:
+ * Tablo k, bir byte'n CRC'ye 'k byte sonra' yapaca katkdr. Okumalar paralel yrr ve
+ * dng bana 8 byte ilenir (~4-5x hzlanma). 16-bit CRC'ler ayn 32-bit yazmata,
+ * st bitler sfr kalarak alr. Okumalar little-endian varsayar (x86, ARM Cortex-M).
+ *
+ * @tparam Poly Yanstlm polinom.
+ * @tparam Init Balang deeri.
+ * @tparam XorOut Sonuca uygulanan XOR.
+ */
+template<uint32_t Poly, uint32_t Init, uint32_t XorOut>
+class ReflectedCrc {
+public:
+    ReflectedCrc() : state_(Init) {}
+
+    /// Bir veri parasn CRC'ye ekler; ardk arlar tek aryla ayn sonucu verir.
+    void update(const void* data, size_t n) {
+        state_ = raw_update(state_, static_cast<const uint8_t*>(data), n);
+    }
+
+    /**
+     * @brief update()'in paralel srm; sonu seri yolla ayndr.
+     *
+     * MHENDSLK NOTU (Dorusallk): Ham CRC, durum ve veri zerinde GF(2)'de dorusaldr:
+     * raw(s, A || B) = shift(raw(s, A), |B|) ^ raw(0, B). Veri kParallelGrainBytes'lk
+     * bloklara blnr, her blok sfr durumdan paralel ilenir ve ksmi sonular srayla
+     * shift + XOR ile birletirilir (blok bana bir 32x32 matris-vektr arpm).
+     */
+    void update(ThreadPool& pool, const void* data, size_t n) {
+        state_ = crc_detail::update_parallel(pool, state_, static_cast<const uint8_t*>(data), n, &raw_update);
+    }
+
+    /// Gncel sonucu dndrr. Durumu deitirmez; update() ile devam edilebilir.
+    uint32_t finalize() const { return state_ ^ XorOut; }
+
+    void reset() { state_ = Init; }
+
+    /// Tek seferlik hesaplama ksayolu.
+    static uint32_t compute(const void* data, size_t n) {
+        ReflectedCrc crc;
+        crc.update(data, n);
+        return crc.finalize();
+    }
+
+    static uint32_t compute(ThreadPool& pool, const void* data, size_t n) {
+        ReflectedCrc crc;
+        crc.update(pool, data, n);
+        return crc.finalize();
+    }
+
+    /**
+     * @brief ki ayr hesaplanm CRC'yi birletirir (zlib crc32_combine karl).
+     * @param crc_a A verisinin CRC'si (compute/finalize sonucu).
+     * @param crc_b B verisinin CRC'si.
+     * @param len_b B'nin uzunluu (byte).
+     * @return A || B'nin CRC'si; A'ya yeniden dokunmadan, O(log len_b) srede.
+     */
+    static uint32_t combine(uint32_t crc_a, uint32_t crc_b, size_t len_b) {
+        // raw(I, A || B) = shift(raw(I, A) ^ I, |B|) ^ raw(I, B): Init katks B'de bir kez saylr.
+        return crc_detail::shift_state(crc_a ^ XorOut ^ Init, len_b, &raw_update) ^ crc_b;
+    }
+
+private:
+    static uint32_t raw_update(uint32_t state, const uint8_t* data, size_t n) {
+        return (Poly == crc_detail::kCastagnoli) ? crc_detail::update_crc32c(state, data, n)
+                                                 : crc_detail::update_slice8<Poly>(state, data, n);
+    }
+
+    uint32_t state_;
+};
+
+using Crc32c = ReflectedCrc<crc_detail::kCastagnoli, 0xFFFFFFFFu, 0xFFFFFFFFu>;
+using Crc32 = ReflectedCrc<0xEDB88320u, 0xFFFFFFFFu, 0xFFFFFFFFu>;
+using Crc16X25 = ReflectedCrc<0x8408u, 0xFFFFu, 0xFFFFu>;
+using Crc16Modbus = ReflectedCrc<0xA001u, 0xFFFFu, 0x0000u>;
+
+/// Seilen CRC32C ekirdeinin ad ("sse4.2" veya "slice8").
+const char* crc32c_kernel_name();
+
+#endif // CRC_H
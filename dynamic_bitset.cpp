@@ -0,0 +1,206 @@
+/**
+ * @file dynamic_bitset.cpp
+ * @brief DynamicBitset Toplu (Bulk) Kelime lemleri ve Tarama Implementasyonlar.
+ *
+ * Tek bit ilemleri ve for_each_set_bit satr ii (inline) olmalar iin
+ * 'dynamic_bitset.h' dosyasndadr. Buradaki kelime dngleri basit, bamsz
+ * iterasyonlardr; derleyici bunlar SIMD'e vektrleyebilir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "dynamic_bitset.h"
+#include "thread_pool.h" // ThreadPool::parallel_for, kParallelGrainBytes
+
+namespace {
+
+size_t words_for(size_t nbits) {
+	return (nbits + DynamicBitset::kWordBits - 1) / DynamicBitset::kWordBits;
+}
+
+// ki okuma + bir yazma ak iin blok:  akn toplam kParallelGrainBytes' amaz.
+const size_t kParallelGrainWords = kParallelGrainBytes / (3 * sizeof(uint64_t));
+
+template<typename Op>
+void combine_words(ThreadPool& pool, uint64_t* dst, const uint64_t* src, size_t n, Op op) {
+	pool.parallel_for(0, n, kParallelGrainWords, [&](size_t lo, size_t hi) {
+		for (size_t i = lo; i < hi; i++) dst[i] = op(dst[i], src[i]);
+	});
+}
+
+} // namespace
+
+// =========================================================================
+// I. BOYUT YNETM
+// =========================================================================
+
+DynamicBitset::DynamicBitset(size_t nbits, bool value)
+	: words_(words_for(nbits), value ? ~static_cast<uint64_t>(0) : 0), size_(nbits) {
+	clear_tail();
+}
+
+void DynamicBitset::resize(size_t nbits, bool value) {
+	const size_t old_size = size_;
+	words_.resize(words_for(nbits), value ? ~static_cast<uint64_t>(0) : 0);
+	size_ = nbits;
+	// Eski son kelimenin kullanlmayan (sfr) bitleri de yeni deerle doldurulmaldr.
+	if (value && nbits > old_size && old_size % kWordBits != 0) {
+		const int used = static_cast<int>(old_size % kWordBits);
+		uint64_t& word = words_[old_size / kWordBits];
+		word |= ReverseMask<uint64_t>(used, 0);
+	}
+	clear_tail();
+}
+
+void DynamicBitset::clear_tail() {
+	const int used = static_cast<int>(size_ % kWordBits);
+	if (used != 0) {
+		words_.back() &= CreateMask<uint64_t>(used, 0);
+	}
+}
+
+
+// =========================================================================
+// II. TOPLU LEMLER (BULK OPERATIONS)
+// =========================================================================
+
+void DynamicBitset::set_all() {
+	for (uint64_t& word : words_) word = ~static_cast<uint64_t>(0);
+	clear_tail();
+}
+
+void DynamicBitset::clear_all() {
+	for (uint64_t& word : words_) word = 0;
+}
+
+uint64_t DynamicBitset::count() const {
+	// Kuyruk bitleri deimez gerei sfr olduundan tm kelimeler dorudan saylr.
+	return count_set_bits(words_.data(), words_.size());
+}
+
+bool DynamicBitset::any() const {
+	for (uint64_t word : words_) {
+		if (word != 0) return true;
+	}
+	return false;
+}
+
+DynamicBitset& DynamicBitset::operator&=(const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	uint64_t* dst = words_.data();
+	const uint64_t* src = other.words_.data();
+	for (size_t i = 0; i < common; i++) dst[i] &= src[i];
+	for (size_t i = common; i < words_.size(); i++) dst[i] = 0;
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::operator|=(const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	uint64_t* dst = words_.data();
+	const uint64_t* src = other.words_.data();
+	for (size_t i = 0; i < common; i++) dst[i] |= src[i];
+	clear_tail();   // Dier kme daha uzunsa son ortak kelimede size() tesine bit tanabilir.
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::operator^=(const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	uint64_t* dst = words_.data();
+	const uint64_t* src = other.words_.data();
+	for (size_t i = 0; i < common; i++) dst[i] ^= src[i];
+	clear_tail();
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::and_not(const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	uint64_t* dst = words_.data();
+	const uint64_t* src = other.words_.data();
+	for (size_t i = 0; i < common; i++) dst[i] &= ~src[i];
+	return *this;
+}
+
+uint64_t DynamicBitset::count(ThreadPool& pool) const {
+	return count_set_bits(pool, words_.data(), words_.size());
+}
+
+// Paralel srmler: Ortak kelimeler havuzda, kalan kelimeler ve kuyruk seri yoldaki gibi.
+DynamicBitset& DynamicBitset::assign_and(ThreadPool& pool, const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	combine_words(pool, words_.data(), other.words_.data(), common, [](uint64_t a, uint64_t b) { return a & b; });
+	for (size_t i = common; i < words_.size(); i++) words_[i] = 0;
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::assign_or(ThreadPool& pool, const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	combine_words(pool, words_.data(), other.words_.data(), common, [](uint64_t a, uint64_t b) { return a | b; });
+	clear_tail();
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::assign_xor(ThreadPool& pool, const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	combine_words(pool, words_.data(), other.words_.data(), common, [](uint64_t a, uint64_t b) { return a ^ b; });
+	clear_tail();
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::and_not(ThreadPool& pool, const DynamicBitset& other) {
+	const size_t common = (words_.size() < other.words_.size()) ? words_.size() : other.words_.size();
+	combine_words(pool, words_.data(), other.words_.data(), common, [](uint64_t a, uint64_t b) { return a & ~b; });
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::operator<<=(size_t shift) {
+	ShiftLeft(words_.data(), words_.data(), size_, shift);
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::operator>>=(size_t shift) {
+	ShiftRight(words_.data(), words_.data(), size_, shift);
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::rotate_left(size_t shift) {
+	std::vector<uint64_t> rotated(words_.size());
+	RotateLeft(rotated.data(), words_.data(), size_, shift);
+	words_.swap(rotated);
+	return *this;
+}
+
+DynamicBitset& DynamicBitset::rotate_right(size_t shift) {
+	std::vector<uint64_t> rotated(words_.size());
+	RotateRight(rotated.data(), words_.data(), size_, shift);
+	words_.swap(rotated);
+	return *this;
+}
+
+
+// =========================================================================
+// III. TARAMA (SCAN)
+// =========================================================================
+
+size_t DynamicBitset::find_from_word(size_t word_index) const {
+	for (size_t i = word_index; i < words_.size(); i++) {
+		if (words_[i] != 0) {
+			return i * kWordBits + static_cast<size_t>(find_first_set_bit(words_[i]));
+		}
+	}
+	return npos;
+}
+
+size_t DynamicBitset::find_next(size_t pos) const {
+	const size_t next = pos + 1;
+	if (next >= size_) return npos;
+	const size_t word_index = next / kWordBits;
+	// Mevcut kelimede pos ve ncesindeki bitler maskelenir.
+	const uint64_t word = words_[word_index] & ~CreateMask<uint64_t>(static_cast<int>(next % kWordBits), 0);
+	if (word != 0) {
+		return word_index * kWordBits + static_cast<size_t>(find_first_set_bit(word));
+	}
+	return find_from_word(word_index + 1);
+}
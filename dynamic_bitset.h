@@ -0,0 +1,182 @@
+/**
+ * @file dynamic_bitset.h
+ * @brief uint64_t Kelimeleriyle Desteklenen, alma Zamannda Boyutlanan Bit Kmesi.
+ *
+ * bitops.h ilemleri tek bir register (en fazla 64 bit) ile snrldr. Bu snf milyonlarca
+ * bayraktan oluan kmeleri 64-bit kelimelere bler; tek bit ilemleri kelime/bit
+ * indekslemesiyle SetRegBit/ClearRegBit/isBitSet'e, sayma ilemi ise tampon (bulk)
+ * count_set_bits ekirdeine indirgenir.
+ *
+ * Deimez (invariant): Son kelimenin size() tesindeki bitleri daima '0'dr. Bylece
+ * count() ve for_each_set_bit() kuyruk maskesi uygulamadan tm kelimeleri ileyebilir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef DYNAMIC_BITSET_H
+#define DYNAMIC_BITSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "bitops.h" // SetRegBit, ClearRegBit, ToggleRegBit, isBitSet, find_first_set_bit, count_set_bits, ShiftLeft
+
+class ThreadPool;   // thread_pool.h
+
+/**
+ * @brief Dinamik boyutlu bit kmesi.
+ *
+ * Bit i, (i / 64). kelimenin (i % 64). bitidir (LSB tabanl). Snr kontrol yaplmaz;
+ * indeksler [0, size()) aralnda olmaldr.
+ */
+class DynamicBitset {
+public:
+    static constexpr size_t kWordBits = 64;
+    /// find_first / find_next iin "bulunamad" deeri.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    DynamicBitset() : size_(0) {}
+
+    /**
+     * @param nbits Bit says.
+     * @param value Tm bitlerin balang deeri.
+     */
+    explicit DynamicBitset(size_t nbits, bool value = false);
+
+    /**
+     * @brief Boyutu deitirir. Yeni eklenen bitler 'value' ile doldurulur.
+     * @param nbits Yeni bit says.
+     * @param value Eklenen bitlerin deeri.
+     */
+    void resize(size_t nbits, bool value = false);
+
+    size_t size() const { return size_; }
+    size_t word_count() const { return words_.size(); }
+
+    /// Ham kelime eriimi (rn: seri hale getirme veya SIMD ekirdekleri iin).
+    const uint64_t* data() const { return words_.data(); }
+    uint64_t* data() { return words_.data(); }
+
+    // --- Tek bit ilemleri (kelime/bit indeksleme) ---
+
+    void set(size_t pos) {
+        uint64_t& word = words_[pos / kWordBits];
+        word = SetRegBit(word, static_cast<int>(pos % kWordBits));
+    }
+
+    void clear(size_t pos) {
+        uint64_t& word = words_[pos / kWordBits];
+        word = ClearRegBit(word, static_cast<int>(pos % kWordBits));
+    }
+
+    void flip(size_t pos) {
+        uint64_t& word = words_[pos / kWordBits];
+        word = ToggleRegBit(word, static_cast<int>(pos % kWordBits));
+    }
+
+    void assign(size_t pos, bool value) {
+        if (value) set(pos); else clear(pos);
+    }
+
+    bool test(size_t pos) const {
+        return isBitSet(words_[pos / kWordBits], static_cast<int>(pos % kWordBits));
+    }
+
+    // --- Toplu ilemler ---
+
+    /// Tm bitleri '1' yapar (kuyruk bitleri hari).
+    void set_all();
+    /// Tm bitleri '0' yapar.
+    void clear_all();
+
+    /// '1' olan bit says (dispatch edilmi bulk popcount).
+    uint64_t count() const;
+    /// En az bir bit '1' mi? lk '1' kelimede durur.
+    bool any() const;
+    bool none() const { return !any(); }
+
+    /**
+     * MHENDSLK NOTU (Boyut uyumazl): Kelime bazl ilemlerde ksa olan operandn
+     * eksik bitleri '0' kabul edilir; *this'in boyutu deimez. Yani AND, dier kmenin
+     * tesindeki kelimeleri sfrlar; OR/XOR/ANDNOT ise onlar olduu gibi brakr.
+     */
+    DynamicBitset& operator&=(const DynamicBitset& other);
+    DynamicBitset& operator|=(const DynamicBitset& other);
+    DynamicBitset& operator^=(const DynamicBitset& other);
+    /// *this &= ~other (kme fark). Ara bir ~other kmesi oluturmaz.
+    DynamicBitset& and_not(const DynamicBitset& other);
+
+    /**
+     * @brief count() ve kelime bazl ilemlerin paralel srmleri (thread_pool.h).
+     *
+     * Ortak kelimeler kParallelGrainBytes'lk bloklarda havuzda ilenir; boyut uyumazl
+     * kurallar ve sonu, seri ilelerle bit bit ayndr. other, *this ile ayn nesne olabilir.
+     */
+    uint64_t count(ThreadPool& pool) const;
+    DynamicBitset& assign_and(ThreadPool& pool, const DynamicBitset& other);
+    DynamicBitset& assign_or(ThreadPool& pool, const DynamicBitset& other);
+    DynamicBitset& assign_xor(ThreadPool& pool, const DynamicBitset& other);
+    DynamicBitset& and_not(ThreadPool& pool, const DynamicBitset& other);
+
+    /**
+     * @brief Tm kmeyi kaydrr/dndrr (bitops.h'deki tampon ShiftLeft/RotateLeft ekirdekleri).
+     *
+     * Sola kaydrma bit i'yi i + shift'e tar (alttan '0' girer, size() tesi der); saa
+     * kaydrma tersidir. Dndrme size() bit iinde sarar ve geici bir kelime tamponu
+     * ayrr; kaydrmalar yerinde alr. Her miktar (0, >= size()) geerlidir.
+     */
+    DynamicBitset& operator<<=(size_t shift);
+    DynamicBitset& operator>>=(size_t shift);
+    DynamicBitset& rotate_left(size_t shift);
+    DynamicBitset& rotate_right(size_t shift);
+
+    bool operator==(const DynamicBitset& other) const {
+        return size_ == other.size_ && words_ == other.words_;
+    }
+    bool operator!=(const DynamicBitset& other) const { return !(*this == other); }
+
+    // --- Tarama (scan) ---
+
+    /// lk '1' bitin indeksi; yoksa npos.
+    size_t find_first() const { return find_from_word(0); }
+
+    /**
+     * @brief pos'tan SONRAK ilk '1' bitin indeksi.
+     * @param pos Balang (hari) indeksi.
+     * @return Bulunan indeks veya npos.
+     */
+    size_t find_next(size_t pos) const;
+
+    /**
+     * @brief Her '1' bit iin fn(index) arr (artan srada).
+     *
+     * Maliyet O(bit says) deil, O(kelime says + '1' bit says)'dr: Bo kelimeler
+     * tek karlatrmayla atlanr; dolu kelimede en dk '1' bit find_first_set_bit
+     * ile bulunur ve x & (x - 1) ile silinir.
+     *
+     * @tparam Fn void(size_t) imzal arlabilir nesne.
+     */
+    template<typename Fn>
+    void for_each_set_bit(Fn fn) const {
+        const size_t n = words_.size();
+        for (size_t i = 0; i < n; i++) {
+            uint64_t word = words_[i];
+            while (word != 0) {
+                fn(i * kWordBits + static_cast<size_t>(find_first_set_bit(word)));
+                word &= word - 1;   // En dk '1' biti sil.
+            }
+        }
+    }
+
+private:
+    size_t find_from_word(size_t word_index) const;
+    void clear_tail();  // Deimezi korur: size() tesindeki bitleri sfrlar.
+
+    std::vector<uint64_t> words_;
+    size_t size_;
+};
+
+#endif // DYNAMIC_BITSET_H
@@ -0,0 +1,414 @@
+/**
+ * @file fir_filter.cpp
+ * @brief FIR Filtre Motoru Implementasyonu:  arpm ekirdekleri (Skaler / SSE4.1 / AVX2).
+ *
+ * Filtre snflar ablondur ve yalnzca Q15 (int16_t) ile Q31 (int32_t) iin bu dosyada
+ * aka rneklenir (explicit instantiation).
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "fir_filter.h"
+#include "bitops.h"     // CreateMask, find_first_set_bit, bitops_cpu_features
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define FIR_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define FIR_X86_SIMD 0
+#endif
+
+namespace {
+
+// =========================================================================
+// I.  ARPIM EKRDEKLER (DOT PRODUCT KERNELS)
+// =========================================================================
+
+// Q31 arpmlar (Q62) toplanmadan nce aritmetik olarak saa kaydrlr (Q46): Tam lekli
+// iki rnein arpm en fazla 2^46 olur ve int64_t toplam 2^17 arpma kadar tamaz.
+constexpr int kQ31ProductShift = 16;
+
+// Skaler referans: Tm SIMD ekirdekleri bununla bit dzeyinde ayn sonucu verir
+// (arpm bana kaydrma kesindir, tamsay toplam sradan bamszdr).
+int64_t dot_q15_scalar(const int16_t* h, const int16_t* x, size_t n) {
+	int64_t acc = 0;
+	for (size_t i = 0; i < n; i++) acc += static_cast<int32_t>(h[i]) * x[i];
+	return acc;
+}
+
+int64_t dot_q31_scalar(const int32_t* h, const int32_t* x, size_t n) {
+	int64_t acc = 0;
+	for (size_t i = 0; i < n; i++) acc += (static_cast<int64_t>(h[i]) * x[i]) >> kQ31ProductShift;
+	return acc;
+}
+
+// Blok yolu: Ardk 4 k (pencereler birer rnek kaydrlm) tek geite hesaplanr;
+// her katsay bir kez yklenir ve drt pencereyle arplr (register blocking).
+template<typename Sample, int Shift>
+void dot4_scalar(const Sample* h, const Sample* x, size_t n, int64_t* acc) {
+	int64_t a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+	for (size_t i = 0; i < n; i++) {
+		const int64_t c = h[i];
+		a0 += (c * x[i]) >> Shift;
+		a1 += (c * x[i + 1]) >> Shift;
+		a2 += (c * x[i + 2]) >> Shift;
+		a3 += (c * x[i + 3]) >> Shift;
+	}
+	acc[0] = a0; acc[1] = a1; acc[2] = a2; acc[3] = a3;
+}
+
+#if FIR_X86_SIMD
+
+/**
+ * MHENDSLK NOTU (Q15): PMADDWD 16-bit arpmlar ikier toplayp int32 retir. ki
+ * -32768 * -32768 arpmnn toplam (2^31) int32'yi tarr; bu yzden -32768 katsays
+ * kurulumda -32767'ye krplr (bkz. clamp_coeff), bylece madd hibir girdide tamaz.
+ * madd sonular her iterasyonda iaret geniletilerek (PMOVSXDQ) int64 akmlatrlere eklenir.
+ * Q31'de PMULDQ her 64-bit eridin alt 32 bitini arpar; tek eritler 32 bit saa
+ * kaydrlarak ikinci bir PMULDQ ile ilenir. SSE4.1/AVX2'de 64-bit aritmetik kaydrma
+ * (VPSRAQ) yoktur: arpm mantksal kaydrlr ve kalan 48 bitlik deerin iareti
+ * (t ^ m) - m ile geniletilir (m = 2^47); sonu skaler '>>' ile birebir ayndr.
+ */
+__attribute__((target("sse4.1")))
+inline __m128i shift_product_sse41(__m128i p) {
+	const __m128i sign = _mm_set1_epi64x(static_cast<int64_t>(1) << (63 - kQ31ProductShift));
+	return _mm_sub_epi64(_mm_xor_si128(_mm_srli_epi64(p, kQ31ProductShift), sign), sign);
+}
+
+__attribute__((target("avx2")))
+inline __m256i shift_product_avx2(__m256i p) {
+	const __m256i sign = _mm256_set1_epi64x(static_cast<int64_t>(1) << (63 - kQ31ProductShift));
+	return _mm256_sub_epi64(_mm256_xor_si256(_mm256_srli_epi64(p, kQ31ProductShift), sign), sign);
+}
+
+__attribute__((target("sse4.1")))
+int64_t dot_q15_sse41(const int16_t* h, const int16_t* x, size_t n) {
+	__m128i acc = _mm_setzero_si128();
+	for (size_t i = 0; i < n; i += 8) {
+		const __m128i p = _mm_madd_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i)),
+		                                 _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i)));
+		acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(p));
+		acc = _mm_add_epi64(acc, _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+	}
+	return _mm_cvtsi128_si64(acc) + _mm_extract_epi64(acc, 1);
+}
+
+__attribute__((target("sse4.1")))
+int64_t dot_q31_sse41(const int32_t* h, const int32_t* x, size_t n) {
+	__m128i acc = _mm_setzero_si128();
+	for (size_t i = 0; i < n; i += 4) {
+		const __m128i hv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+		const __m128i xv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i));
+		const __m128i even = _mm_mul_epi32(hv, xv);                                          // erit 0, 2.
+		const __m128i odd = _mm_mul_epi32(_mm_srli_epi64(hv, 32), _mm_srli_epi64(xv, 32));   // erit 1, 3.
+		acc = _mm_add_epi64(acc, shift_product_sse41(even));
+		acc = _mm_add_epi64(acc, shift_product_sse41(odd));
+	}
+	return _mm_cvtsi128_si64(acc) + _mm_extract_epi64(acc, 1);
+}
+
+__attribute__((target("avx2")))
+int64_t hsum_epi64_avx2(__m256i v) {
+	const __m128i s = _mm_add_epi64(_mm256_castsi256_si128(v), _mm256_extracti128_si256(v, 1));
+	return _mm_cvtsi128_si64(s) + _mm_extract_epi64(s, 1);
+}
+
+__attribute__((target("avx2")))
+int64_t dot_q15_avx2(const int16_t* h, const int16_t* x, size_t n) {
+	__m256i acc = _mm256_setzero_si256();
+	for (size_t i = 0; i < n; i += 16) {
+		const __m256i p = _mm256_madd_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i)),
+		                                    _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i)));
+		acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(p)));
+		acc = _mm256_add_epi64(acc, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(p, 1)));
+	}
+	return hsum_epi64_avx2(acc);
+}
+
+__attribute__((target("avx2")))
+int64_t dot_q31_avx2(const int32_t* h, const int32_t* x, size_t n) {
+	__m256i acc = _mm256_setzero_si256();
+	for (size_t i = 0; i < n; i += 8) {
+		const __m256i hv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i));
+		const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+		acc = _mm256_add_epi64(acc, shift_product_avx2(_mm256_mul_epi32(hv, xv)));
+		acc = _mm256_add_epi64(acc, shift_product_avx2(_mm256_mul_epi32(_mm256_srli_epi64(hv, 32), _mm256_srli_epi64(xv, 32))));
+	}
+	return hsum_epi64_avx2(acc);
+}
+
+__attribute__((target("sse4.1")))
+void dot4_q15_sse41(const int16_t* h, const int16_t* x, size_t n, int64_t* acc) {
+	__m128i a[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+	for (size_t i = 0; i < n; i += 8) {
+		const __m128i hv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+		for (int j = 0; j < 4; j++) {
+			const __m128i p = _mm_madd_epi16(hv, _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i + j)));
+			a[j] = _mm_add_epi64(a[j], _mm_cvtepi32_epi64(p));
+			a[j] = _mm_add_epi64(a[j], _mm_cvtepi32_epi64(_mm_srli_si128(p, 8)));
+		}
+	}
+	for (int j = 0; j < 4; j++) acc[j] = _mm_cvtsi128_si64(a[j]) + _mm_extract_epi64(a[j], 1);
+}
+
+__attribute__((target("sse4.1")))
+void dot4_q31_sse41(const int32_t* h, const int32_t* x, size_t n, int64_t* acc) {
+	__m128i a[4] = { _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128() };
+	for (size_t i = 0; i < n; i += 4) {
+		const __m128i hv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(h + i));
+		const __m128i hodd = _mm_srli_epi64(hv, 32);
+		for (int j = 0; j < 4; j++) {
+			const __m128i xv = _mm_loadu_si128(reinterpret_cast<const __m128i*>(x + i + j));
+			a[j] = _mm_add_epi64(a[j], shift_product_sse41(_mm_mul_epi32(hv, xv)));
+			a[j] = _mm_add_epi64(a[j], shift_product_sse41(_mm_mul_epi32(hodd, _mm_srli_epi64(xv, 32))));
+		}
+	}
+	for (int j = 0; j < 4; j++) acc[j] = _mm_cvtsi128_si64(a[j]) + _mm_extract_epi64(a[j], 1);
+}
+
+__attribute__((target("avx2")))
+void dot4_q15_avx2(const int16_t* h, const int16_t* x, size_t n, int64_t* acc) {
+	__m256i a[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+	for (size_t i = 0; i < n; i += 16) {
+		const __m256i hv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i));
+		for (int j = 0; j < 4; j++) {
+			const __m256i p = _mm256_madd_epi16(hv, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + j)));
+			a[j] = _mm256_add_epi64(a[j], _mm256_cvtepi32_epi64(_mm256_castsi256_si128(p)));
+			a[j] = _mm256_add_epi64(a[j], _mm256_cvtepi32_epi64(_mm256_extracti128_si256(p, 1)));
+		}
+	}
+	for (int j = 0; j < 4; j++) acc[j] = hsum_epi64_avx2(a[j]);
+}
+
+__attribute__((target("avx2")))
+void dot4_q31_avx2(const int32_t* h, const int32_t* x, size_t n, int64_t* acc) {
+	__m256i a[4] = { _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256() };
+	for (size_t i = 0; i < n; i += 8) {
+		const __m256i hv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(h + i));
+		const __m256i hodd = _mm256_srli_epi64(hv, 32);
+		for (int j = 0; j < 4; j++) {
+			const __m256i xv = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + j));
+			a[j] = _mm256_add_epi64(a[j], shift_product_avx2(_mm256_mul_epi32(hv, xv)));
+			a[j] = _mm256_add_epi64(a[j], shift_product_avx2(_mm256_mul_epi32(hodd, _mm256_srli_epi64(xv, 32))));
+		}
+	}
+	for (int j = 0; j < 4; j++) acc[j] = hsum_epi64_avx2(a[j]);
+}
+
+#endif // FIR_X86_SIMD
+
+struct FirDispatch {
+	int64_t (*dot_q15)(const int16_t*, const int16_t*, size_t);
+	int64_t (*dot_q31)(const int32_t*, const int32_t*, size_t);
+	void (*dot4_q15)(const int16_t*, const int16_t*, size_t, int64_t*);
+	void (*dot4_q31)(const int32_t*, const int32_t*, size_t, int64_t*);
+	const char* name;
+};
+
+const FirDispatch kScalarKernels = {
+	dot_q15_scalar, dot_q31_scalar, dot4_scalar<int16_t, 0>, dot4_scalar<int32_t, kQ31ProductShift>, "scalar"
+};
+#if FIR_X86_SIMD
+const FirDispatch kSse41Kernels = { dot_q15_sse41, dot_q31_sse41, dot4_q15_sse41, dot4_q31_sse41, "sse4.1" };
+const FirDispatch kAvx2Kernels = { dot_q15_avx2, dot_q31_avx2, dot4_q15_avx2, dot4_q31_avx2, "avx2" };
+#endif
+
+// Bu ilemcide alabilen ekirdekler, skaler referans bata olmak zere; dn: adet.
+size_t available_kernels(const FirDispatch** out) {
+	size_t count = 0;
+	out[count++] = &kScalarKernels;
+#if FIR_X86_SIMD
+	const BitopsCpuFeatures& f = bitops_cpu_features();
+	if (f.sse4_1) out[count++] = &kSse41Kernels;
+	if (f.avx2) out[count++] = &kAvx2Kernels;
+#endif
+	return count;
+}
+
+FirDispatch build_fir_dispatch() {
+	const FirDispatch* kernels[3];
+	return *kernels[available_kernels(kernels) - 1];    // En geni ekirdek.
+}
+
+int64_t kernel_dot(const FirDispatch& d, const int16_t* h, const int16_t* x, size_t n) { return d.dot_q15(h, x, n); }
+int64_t kernel_dot(const FirDispatch& d, const int32_t* h, const int32_t* x, size_t n) { return d.dot_q31(h, x, n); }
+void kernel_dot4(const FirDispatch& d, const int16_t* h, const int16_t* x, size_t n, int64_t* acc) { d.dot4_q15(h, x, n, acc); }
+void kernel_dot4(const FirDispatch& d, const int32_t* h, const int32_t* x, size_t n, int64_t* acc) { d.dot4_q31(h, x, n, acc); }
+
+const FirDispatch& fir_dispatch() {
+	static const FirDispatch d = build_fir_dispatch();
+	return d;
+}
+
+// Q15: -1.0 (-32768) katsays -32767'ye krplr (PMADDWD tama korumas, hata 2^-15).
+// Skaler ekirdek de ayn katsaylar kullandndan tm ekirdekler ayn sonucu verir.
+int16_t clamp_coeff(int16_t c) { return (c == INT16_MIN) ? static_cast<int16_t>(INT16_MIN + 1) : c; }
+int32_t clamp_coeff(int32_t c) { return c; }
+
+// Q46 toplamn 1.0'a doyurup Q62 akmlatre geniletir. 1.0 tesi kta zaten Q31
+// snrna doyurulduundan sonu deimez; from_accumulator'n yuvarlama toplamas tamaz.
+int64_t q31_accumulator(int64_t acc) {
+	const int64_t one = static_cast<int64_t>(1) << (62 - kQ31ProductShift);
+	acc = (acc > one) ? one : (acc < -one) ? -one : acc;
+	return acc * (static_cast<int64_t>(1) << kQ31ProductShift);
+}
+
+size_t padded_taps(size_t taps) {
+	return (taps + fir_detail::kTapAlign - 1) / fir_detail::kTapAlign * fir_detail::kTapAlign;
+}
+
+} // namespace
+
+
+// =========================================================================
+// II. ORTAK YAPI TALARI (fir_detail)
+// =========================================================================
+
+int64_t fir_detail::dot(const int16_t* coeffs, const int16_t* window, size_t n) {
+	return fir_dispatch().dot_q15(coeffs, window, n);
+}
+
+int64_t fir_detail::dot(const int32_t* coeffs, const int32_t* window, size_t n) {
+	return q31_accumulator(fir_dispatch().dot_q31(coeffs, window, n));
+}
+
+void fir_detail::dot4(const int16_t* coeffs, const int16_t* window, size_t n, int64_t* acc) {
+	fir_dispatch().dot4_q15(coeffs, window, n, acc);
+}
+
+void fir_detail::dot4(const int32_t* coeffs, const int32_t* window, size_t n, int64_t* acc) {
+	fir_dispatch().dot4_q31(coeffs, window, n, acc);
+	for (int j = 0; j < 4; j++) acc[j] = q31_accumulator(acc[j]);
+}
+
+template<typename Sample>
+size_t fir_detail::dot_kernel_mismatches(const Sample* coeffs, const Sample* window, size_t n) {
+	const FirDispatch* kernels[3];
+	const size_t count = available_kernels(kernels);
+	int64_t expected[5];
+	expected[0] = kernel_dot(*kernels[0], coeffs, window, n);
+	kernel_dot4(*kernels[0], coeffs, window, n, expected + 1);
+	size_t mismatches = 0;
+	for (size_t k = 1; k < count; k++) {
+		int64_t got[5];
+		got[0] = kernel_dot(*kernels[k], coeffs, window, n);
+		kernel_dot4(*kernels[k], coeffs, window, n, got + 1);
+		for (int j = 0; j < 5; j++) mismatches += (got[j] != expected[j]);
+	}
+	return mismatches;
+}
+
+template<typename Sample>
+fir_detail::DelayLine<Sample>::DelayLine(size_t length) : pos_(0) {
+	capacity_ = 1;
+	while (capacity_ < length) capacity_ <<= 1;
+	mask_ = static_cast<size_t>(CreateMask<uint64_t>(find_first_set_bit(static_cast<uint64_t>(capacity_)), 0));
+	buffer_.assign(capacity_ * 2, 0);   // Ayna dzeni: [0, C) ve [C, 2C) ayn ierik.
+}
+
+template<typename Sample>
+void fir_detail::DelayLine<Sample>::reset() {
+	for (Sample& s : buffer_) s = 0;
+	pos_ = 0;
+}
+
+template<typename Sample>
+std::vector<Sample> fir_detail::reverse_and_pad(const Sample* coeffs, size_t taps) {
+	const size_t padded = padded_taps(taps);
+	std::vector<Sample> out(padded, 0);
+	// Pencerenin sonu (en yeni rnek) h[0] ile arplr; bataki dolgu sfrlar en eski rneklere der.
+	for (size_t k = 0; k < taps; k++) out[padded - 1 - k] = clamp_coeff(coeffs[k]);
+	return out;
+}
+
+
+// =========================================================================
+// III. TEK HIZLI FIR
+// =========================================================================
+
+template<typename Sample>
+FirFilter<Sample>::FirFilter(const Sample* coeffs, size_t taps)
+	: taps_(taps), coeffs_(fir_detail::reverse_and_pad(coeffs, taps)), delay_(coeffs_.size() + kBlockOutputs - 1) {}
+
+template<typename Sample>
+void FirFilter<Sample>::process(const Sample* in, Sample* out, size_t n) {
+	const size_t len = coeffs_.size();
+	const Sample* h = coeffs_.data();
+	size_t i = 0;
+	// 4'l bloklar: Drt girdi yazlr, drt kn pencereleri tek bir bitiik aralktr.
+	for (; i + kBlockOutputs <= n; i += kBlockOutputs) {
+		for (size_t j = 0; j < kBlockOutputs; j++) delay_.push(in[i + j]);
+		int64_t acc[kBlockOutputs];
+		fir_detail::dot4(h, delay_.window(len + kBlockOutputs - 1), len, acc);
+		for (size_t j = 0; j < kBlockOutputs; j++) out[i + j] = FixedPointTraits<Sample>::from_accumulator(acc[j]);
+	}
+	for (; i < n; i++) out[i] = process_sample(in[i]);
+}
+
+
+// =========================================================================
+// IV. POLFAZ DESMASYON / NTERPOLASYON
+// =========================================================================
+
+template<typename Sample>
+FirDecimator<Sample>::FirDecimator(const Sample* coeffs, size_t taps, size_t factor)
+	: factor_(factor), phase_(0), coeffs_(fir_detail::reverse_and_pad(coeffs, taps)), delay_(coeffs_.size()) {}
+
+template<typename Sample>
+size_t FirDecimator<Sample>::process(const Sample* in, size_t n, Sample* out) {
+	const size_t len = coeffs_.size();
+	const Sample* h = coeffs_.data();
+	size_t produced = 0;
+	for (size_t i = 0; i < n; i++) {
+		delay_.push(in[i]);
+		if (phase_ == 0) {
+			out[produced++] = FixedPointTraits<Sample>::from_accumulator(fir_detail::dot(h, delay_.window(len), len));
+			phase_ = factor_;
+		}
+		phase_--;
+	}
+	return produced;
+}
+
+template<typename Sample>
+FirInterpolator<Sample>::FirInterpolator(const Sample* coeffs, size_t taps, size_t factor)
+	: factor_(factor), phase_taps_(padded_taps((taps + factor - 1) / factor)), delay_(phase_taps_) {
+	phases_.assign(phase_taps_ * factor_, 0);
+	for (size_t p = 0; p < factor_; p++) {
+		// p. alt filtre: h[p], h[p + L], h[p + 2L], ... ters srada; dolgu sfrlar baa (en eski rneklere).
+		Sample* sub = phases_.data() + p * phase_taps_;
+		size_t j = 0;
+		for (size_t k = p; k < taps; k += factor_, j++) sub[phase_taps_ - 1 - j] = clamp_coeff(coeffs[k]);
+	}
+}
+
+template<typename Sample>
+void FirInterpolator<Sample>::process(const Sample* in, size_t n, Sample* out) {
+	for (size_t i = 0; i < n; i++) {
+		delay_.push(in[i]);
+		const Sample* window = delay_.window(phase_taps_);
+		for (size_t p = 0; p < factor_; p++) {
+			*out++ = FixedPointTraits<Sample>::from_accumulator(
+				fir_detail::dot(phases_.data() + p * phase_taps_, window, phase_taps_));
+		}
+	}
+}
+
+const char* fir_kernel_name() {
+	return fir_dispatch().name;
+}
+
+// Ak rnekleme (explicit instantiation): Q15 ve Q31.
+template size_t fir_detail::dot_kernel_mismatches(const int16_t*, const int16_t*, size_t);
+template size_t fir_detail::dot_kernel_mismatches(const int32_t*, const int32_t*, size_t);
+template class fir_detail::DelayLine<int16_t>;
+template class fir_detail::DelayLine<int32_t>;
+template class FirFilter<int16_t>;
+template class FirFilter<int32_t>;
+template class FirDecimator<int16_t>;
+template class FirDecimator<int32_t>;
+template class FirInterpolator<int16_t>;
+template class FirInterpolator<int32_t>;
@@ -0,0 +1,236 @@
+/**
+ * @file fir_filter.h
+ * @brief Q15 / Q31 Blok FIR Filtre Motoru (Tek Hzl, Polifaz Desimasyon ve nterpolasyon).
+ *
+ * rnek bana skaler filtreleme ok kanall rnekleme hzlarna yetiemez. Bu modl:
+ * - Girdiyi blok (span) halinde iler,
+ * - Gecikme hattn (delay line) 2'nin kuvveti kapasiteli dairesel tampon olarak tutar
+ *   (indeks sarmas CreateMask ile retilen AND maskesiyle yaplr),
+ * - arpm toplamlarn int64_t akmlatrde tamadan biriktirir, sonucu yuvarlayp doyurur,
+ * -  arpm (dot product) AVX2 / SSE4.1 / skaler ekirdeklerden biriyle hesaplar
+ *   (ekirdek program balangcnda bitops_cpu_features() ile bir kez seilir).
+ *
+ * Katsaylar rneklerle ayn Q formatndadr. Kanal bana bir filtre nesnesi kullanlr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef FIR_FILTER_H
+#define FIR_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "fixed_point.h"
+
+namespace fir_detail {
+
+/// SIMD ekirdeklerinin bir iterasyonda iledii rnek says; katsaylar bu katlara tamamlanr.
+constexpr size_t kTapAlign = 16;
+
+/**
+ * @brief Ayna (mirror) dzenli dairesel gecikme hatt.
+ *
+ * Her rnek hem i hem de i + Capacity konumuna yazlr. Bylece son 'length' rnek,
+ * sarma noktasndan bamsz olarak daima bellekte bitiiktir (contiguous) ve SIMD
+ * ekirdekleri pencereyi kopyalamadan tek geite okur. Kapasite 2'nin kuvvetidir;
+ * yazma indeksi '& mask' ile sarlr.
+ */
+template<typename Sample>
+class DelayLine {
+public:
+    /// @param length Tek seferde okunacak en uzun pencere (rnek).
+    explicit DelayLine(size_t length);
+
+    void push(Sample x) {
+        buffer_[pos_] = x;
+        buffer_[pos_ + capacity_] = x;
+        pos_ = (pos_ + 1) & mask_;
+    }
+
+    /// Son 'length' rnein en eskisini gsteren iareti (en yeni: window(length)[length - 1]).
+    const Sample* window(size_t length) const {
+        return buffer_.data() + ((pos_ + capacity_ - length) & mask_);
+    }
+
+    void reset();
+
+private:
+    std::vector<Sample> buffer_;
+    size_t capacity_;
+    size_t mask_;
+    size_t pos_;
+};
+
+/**
+ * @brief Dispatch edilmi i arpm: sum(coeffs[i] * window[i]), i < n.
+ * @param n kTapAlign'n kat olmaldr.
+ * @return Q(2 * kFracBits) formatnda akmlatr.
+ */
+int64_t dot(const int16_t* coeffs, const int16_t* window, size_t n);
+int64_t dot(const int32_t* coeffs, const int32_t* window, size_t n);
+
+/// Birer rnek kaydrlm drt pencere iin i arpm: acc[j] = sum(coeffs[i] * window[i + j]).
+void dot4(const int16_t* coeffs, const int16_t* window, size_t n, int64_t* acc);
+void dot4(const int32_t* coeffs, const int32_t* window, size_t n, int64_t* acc);
+
+/**
+ * @brief Bu ilemcide alabilen her SIMD ekirdeinin dot ve dot4 sonucunu skaler
+ * ekirdekle karlatrr (test ve tehis amal).
+ * @param window En az n + 3 rnek.
+ * @param n kTapAlign'n kat olmaldr.
+ * @return Skalerden farkl kan sonu says (0 beklenir).
+ */
+template<typename Sample>
+size_t dot_kernel_mismatches(const Sample* coeffs, const Sample* window, size_t n);
+
+/// Katsaylar ters evirip (en yeni rnekle h[0] eleir) baa sfr ekleyerek kTapAlign katna tamamlar.
+template<typename Sample>
+std::vector<Sample> reverse_and_pad(const Sample* coeffs, size_t taps);
+
+} // namespace fir_detail
+
+
+// =========================================================================
+// I. TEK HIZLI FIR (SINGLE-RATE FIR)
+// =========================================================================
+
+/**
+ * @brief Sabit noktal FIR filtre: y[n] = sum(h[k] * x[n - k]).
+ *
+ * MHENDSLK NOTU (Akmlatr): Q15'te arpmlar Q30'dur; int64_t akmlatr 33 koruma
+ * biti salar, pratikte tamaz. Q31'de arpmlar Q62'dir ve tam lekli  arpm bile
+ * 2^63' aar; bu yzden her arpm toplanmadan nce 16 bit aritmetik saa kaydrlr
+ * (Q46, 17 koruma biti). Tam lekli girdi ve ~1.0 katsaylarda da toplam, (tamamlanm)
+ * katsay says 2^17'yi amadka tamaz; kesilen bitler k LSB'sinin 2^-15'i
+ * mertebesindedir. Her iki durumda da k rnek tipine dnrken doyurulur. Q15'te
+ * -1.0 (-32768) katsays -32767 olarak saklanr.
+ *
+ * @tparam Sample int16_t (Q15) veya int32_t (Q31).
+ */
+template<typename Sample>
+class FirFilter {
+public:
+    /**
+     * @param coeffs Katsaylar h[0..taps-1] (Q15/Q31).
+     * @param taps Katsay says (en az 1).
+     */
+    FirFilter(const Sample* coeffs, size_t taps);
+
+    /// Tek bir rnei filtreler.
+    Sample process_sample(Sample x) {
+        delay_.push(x);
+        return FixedPointTraits<Sample>::from_accumulator(
+            fir_detail::dot(coeffs_.data(), delay_.window(coeffs_.size()), coeffs_.size()));
+    }
+
+    /**
+     * @brief Bir girdi blounu filtreler. 'in' ve 'out' ayn tampon olabilir (yerinde).
+     * @param in Girdi rnekleri.
+     * @param out kt rnekleri (n adet).
+     * @param n rnek says.
+     */
+    void process(const Sample* in, Sample* out, size_t n);
+
+    /// Gecikme hattn sfrlar (katsaylar korunur).
+    void reset() { delay_.reset(); }
+
+    size_t taps() const { return taps_; }
+
+private:
+    static constexpr size_t kBlockOutputs = 4;  ///< process() blounda tek geite hesaplanan k.
+
+    size_t taps_;
+    std::vector<Sample> coeffs_;            ///< Ters evrilmi, kTapAlign katna tamamlanm.
+    fir_detail::DelayLine<Sample> delay_;
+};
+
+
+// =========================================================================
+// II. POLFAZ DESMASYON / NTERPOLASYON (POLYPHASE MULTIRATE)
+// =========================================================================
+
+/**
+ * @brief FIR alak geiren + M kat seyreltme (decimation).
+ *
+ * Her girdi gecikme hattna yazlr; i arpm yalnzca tutulan (her M. girdi) klar
+ * iin hesaplanr. Bu, M polifaz alt filtresinin toplamyla edeerdir ve girdi bana
+ * maliyeti taps / M arpma indirir. Faz, bloklar arasnda korunur.
+ */
+template<typename Sample>
+class FirDecimator {
+public:
+    /**
+     * @param coeffs Alak geiren katsaylar.
+     * @param taps Katsay says.
+     * @param factor Seyreltme oran M (en az 1).
+     */
+    FirDecimator(const Sample* coeffs, size_t taps, size_t factor);
+
+    /**
+     * @brief Bir girdi blounu iler.
+     * @param in Girdi rnekleri.
+     * @param n Girdi says.
+     * @param out kt: en fazla n / M + 1 rnek.
+     * @return retilen kt says.
+     */
+    size_t process(const Sample* in, size_t n, Sample* out);
+
+    void reset() { delay_.reset(); phase_ = 0; }
+
+    size_t factor() const { return factor_; }
+
+private:
+    size_t factor_;
+    size_t phase_;                          ///< Bir sonraki ka kalan girdi says (0 -> bu girdi).
+    std::vector<Sample> coeffs_;
+    fir_detail::DelayLine<Sample> delay_;
+};
+
+/**
+ * @brief L kat ara deerleme (interpolation) + FIR alak geiren.
+ *
+ * Sfr eklenmi (zero-stuffed) girdi filtrelenmez; katsaylar L alt filtreye
+ * (h[p], h[p + L], h[p + 2L], ...) ayrlr ve her girdi iin L kn her biri kendi
+ * alt filtresiyle dorudan gerek girdilerden hesaplanr. Sfr eklemenin getirdii
+ * 1/L kazan kayb katsaylara dahil edilmelidir (rn. katsaylar L ile leklenir).
+ */
+template<typename Sample>
+class FirInterpolator {
+public:
+    /**
+     * @param coeffs Alak geiren katsaylar.
+     * @param taps Katsay says.
+     * @param factor Ara deerleme oran L (en az 1).
+     */
+    FirInterpolator(const Sample* coeffs, size_t taps, size_t factor);
+
+    /**
+     * @brief Bir girdi blounu iler.
+     * @param in Girdi rnekleri.
+     * @param n Girdi says.
+     * @param out kt: n * L rnek.
+     */
+    void process(const Sample* in, size_t n, Sample* out);
+
+    void reset() { delay_.reset(); }
+
+    size_t factor() const { return factor_; }
+
+private:
+    size_t factor_;
+    size_t phase_taps_;                     ///< Alt filtre bana (tamamlanm) katsay says.
+    std::vector<Sample> phases_;            ///< L alt filtre art arda, her biri ters ve tamamlanm.
+    fir_detail::DelayLine<Sample> delay_;
+};
+
+using FirQ15 = FirFilter<int16_t>;
+using FirQ31 = FirFilter<int32_t>;
+
+/// Seilen i arpm ekirdeinin ad ("avx2", "sse4.1" veya "scalar").
+const char* fir_kernel_name();
+
+#endif // FIR_FILTER_H
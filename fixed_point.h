@@ -0,0 +1,77 @@
+/**
+ * @file fixed_point.h
+ * @brief Q15 / Q31 Sabit Noktal (Fixed-Point) Aritmetik Yardmclar.
+ *
+ * Digital Filters modlnn ortak temelidir. Q15: int16_t, [-1, 1) aral, 15 kesir biti.
+ * Q31: int32_t, [-1, 1) aral, 31 kesir biti. arpmlar ve toplamlar daha geni bir
+ * akmlatrde (int64_t) tutulur; sonu yalnzca rnek tipine dnerken yuvarlanr ve
+ * doyurulur (saturate). Tama sessizce sarmaz (wraparound), en yakn snra krplr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef FIXED_POINT_H
+#define FIXED_POINT_H
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+/**
+ * @brief int64_t deeri Sample tipinin aralna doyurur.
+ * @tparam Sample int16_t (Q15) veya int32_t (Q31).
+ */
+template<typename Sample>
+constexpr Sample saturate(int64_t value) {
+    return (value > std::numeric_limits<Sample>::max()) ? std::numeric_limits<Sample>::max()
+         : (value < std::numeric_limits<Sample>::min()) ? std::numeric_limits<Sample>::min()
+         : static_cast<Sample>(value);
+}
+
+/**
+ * @brief Geni akmlatr 'shift' bit saa yuvarlayarak kaydrr ve Sample tipine doyurur.
+ *
+ * Yuvarlama: Yarm LSB eklenir, ardndan aritmetik saa kaydrlr (round half up).
+ * @param shift 1..62.
+ */
+template<typename Sample>
+constexpr Sample round_shift_saturate(int64_t acc, int shift) {
+    return saturate<Sample>((acc + (static_cast<int64_t>(1) << (shift - 1))) >> shift);
+}
+
+/**
+ * @brief Q format bilgileri: kesir biti says ve akmlatr -> rnek dnm.
+ * @tparam Sample int16_t (Q15) veya int32_t (Q31).
+ */
+template<typename Sample>
+struct FixedPointTraits {
+    static_assert(std::is_same<Sample, int16_t>::value || std::is_same<Sample, int32_t>::value,
+                  "FixedPointTraits: Sadece Q15 (int16_t) ve Q31 (int32_t) desteklenir.");
+
+    /// Kesir biti says (Q15 -> 15, Q31 -> 31).
+    static constexpr int kFracBits = std::numeric_limits<Sample>::digits;
+
+    /// Q(2*kFracBits) formatndaki akmlatr yuvarlayp doyurarak rnee evirir.
+    static constexpr Sample from_accumulator(int64_t acc) {
+        return round_shift_saturate<Sample>(acc, kFracBits);
+    }
+
+    /// Ondalk deeri (-1.0 .. 1.0) sabit noktaya evirir (aralk d deerler doyurulur).
+    static constexpr Sample from_double(double value) {
+        const double scaled = value * static_cast<double>(static_cast<int64_t>(1) << kFracBits);
+        return saturate<Sample>(static_cast<int64_t>(scaled + (scaled < 0 ? -0.5 : 0.5)));
+    }
+
+    /// Sabit nokta deerini ondala evirir (test ve tehis amal).
+    static constexpr double to_double(Sample value) {
+        return static_cast<double>(value) / static_cast<double>(static_cast<int64_t>(1) << kFracBits);
+    }
+};
+
+using Q15 = FixedPointTraits<int16_t>;
+using Q31 = FixedPointTraits<int32_t>;
+
+#endif // FIXED_POINT_H
@@ -0,0 +1,78 @@
+/**
+ * @file hierarchical_bitmap.cpp
+ * @brief zet Bitmap: Seviye Dzeni, zetlerin Toplu Kurulumu ve Seviyeler Aras find_next.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "hierarchical_bitmap.h"
+#include "dynamic_bitset.h"
+#include <algorithm>    // std::copy, std::fill
+
+void HierarchicalBitmap::resize(size_t nbits) {
+	size_ = nbits;
+	levels_ = 0;
+	size_t total = 0;
+	offset_[0] = 0;
+	// Her seviye bir alttakinin kelime says kadar bit tutar; tek kelimeye inince durulur.
+	for (size_t bits = nbits; bits != 0; bits = (bits + kWordBits - 1) / kWordBits) {
+		const size_t words = (bits + kWordBits - 1) / kWordBits;
+		total += words;
+		offset_[++levels_] = total;
+		if (words == 1) break;
+	}
+	words_.assign(total, 0);
+}
+
+void HierarchicalBitmap::assign(const DynamicBitset& bits) {
+	resize(bits.size());
+	std::copy(bits.data(), bits.data() + bits.word_count(), words_.begin());
+	build_summaries();
+}
+
+void HierarchicalBitmap::clear_all() {
+	std::fill(words_.begin(), words_.end(), 0);
+}
+
+void HierarchicalBitmap::build_summaries() {
+	for (int level = 0; level + 1 < levels_; level++) {
+		const uint64_t* below = words_.data() + offset_[level];
+		uint64_t* above = words_.data() + offset_[level + 1];
+		const size_t n = level_words(level);
+		for (size_t j = 0; j < n; j++) {
+			if (below[j] != 0) above[j / kWordBits] = SetRegBit(above[j / kWordBits], static_cast<int>(j % kWordBits));
+		}
+	}
+}
+
+uint64_t HierarchicalBitmap::count() const {
+	return count_set_bits(words_.data(), level_words(0));
+}
+
+size_t HierarchicalBitmap::find_next(size_t pos) const {
+	size_t index = pos + 1;
+	if (index >= size_) return npos;
+
+	// Yukar k: Her seviyede index ve sonrasndaki bitler (ayn kelimede) aranr. Bulunamazsa
+	// bir st seviyede bu kelimeden SONRAK kelimenin biti aranr.
+	int level = 0;
+	for (;; level++) {
+		if (level == levels_) return npos;
+		if (index >= level_words(level) * kWordBits) return npos;
+		const uint64_t word = words_[offset_[level] + index / kWordBits]
+		                    & ReverseMask<uint64_t>(static_cast<int>(index % kWordBits), 0);
+		if (word != 0) {
+			index = (index / kWordBits) * kWordBits + static_cast<size_t>(find_first_set_bit(word));
+			break;
+		}
+		index = index / kWordBits + 1;
+	}
+	// Aa in: Bulunan zet biti dolu bir alt kelimeyi gsterir; her seviyede en dk '1'.
+	for (level--; level >= 0; level--) {
+		index = index * kWordBits + static_cast<size_t>(find_first_set_bit(words_[offset_[level] + index]));
+	}
+	return index;
+}
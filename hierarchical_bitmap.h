@@ -0,0 +1,146 @@
+/**
+ * @file hierarchical_bitmap.h
+ * @brief ok Seviyeli zet (Summary) Bitmap: Seyrek Byk Kmelerde O(log64 n) lk '1' Arama.
+ *
+ * DynamicBitset::find_first / find_next bo kelimeleri tek karlatrmayla atlasa da
+ * maliyeti kelime saysyla dorusaldr: Bir milyon yuvada yalnzca birka hazr grev
+ * varsa 16384 kelime taranr. Bu snf yaprak (leaf) bitlerinin zerine zet seviyeleri
+ * kurar: Seviye k + 1'in j. biti, seviye k'nn j. kelimesi sfrdan farklysa '1'dir. Her
+ * seviye bir alttakinin 64 kelimesini tek kelimede zetler; en st seviye tek kelimedir.
+ *
+ * Arama en st kelimeden balar ve her seviyede tek bir find_first_set_bit (TZCNT) ile
+ * aa iner: 2^18 bit iin 3, 2^24 bit iin 4 TZCNT. set/clear yalnzca bir kelime
+ * boken dolduunda veya dolu iken boaldnda st seviyeye kar; tipik maliyet tek
+ * kelime yazmasdr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef HIERARCHICAL_BITMAP_H
+#define HIERARCHICAL_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "bitops.h" // SetRegBit, ClearRegBit, isBitSet, find_first_set_bit
+
+class DynamicBitset;    // dynamic_bitset.h
+
+/**
+ * @brief zet seviyeli bit kmesi (tek i parackl; DynamicBitset ile ayn szleme).
+ *
+ * Bit i, yaprak seviyesinin (i / 64). kelimesinin (i % 64). bitidir. Snr kontrol
+ * yaplmaz; indeksler [0, size()) aralnda olmaldr.
+ *
+ * MHENDSLK NOTU (Dzen): Tm seviyeler tek bir kelime dizisinde, yapraktan kke doru
+ * art arda tutulur; seviye balanglar sabit boyutlu bir dizide saklanr. Bylece arama
+ * seviye bana tek bir baml ykleme yapar (i ie vector'lerin ek iareti takibi yok).
+ * Deimezler: Yaprak seviyesinin size() tesindeki bitleri ve zet seviyelerinin alt
+ * seviyedeki kelime says tesindeki bitleri daima '0'dr.
+ */
+class HierarchicalBitmap {
+public:
+    static constexpr size_t kWordBits = 64;
+    /// 64^11 >= 2^64: Her size_t boyutu en fazla 11 seviyeye sar.
+    static constexpr int kMaxLevels = 11;
+    /// find_first / find_next iin "bulunamad" deeri.
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    HierarchicalBitmap() : size_(0), levels_(0) {}
+
+    /// @param nbits Bit says; tm bitler '0' balar.
+    explicit HierarchicalBitmap(size_t nbits) : size_(0), levels_(0) { resize(nbits); }
+
+    /// Boyutu deitirir ve tm bitleri '0' yapar.
+    void resize(size_t nbits);
+
+    /// bits'in ieriini kopyalar ve zet seviyelerini tek geite kurar (O(kelime says)).
+    void assign(const DynamicBitset& bits);
+
+    size_t size() const { return size_; }
+    /// Yaprak dahil seviye says (bo kmede 0).
+    int levels() const { return levels_; }
+    size_t word_count() const { return level_words(0); }
+
+    /// Yaprak kelimeleri (salt okunur; dorudan yazma zetleri bozar).
+    const uint64_t* data() const { return words_.data(); }
+
+    bool test(size_t pos) const {
+        return isBitSet(words_[pos / kWordBits], static_cast<int>(pos % kWordBits));
+    }
+
+    /// Biti '1' yapar. st seviyeye yalnzca kelime botan doluya geerse klr.
+    void set(size_t pos) {
+        size_t index = pos;
+        for (int level = 0; level < levels_; level++) {
+            uint64_t& word = words_[offset_[level] + index / kWordBits];
+            const uint64_t before = word;
+            word = SetRegBit(word, static_cast<int>(index % kWordBits));
+            if (before != 0) return;    // st zet biti zaten '1'.
+            index /= kWordBits;
+        }
+    }
+
+    /// Biti '0' yapar. st seviyeye yalnzca kelime tamamen boalrsa klr.
+    void clear(size_t pos) {
+        size_t index = pos;
+        for (int level = 0; level < levels_; level++) {
+            uint64_t& word = words_[offset_[level] + index / kWordBits];
+            word = ClearRegBit(word, static_cast<int>(index % kWordBits));
+            if (word != 0) return;      // Kelimede baka '1' var: st zet deimez.
+            index /= kWordBits;
+        }
+    }
+
+    void assign(size_t pos, bool value) {
+        if (value) set(pos); else clear(pos);
+    }
+
+    /// Tm bitleri '0' yapar.
+    void clear_all();
+
+    /// Hi '1' bit yok mu? Yalnzca kk kelimeye bakar (O(1)).
+    bool none() const { return levels_ == 0 || words_[offset_[levels_ - 1]] == 0; }
+    bool any() const { return !none(); }
+
+    /// '1' olan bit says (yaprak kelimelerinde dispatch edilmi bulk popcount).
+    uint64_t count() const;
+
+    /// lk '1' bitin indeksi; yoksa npos. Seviye bana bir find_first_set_bit.
+    size_t find_first() const {
+        if (none()) return npos;
+        size_t index = 0;
+        for (int level = levels_ - 1; level >= 0; level--) {
+            index = index * kWordBits + static_cast<size_t>(find_first_set_bit(words_[offset_[level] + index]));
+        }
+        return index;
+    }
+
+    /**
+     * @brief pos'tan SONRAK ilk '1' bitin indeksi (DynamicBitset::find_next ile ayn anlam).
+     *
+     * nce pos'un kelimesinde aranr; bulunamazsa bir st seviyede sonraki dolu kelime
+     * aranr (gerekirse kke kadar) ve oradan find_first gibi aa inilir. En fazla
+     * 2 * levels() kelime okunur.
+     *
+     * @param pos Balang (hari) indeksi.
+     * @return Bulunan indeks veya npos.
+     */
+    size_t find_next(size_t pos) const;
+
+private:
+    size_t level_words(int level) const {
+        return (level < levels_) ? offset_[level + 1] - offset_[level] : 0;
+    }
+    void build_summaries();
+
+    std::vector<uint64_t> words_;
+    size_t offset_[kMaxLevels + 1];     ///< Seviye l, words_[offset_[l], offset_[l + 1]) araldr.
+    size_t size_;
+    int levels_;
+};
+
+#endif // HIERARCHICAL_BITMAP_H
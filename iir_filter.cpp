@@ -0,0 +1,259 @@
+/**
+ * @file iir_filter.cpp
+ * @brief Biquad IIR Kaskad Implementasyonu: Skaler Referans ve AVX2 ok Kanall ekirdek.
+ *
+ * ablonlar yalnzca Q15 (int16_t) ve Q31 (int32_t) iin aka rneklenir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "iir_filter.h"
+#include "bitops.h"     // bitops_cpu_features
+#include <limits>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define IIR_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define IIR_X86_SIMD 0
+#endif
+
+namespace {
+
+// Durum dizisinde blm bana ayrlan alan (DF1: x1, x2, y1, y2; DF2T: s1, s2 + 2 bo).
+const size_t kStateVars = 4;
+// SIMD grubundaki kanal (erit) says ve stage-major ilemde ara tampon uzunluu (rnek).
+const size_t kLanes = 4;
+const size_t kBlockFrames = 64;
+
+// =========================================================================
+// I. SKALER REFERANS (KANAL BAINA)
+// =========================================================================
+
+template<typename Sample>
+void process_channel_scalar(const BiquadCoeffs<Sample>* coeffs, size_t num_stages, int out_shift,
+                            BiquadForm form, int64_t* state,
+                            const Sample* in, size_t in_stride, Sample* out, size_t out_stride, size_t frames) {
+	for (size_t n = 0; n < frames; n++) {
+		int64_t x = in[n * in_stride];
+		for (size_t s = 0; s < num_stages; s++) {
+			const BiquadCoeffs<Sample>& c = coeffs[s];
+			int64_t* st = state + s * kStateVars;
+			int64_t y;
+			if (form == BiquadForm::DirectForm1) {
+				const int64_t acc = c.b0 * x + c.b1 * st[0] + c.b2 * st[1] - c.a1 * st[2] - c.a2 * st[3];
+				y = round_shift_saturate<Sample>(acc, out_shift);
+				st[1] = st[0]; st[0] = x;
+				st[3] = st[2]; st[2] = y;
+			} else {
+				y = round_shift_saturate<Sample>(c.b0 * x + st[0], out_shift);
+				st[0] = c.b1 * x - c.a1 * y + st[1];
+				st[1] = c.b2 * x - c.a2 * y;
+			}
+			x = y;
+		}
+		out[n * out_stride] = static_cast<Sample>(x);
+	}
+}
+
+
+// =========================================================================
+// II. AVX2 EKRDE (4 KANAL / YAZMA)
+// =========================================================================
+
+#if IIR_X86_SIMD
+
+/**
+ * MHENDSLK NOTU: rnekler 64-bit eritlerde iaret geniletilmi olarak tutulur; hem
+ * Q15 hem Q31 deerleri int32'ye sdndan VPMULDQ (alt 32 bitin iaretli arpm) tam
+ * 64-bit arpm retir. AVX2'de 64-bit aritmetik saa kaydrma (VPSRAQ) olmadndan,
+ * mantksal kaydrmann st bitleri iaret maskesiyle doldurulur.
+ */
+struct Avx2Rounding {
+	__m256i round;
+	__m256i max;
+	__m256i min;
+	int shift;
+};
+
+__attribute__((target("avx2")))
+inline __m256i round_shift_saturate_avx2(__m256i acc, const Avx2Rounding& r) {
+	acc = _mm256_add_epi64(acc, r.round);
+	const __m256i sign = _mm256_cmpgt_epi64(_mm256_setzero_si256(), acc);
+	__m256i v = _mm256_or_si256(_mm256_srli_epi64(acc, r.shift), _mm256_slli_epi64(sign, 64 - r.shift));
+	v = _mm256_blendv_epi8(v, r.max, _mm256_cmpgt_epi64(v, r.max));
+	v = _mm256_blendv_epi8(v, r.min, _mm256_cmpgt_epi64(r.min, v));
+	return v;
+}
+
+// Bir blm blok boyunca uygular: buf[n] (4 erit) yerinde girdi -> k olur.
+template<typename Sample>
+__attribute__((target("avx2")))
+void stage_block_avx2(const BiquadCoeffs<Sample>& c, BiquadForm form, const Avx2Rounding& r,
+                      int64_t* state, __m256i* buf, size_t frames) {
+	__m256i* st = reinterpret_cast<__m256i*>(state);
+	const __m256i b0 = _mm256_set1_epi64x(c.b0), b1 = _mm256_set1_epi64x(c.b1), b2 = _mm256_set1_epi64x(c.b2);
+	const __m256i a1 = _mm256_set1_epi64x(c.a1), a2 = _mm256_set1_epi64x(c.a2);
+	if (form == BiquadForm::DirectForm1) {
+		__m256i x1 = _mm256_loadu_si256(st), x2 = _mm256_loadu_si256(st + 1);
+		__m256i y1 = _mm256_loadu_si256(st + 2), y2 = _mm256_loadu_si256(st + 3);
+		for (size_t n = 0; n < frames; n++) {
+			const __m256i x = _mm256_load_si256(buf + n);
+			__m256i acc = _mm256_add_epi64(_mm256_mul_epi32(b0, x), _mm256_mul_epi32(b1, x1));
+			acc = _mm256_add_epi64(acc, _mm256_mul_epi32(b2, x2));
+			acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(a1, y1));
+			acc = _mm256_sub_epi64(acc, _mm256_mul_epi32(a2, y2));
+			const __m256i y = round_shift_saturate_avx2(acc, r);
+			x2 = x1; x1 = x;
+			y2 = y1; y1 = y;
+			_mm256_store_si256(buf + n, y);
+		}
+		_mm256_storeu_si256(st, x1); _mm256_storeu_si256(st + 1, x2);
+		_mm256_storeu_si256(st + 2, y1); _mm256_storeu_si256(st + 3, y2);
+	} else {
+		__m256i s1 = _mm256_loadu_si256(st), s2 = _mm256_loadu_si256(st + 1);
+		for (size_t n = 0; n < frames; n++) {
+			const __m256i x = _mm256_load_si256(buf + n);
+			const __m256i y = round_shift_saturate_avx2(_mm256_add_epi64(_mm256_mul_epi32(b0, x), s1), r);
+			s1 = _mm256_add_epi64(_mm256_sub_epi64(_mm256_mul_epi32(b1, x), _mm256_mul_epi32(a1, y)), s2);
+			s2 = _mm256_sub_epi64(_mm256_mul_epi32(b2, x), _mm256_mul_epi32(a2, y));
+			_mm256_store_si256(buf + n, y);
+		}
+		_mm256_storeu_si256(st, s1); _mm256_storeu_si256(st + 1, s2);
+	}
+}
+
+/**
+ * @brief 4 kanallk bir grubu iler. Girdi/kt eriimi (serpitirilmi veya dzlemsel)
+ * kanal c, rnek n iin in[c](n) biiminde soyutlanr.
+ */
+template<typename Sample>
+__attribute__((target("avx2")))
+void process_group_avx2(const BiquadCoeffs<Sample>* coeffs, size_t num_stages, int out_shift, BiquadForm form,
+                        int64_t* const* lane_state, const Sample* const* in, size_t in_stride,
+                        Sample* const* out, size_t out_stride, size_t frames) {
+	Avx2Rounding r;
+	r.shift = out_shift;
+	r.round = _mm256_set1_epi64x(static_cast<int64_t>(1) << (out_shift - 1));
+	r.max = _mm256_set1_epi64x(std::numeric_limits<Sample>::max());
+	r.min = _mm256_set1_epi64x(std::numeric_limits<Sample>::min());
+
+	// Kanal bana saklanan durum erit dzenine ([blm][deiken][erit]) aktarlr.
+	std::vector<int64_t> st(num_stages * kStateVars * kLanes);
+	for (size_t i = 0; i < num_stages * kStateVars; i++) {
+		for (size_t l = 0; l < kLanes; l++) st[i * kLanes + l] = lane_state[l][i];
+	}
+
+	alignas(32) __m256i buf[kBlockFrames];
+	for (size_t base = 0; base < frames; base += kBlockFrames) {
+		const size_t count = (frames - base < kBlockFrames) ? frames - base : kBlockFrames;
+		for (size_t n = 0; n < count; n++) {
+			const size_t i = (base + n) * in_stride;
+			buf[n] = _mm256_set_epi64x(in[3][i], in[2][i], in[1][i], in[0][i]);
+		}
+		for (size_t s = 0; s < num_stages; s++) {
+			stage_block_avx2(coeffs[s], form, r, st.data() + s * kStateVars * kLanes, buf, count);
+		}
+		for (size_t n = 0; n < count; n++) {
+			alignas(32) int64_t lanes[kLanes];
+			_mm256_store_si256(reinterpret_cast<__m256i*>(lanes), buf[n]);
+			const size_t i = (base + n) * out_stride;
+			for (size_t l = 0; l < kLanes; l++) out[l][i] = static_cast<Sample>(lanes[l]);
+		}
+	}
+
+	for (size_t i = 0; i < num_stages * kStateVars; i++) {
+		for (size_t l = 0; l < kLanes; l++) lane_state[l][i] = st[i * kLanes + l];
+	}
+}
+
+#endif // IIR_X86_SIMD
+
+struct IirDispatch {
+	bool avx2;
+	const char* name;
+};
+
+IirDispatch build_iir_dispatch() {
+	IirDispatch d = { false, "scalar" };
+#if IIR_X86_SIMD
+	if (bitops_cpu_features().avx2) { d.avx2 = true; d.name = "avx2"; }
+#endif
+	return d;
+}
+
+const IirDispatch& iir_dispatch() {
+	static const IirDispatch d = build_iir_dispatch();
+	return d;
+}
+
+} // namespace
+
+
+// =========================================================================
+// III. GENEL API
+// =========================================================================
+
+template<typename Sample>
+MultiChannelBiquad<Sample>::MultiChannelBiquad(const BiquadCoeffs<Sample>* stages, size_t num_stages,
+                                               int coeff_shift, size_t channels, BiquadForm form)
+	: coeffs_(stages, stages + num_stages), out_shift_(FixedPointTraits<Sample>::kFracBits - coeff_shift),
+	  channels_(channels), form_(form), state_(channels * num_stages * kStateVars, 0) {}
+
+template<typename Sample>
+void MultiChannelBiquad<Sample>::reset() {
+	for (int64_t& v : state_) v = 0;
+}
+
+template<typename Sample>
+void MultiChannelBiquad<Sample>::process_interleaved(const Sample* in, Sample* out, size_t frames) {
+	process_strided(in, out, frames, channels_, nullptr, nullptr);
+}
+
+template<typename Sample>
+void MultiChannelBiquad<Sample>::process_planar(const Sample* const* in, Sample* const* out, size_t frames) {
+	process_strided(nullptr, nullptr, frames, 1, in, out);
+}
+
+// Serpitirilmi dzende kanal c'nin dizisi in + c (adm = channels), dzlemselde in_planes[c] (adm = 1).
+template<typename Sample>
+void MultiChannelBiquad<Sample>::process_strided(const Sample* in, Sample* out, size_t frames, size_t frame_stride,
+                                                 const Sample* const* in_planes, Sample* const* out_planes) {
+	const size_t num_stages = coeffs_.size();
+	const size_t state_stride = num_stages * kStateVars;
+	size_t c = 0;
+#if IIR_X86_SIMD
+	if (iir_dispatch().avx2) {
+		for (; c + kLanes <= channels_; c += kLanes) {
+			const Sample* lane_in[kLanes];
+			Sample* lane_out[kLanes];
+			int64_t* lane_state[kLanes];
+			for (size_t l = 0; l < kLanes; l++) {
+				lane_in[l] = in_planes ? in_planes[c + l] : in + c + l;
+				lane_out[l] = out_planes ? out_planes[c + l] : out + c + l;
+				lane_state[l] = state_.data() + (c + l) * state_stride;
+			}
+			process_group_avx2(coeffs_.data(), num_stages, out_shift_, form_, lane_state,
+			                   lane_in, frame_stride, lane_out, frame_stride, frames);
+		}
+	}
+#endif
+	for (; c < channels_; c++) {
+		const Sample* ch_in = in_planes ? in_planes[c] : in + c;
+		Sample* ch_out = out_planes ? out_planes[c] : out + c;
+		process_channel_scalar(coeffs_.data(), num_stages, out_shift_, form_, state_.data() + c * state_stride,
+		                       ch_in, frame_stride, ch_out, frame_stride, frames);
+	}
+}
+
+const char* iir_kernel_name() {
+	return iir_dispatch().name;
+}
+
+// Ak rnekleme (explicit instantiation): Q15 ve Q31.
+template class MultiChannelBiquad<int16_t>;
+template class MultiChannelBiquad<int32_t>;
@@ -0,0 +1,127 @@
+/**
+ * @file iir_filter.h
+ * @brief Q15 / Q31 Biquad IIR Kaskad (Direct Form I / II-Transposed), ok Kanall SIMD.
+ *
+ * Her blm (stage) ikinci dereceden bir filtredir:
+ *   y[n] = b0*x[n] + b1*x[n-1] + b2*x[n-2] - a1*y[n-1] - a2*y[n-2]
+ *
+ * Katsaylar Q(F - shift) formatndadr (F = 15 veya 31); 'coeff_shift' bitlik n lekleme
+ * |katsay| >= 1.0 olan tasarmlar (rn. a1 ~ -1.9) temsil etmeyi salar. arpm toplam
+ * int64_t akmlatrde tutulur ve (F - shift) bit saa yuvarlanp doyurularak rnee dner.
+ *
+ * IIR zyinelemesi (recursion) zaman ekseninde vektrlenemez. Bu yzden MultiChannelBiquad,
+ * bamsz kanallar SIMD eritlerine yerletirir: Her erit bir kanaldr (AVX2: 4 kanal,
+ * 64-bit erit). Ayn katsaylar tm kanallara uygulanr; durum (state) kanal banadr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef IIR_FILTER_H
+#define IIR_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "fixed_point.h"
+
+/// Tek bir biquad blmnn katsaylar (Q(F - coeff_shift)). a1/a2 fark denkleminde karlr.
+template<typename Sample>
+struct BiquadCoeffs {
+    Sample b0, b1, b2;
+    Sample a1, a2;
+};
+
+/**
+ * @brief Biquad gerekleme yaps.
+ *
+ * - DirectForm1: Durum = son iki girdi ve son iki k (rnek tipinde). Ara toplam
+ *   yalnzca akmlatrde oluur; sabit noktada en salam yapdr.
+ * - DirectForm2Transposed: Durum = iki ara toplam (int64_t, akmlatr hassasiyetinde).
+ *   Blm bana bir daha az bellek eriimi; durumlar yuvarlanmad iin grlts dktr.
+ */
+enum class BiquadForm : uint8_t {
+    DirectForm1 = 0,
+    DirectForm2Transposed = 1
+};
+
+/**
+ * @brief ok kanall biquad kaskad (ayn katsaylar, kanal bana durum).
+ *
+ * MHENDSLK NOTU (erit dzeni): Kanallar 4'l gruplara ayrlr; her grubun durumu bir
+ * AVX2 yazmacnda tutulur ve blok, blm blm (stage-major) ilenir: Bir blmn durumu
+ * tm blok boyunca yazmata kalr, ara sonular ksa bir tampon zerinden sonraki blme
+ * aktarlr. 4'e tam blnmeyen kalan kanallar skaler referans yoldan ilenir; iki yol
+ * bit dzeyinde ayn sonucu retir.
+ *
+ * @tparam Sample int16_t (Q15) veya int32_t (Q31).
+ */
+template<typename Sample>
+class MultiChannelBiquad {
+public:
+    /**
+     * @param stages Blm katsaylar (kaskad srasyla).
+     * @param num_stages Blm says.
+     * @param coeff_shift Katsay n leklemesi (0..F-1): Katsaylar Q(F - coeff_shift).
+     * @param channels Kanal says.
+     * @param form Gerekleme yaps.
+     */
+    MultiChannelBiquad(const BiquadCoeffs<Sample>* stages, size_t num_stages, int coeff_shift,
+                       size_t channels, BiquadForm form = BiquadForm::DirectForm1);
+
+    /**
+     * @brief Serpitirilmi (interleaved) tampon: rnek n, kanal c -> buf[n * channels + c].
+     * @param in Girdi (frames * channels rnek).
+     * @param out kt (ayn dzen; 'in' ile ayn olabilir).
+     * @param frames Kanal bana rnek says.
+     */
+    void process_interleaved(const Sample* in, Sample* out, size_t frames);
+
+    /**
+     * @brief Dzlemsel (planar) tamponlar: Her kanal ayr bir dizi.
+     * @param in channels adet girdi dizisi iaretisi.
+     * @param out channels adet kt dizisi iaretisi ('in' ile ayn olabilir).
+     * @param frames Kanal bana rnek says.
+     */
+    void process_planar(const Sample* const* in, Sample* const* out, size_t frames);
+
+    /// Tm kanallarn durumunu sfrlar.
+    void reset();
+
+    size_t channels() const { return channels_; }
+    size_t num_stages() const { return coeffs_.size(); }
+
+private:
+    void process_strided(const Sample* in, Sample* out, size_t frames, size_t frame_stride,
+                         const Sample* const* in_planes, Sample* const* out_planes);
+
+    std::vector<BiquadCoeffs<Sample>> coeffs_;
+    int out_shift_;                 ///< Akmlatr -> rnek kaydrmas: F - coeff_shift.
+    size_t channels_;
+    BiquadForm form_;
+    std::vector<int64_t> state_;    ///< [kanal][blm][4]: DF1 -> x1, x2, y1, y2; DF2T -> s1, s2.
+};
+
+/**
+ * @brief Tek kanall biquad kaskad (MultiChannelBiquad'n 1 kanall ksayolu).
+ */
+template<typename Sample>
+class BiquadCascade {
+public:
+    BiquadCascade(const BiquadCoeffs<Sample>* stages, size_t num_stages, int coeff_shift,
+                  BiquadForm form = BiquadForm::DirectForm1)
+        : impl_(stages, num_stages, coeff_shift, 1, form) {}
+
+    void process(const Sample* in, Sample* out, size_t n) { impl_.process_interleaved(in, out, n); }
+    void reset() { impl_.reset(); }
+
+private:
+    MultiChannelBiquad<Sample> impl_;
+};
+
+/// Seilen ok kanall ekirdein ad ("avx2" veya "scalar").
+const char* iir_kernel_name();
+
+#endif // IIR_FILTER_H
@@ -11,10 +11,34 @@
  * @date 15 Aralk 2025
  */
 
+#include <algorithm> // std::equal
+#include <cstdio>   // std::fopen / std::remove (elenmi bitmap demo dosyas)
 #include <iostream>
 #include <iomanip>
 #include <string>
+#include <thread>   // std::thread (ezamanl bitmap demosu)
+#include <vector>
 #include "bitops.h" // Ktphane implementasyonu
+#include "regfield.h" // Derleme zaman register/alan tanmlayclar
+#include "ring_buffer.h" // Kilitsiz SPSC dairesel tampon
+#include "mpmc_queue.h"  // Kilitsiz MPMC kuyruk
+#include "bitstream.h"   // Bit hassasiyetinde paketleme (BitWriter/BitReader)
+#include "bitpack.h"     // Blok tabanl vektrel bit paketleme codec'i
+#include "dynamic_bitset.h" // Dinamik boyutlu bit kmesi
+#include "rank_select.h"    // Rank/select yardmc indeksi
+#include "fir_filter.h"     // Q15/Q31 blok FIR filtreleri
+#include "iir_filter.h"     // Q15/Q31 biquad IIR kaskad
+#include "stream_filters.h" // CIC desimatr, kayan ortalama/medyan
+#include "predicate_filter.h" // SIMD yklem filtresi (maske + sktrma)
+#include "crc.h"              // Artml CRC32C / CRC-32 / CRC-16
+#include "bit_matrix.h"       // Bit matrisi devrii (bit dilimleme)
+#include "mapped_bitmap.h"    // mmap ile kopyasz byk bitmap taramas
+#include "thread_pool.h"      //  alan havuz ve paralel toplu ilemler
+#include "block_pool.h"       // Bitmap indeksli sabit bloklu havuz ayrc
+#include "atomic_bitops.h"    // Atomik bit ilemleri ve ezamanl bitmap
+#include "hierarchical_bitmap.h" // zet seviyeli bitmap (O(log64 n) arama)
+#include "compressed_bitmap.h"  // Roaring tarz sktrlm bitmap
+#include "bloom_filter.h"       // nbellek satr bloklu Bloom filtresi
 
 // =========================================================================
 // YARDIMCI FONKSYONLAR
@@ -135,6 +159,490 @@ void run_tests() {
     
     // find_first_set_bit Testi: En sadaki (LSB) set bitin indexini bulur.
     std::cout << "5. find_first_set_bit(0): " << find_first_set_bit((uint32_t)0) << " (Hata kodu: -1)" << std::endl; 
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 5: TAMPON (BULK) POPCOUNT ---
+    std::cout << "=== TEST 5: TAMPON (BULK) POPCOUNT ===" << std::endl;
+    // 1000 kelimelik bitmap: Her kelimede 0x0F0F... deseni (kelime bana 32 bit set).
+    static uint64_t bitmap[1000];
+    for (uint64_t& word : bitmap) {
+        word = 0x0F0F0F0F0F0F0F0FULL;
+    }
+    // 32000 bekliyoruz.
+    std::cout << "1. count_set_bits(bitmap, 1000): " << count_set_bits(bitmap, 1000) << std::endl;
+    // Byte grnm (hizasz balang): lk byte atlanr, 32000 - 4 = 31996 bekliyoruz.
+    const uint8_t* bytes = reinterpret_cast<const uint8_t*>(bitmap);
+    std::cout << "2. count_set_bits(bytes + 1, 7999): " << count_set_bits(bytes + 1, 7999) << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 6: DERLEME ZAMANI (CONSTEXPR) REGISTER HESABI ---
+    std::cout << "=== TEST 6: DERLEME ZAMANI (CONSTEXPR) REGISTER HESABI ===" << std::endl;
+    // Kontrol register' tamamen derleme zamannda hesaplanr: Bit 3 set, [8..11] alan = 0xA.
+    constexpr uint32_t ctrl = set_bit_field(SetRegBit(uint32_t{0}, 3), 8, 4, 0xA);
+    static_assert(ctrl == 0x00000A08u, "constexpr register hesabi hatali");
+    print_binary("1. constexpr Kontrol Register'", ctrl);
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 7: TPL REGISTER ALANLARI (REGFIELD) ---
+    std::cout << "=== TEST 7: TPL REGISTER ALANLARI (REGFIELD) ===" << std::endl;
+    // TEST 3'teki "sihirli saylar" (4, 5) yerine isimli alanlar: [0] Enable, [4..8] Gain, [12..15] Channel.
+    using CtrlEnable  = RegField<uint16_t, 0, 1>;
+    using CtrlGain    = RegField<uint16_t, 4, 5>;
+    using CtrlChannel = RegField<uint16_t, 12, 4>;
+    using CtrlReg     = RegLayout<uint16_t, CtrlEnable, CtrlGain, CtrlChannel>;
+
+    uint16_t ctrl_reg = 0b1101011010100001;
+    print_binary("1. Balang Register'", ctrl_reg);
+    std::cout << "2. CtrlGain::get: " << CtrlGain::get(ctrl_reg) << " (10 bekliyoruz)" << std::endl;
+
+    //  alan tek maskeli oku-deitir-yaz ile gncellenir.
+    ctrl_reg = CtrlReg::write(ctrl_reg, CtrlEnable::value(0), CtrlGain::value(0b11111), CtrlChannel::value<3>());
+    print_binary("3. CtrlReg::write Sonras", ctrl_reg);
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 8: SPSC RING BUFFER ---
+    std::cout << "=== TEST 8: SPSC RING BUFFER ===" << std::endl;
+    // Kapasite 8: ndeks maskesi 0b111 (modlo yerine AND).
+    static SpscRingBuffer<uint16_t, 8> ring;
+    print_binary("1. ndeks Maskesi (kMask)", (uint16_t)SpscRingBuffer<uint16_t, 8>::kMask);
+    const uint16_t samples[10] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 };
+    // 10 eleman istenir, kapasite 8 olduu iin 8 eklenmesini bekliyoruz.
+    std::cout << "2. push_batch(10): " << ring.push_batch(samples, 10) << " eleman eklendi" << std::endl;
+    uint16_t out[8];
+    size_t popped = ring.pop_batch(out, 8);
+    std::cout << "3. pop_batch: " << popped << " eleman, son eleman = " << out[popped - 1] << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 9: MPMC QUEUE ---
+    std::cout << "=== TEST 9: MPMC QUEUE ===" << std::endl;
+    static MpmcQueue<uint32_t, 4> mpmc;
+    const uint32_t frames[6] = { 10, 20, 30, 40, 50, 60 };
+    // Kapasite 4: 6 elemandan 4'nn tek CAS ile eklenmesini bekliyoruz.
+    std::cout << "1. try_push_bulk(6): " << mpmc.try_push_bulk(frames, 6) << " eleman eklendi" << std::endl;
+    std::cout << "2. try_push (dolu): " << (mpmc.try_push(70) ? "TRUE" : "FALSE") << std::endl;
+    uint32_t first_frame = 0;
+    mpmc.try_pop(first_frame);
+    std::cout << "3. try_pop: " << first_frame << " (10 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 10: BITSTREAM (3 / 11 / 17 BTLK ALANLAR) ---
+    std::cout << "=== TEST 10: BITSTREAM (3 / 11 / 17 BTLK ALANLAR) ===" << std::endl;
+    uint8_t frame[16] = {};
+    BitWriter writer(frame, sizeof(frame));
+    writer.write(0b101, 3);
+    writer.write(1500, 11);
+    const uint32_t counters[3] = { 70000, 1, 131071 };
+    writer.write_array(counters, 3, 17);
+    // 3 + 11 + 3 * 17 = 65 bit -> 9 byte bekliyoruz.
+    std::cout << "1. finish: " << writer.finish() << " byte" << std::endl;
+
+    BitReader reader(frame, 9);
+    std::cout << "2. read(3) = " << reader.read(3) << ", peek(11) = " << reader.peek(11) << std::endl;
+    reader.skip(11);
+    uint32_t decoded[3];
+    reader.read_array(decoded, 3, 17);
+    std::cout << "3. read_array(17): " << decoded[0] << " " << decoded[1] << " " << decoded[2]
+              << (reader.overrun() ? " (AIM!)" : "") << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 11: BITPACK CODEC (300 SAYA, FRAME-OF-REFERENCE) ---
+    std::cout << "=== TEST 11: BITPACK CODEC (300 SAYA, FRAME-OF-REFERENCE) ===" << std::endl;
+    uint32_t counters_in[300];
+    for (int i = 0; i < 300; i++) counters_in[i] = 40000 + (i * 37) % 1000;   // 40000..40999 -> 10 bit.
+    uint32_t packed[310];
+    const size_t packed_words = bitpack_encode(counters_in, 300, packed, BitpackMode::FrameOfReference);
+    std::cout << "1. Kodlanm boyut: " << packed_words << " kelime (ham: 300 kelime), blok genilii: "
+              << get_bit_field(packed[0], 0, 6) << " bit" << std::endl;
+    uint32_t counters_out[300];
+    const size_t used = bitpack_decode(packed, packed_words, counters_out, 300, BitpackMode::FrameOfReference);
+    bool same = (used == packed_words);
+    for (int i = 0; i < 300; i++) same = same && (counters_in[i] == counters_out[i]);
+    std::cout << "2. Geri ama: " << (same ? "OK" : "HATA") << " (ekirdek: "
+              << bitpack_kernel_name(BitpackBlockSize::k128) << ")" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 12: DYNAMIC BITSET (1000 BAYRAK) ---
+    std::cout << "=== TEST 12: DYNAMIC BITSET (1000 BAYRAK) ===" << std::endl;
+    DynamicBitset online(1000);
+    DynamicBitset alarm(1000);
+    online.set(3); online.set(64); online.set(700); online.set(999);
+    alarm.set(64); alarm.set(999);
+    std::cout << "1. count() = " << online.count() << " (4 bekliyoruz)" << std::endl;
+    online.and_not(alarm);   // evrimii ve alarmsz cihazlar.
+    std::cout << "2. and_not sonras '1' bitler:";
+    online.for_each_set_bit([](size_t i) { std::cout << " " << i; });
+    std::cout << " (3 700 bekliyoruz)" << std::endl;
+    std::cout << "3. find_next(3) = " << online.find_next(3) << ", test(64) = " << online.test(64) << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 13: RANK / SELECT (HER 3. BT '1', 10000 BT) ---
+    std::cout << "=== TEST 13: RANK / SELECT (HER 3. BT '1', 10000 BT) ===" << std::endl;
+    DynamicBitset every_third(10000);
+    for (size_t i = 0; i < 10000; i += 3) every_third.set(i);
+    RankSelectIndex rs(every_third);
+    std::cout << "1. rank1(3000) = " << rs.rank1(3000) << " (1000 bekliyoruz)" << std::endl;
+    std::cout << "2. select1(2500) = " << rs.select1(2500) << " (7500 bekliyoruz)" << std::endl;
+    std::cout << "3. ones() = " << rs.ones() << ", select ekirdei: " << RankSelectIndex::select_kernel_name() << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 14: Q15 FIR (4 TAP ORTALAMA), 2X DESMASYON VE Q31 TAM LEK ---
+    std::cout << "=== TEST 14: Q15 FIR (4 TAP ORTALAMA), 2X DESMASYON VE Q31 TAM LEK ===" << std::endl;
+    const int16_t quarter = Q15::from_double(0.25);
+    const int16_t avg_taps[4] = { quarter, quarter, quarter, quarter };
+    const int16_t step[8] = { 0, 0, 16384, 16384, 16384, 16384, 16384, 16384 };   // 0 -> 0.5 basama.
+    int16_t filtered[8];
+    FirQ15 fir(avg_taps, 4);
+    fir.process(step, filtered, 8);
+    std::cout << "1. Basamak yant:";
+    for (int16_t y : filtered) std::cout << " " << y;
+    std::cout << " (0 0 4096 8192 12288 16384 ... bekliyoruz)" << std::endl;
+    FirDecimator<int16_t> decimator(avg_taps, 4, 2);
+    int16_t decimated[4];
+    const size_t produced = decimator.process(step, 8, decimated);
+    std::cout << "2. Desimasyon: " << produced << " k, son = " << decimated[produced - 1]
+              << " (ekirdek: " << fir_kernel_name() << ")" << std::endl;
+    // Q31 tam lek: 32 adet ~1.0 katsay ve -1.0 girdi; Q62 arpmlarn ham toplam int64_t'yi tarrd.
+    const std::vector<int32_t> unity_taps(32, INT32_MAX);
+    const std::vector<int32_t> full_scale(32 + 3, INT32_MIN);
+    const size_t q31_mismatches = fir_detail::dot_kernel_mismatches(unity_taps.data(), full_scale.data(), 32);
+    int32_t full_out[8];
+    FirQ31 unity_fir(unity_taps.data(), unity_taps.size());
+    unity_fir.process(full_scale.data(), full_out, 8);
+    std::cout << "3. Q31 tam lek: skalerden farkl ekirdek sonucu " << q31_mismatches << ", y[0] = " << full_out[0]
+              << ", y[7] = " << full_out[7] << " (0, -2147483647, -2147483648 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 15: Q15 BIQUAD (TEK KUTUP ALAK GEREN), 2 KANAL SERPTRLM ---
+    std::cout << "=== TEST 15: Q15 BIQUAD (TEK KUTUP ALAK GEREN), 2 KANAL SERPTRLM ===" << std::endl;
+    // y[n] = 0.5 * x[n] + 0.5 * y[n-1]; katsaylar Q14 (coeff_shift = 1).
+    const BiquadCoeffs<int16_t> one_pole = { 8192, 0, 0, -8192, 0 };
+    MultiChannelBiquad<int16_t> stereo(&one_pole, 1, 1, 2);
+    int16_t stereo_frames[8] = { 16384, 0, 16384, 0, 16384, 0, 16384, 0 };   // Sol: 0.5 basama, sa: sessiz.
+    stereo.process_interleaved(stereo_frames, stereo_frames, 4);
+    std::cout << "1. Sol kanal:";
+    for (int i = 0; i < 8; i += 2) std::cout << " " << stereo_frames[i];
+    std::cout << " (8192 12288 14336 15360 bekliyoruz)" << std::endl;
+    std::cout << "2. Sa kanal:";
+    for (int i = 1; i < 8; i += 2) std::cout << " " << stereo_frames[i];
+    std::cout << " (0 0 0 0 bekliyoruz, ekirdek: " << iir_kernel_name() << ")" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 16: CIC DESMATR VE KAYAN MEDYAN ---
+    std::cout << "=== TEST 16: CIC DESMATR VE KAYAN MEDYAN ===" << std::endl;
+    CicDecimator<int16_t> cic(3, 4);                    // N = 3, R = 4: Kazan 4^3 = 2^6.
+    int16_t dc[32];
+    for (int16_t& x : dc) x = 1000;
+    int16_t cic_out[9];
+    const size_t cic_count = cic.process(dc, 32, cic_out);
+    std::cout << "1. CIC: " << cic_count << " k, son = " << cic_out[cic_count - 1]
+              << " (8 k, DC 1000 bekliyoruz; gain_bits = " << cic.gain_bits() << ")" << std::endl;
+    const int16_t spiky[8] = { 10, 10, 900, 10, 10, -700, 10, 10 };   // Tekil darbeler (impulse noise).
+    int16_t median_out[8];
+    SlidingMedian<int16_t> median(3);
+    median.process(spiky, median_out, 8);
+    std::cout << "2. Medyan (w=3):";
+    for (int16_t y : median_out) std::cout << " " << y;
+    std::cout << " (darbeler bastrlr, 10 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 17: YKLEM FLTRES (ARALIK VE BAYRAK, MASKE BRLETRME) ---
+    std::cout << "=== TEST 17: YKLEM FLTRES (ARALIK VE BAYRAK, MASKE BRLETRME) ===" << std::endl;
+    const uint16_t records[10] = { 5, 120, 40, 0x8032, 77, 0x8010, 300, 64, 0x8040, 99 };
+    DynamicBitset in_range_mask;
+    DynamicBitset flag_mask;
+    predicate_evaluate(records, 10, Predicate<uint16_t>::in_range(32, 100), in_range_mask);    // 32 <= x <= 100
+    predicate_evaluate(records, 10, Predicate<uint16_t>::bit_set(15), flag_mask);             // isBitSet(x, 15)
+    std::cout << "1. Aralk [32, 100]: " << in_range_mask.count() << " kayt, bit 15: " << flag_mask.count()
+              << " kayt (4 ve 3 bekliyoruz)" << std::endl;
+    in_range_mask.and_not(flag_mask);       // Aralkta ve bayrak kapal.
+    uint16_t picked[10];
+    const size_t picked_count = predicate_compact(records, in_range_mask, picked);
+    std::cout << "2. Aralkta ve bayraksz:";
+    for (size_t i = 0; i < picked_count; i++) std::cout << " " << picked[i];
+    std::cout << " (40 77 64 99 bekliyoruz, ekirdek: " << predicate_kernel_name() << ")" << std::endl;
+    DynamicBitset field_mask;
+    // 3 bitlik alan (en fazla 7) iin 9 snr: Kesilip '< 1'e dnmemeli.
+    predicate_evaluate(records, 10, Predicate<uint16_t>::bit_field(4, 3, PredicateOp::Less, 9), field_mask);
+    const size_t field_below = field_mask.count();
+    predicate_evaluate(records, 10, Predicate<uint16_t>::bit_field(4, 3, PredicateOp::Equal, 9), field_mask);
+    std::cout << "3. Alan[4..6] < 9: " << field_below << " kayt, alan == 9: " << field_mask.count()
+              << " kayt (10 ve 0 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 18: PARITY VE ARTIMLI CRC ("123456789" KONTROL DEERLER) ---
+    std::cout << "=== TEST 18: PARITY VE ARTIMLI CRC (\"123456789\" KONTROL DEERLER) ===" << std::endl;
+    const uint32_t parity_word = 0x80000007u;          // 4 bit set -> ift.
+    std::cout << "1. getParity(0x80000007) = " << getParity(parity_word) << ", getParityAdvanced = "
+              << getParityAdvanced(parity_word) << " (0 0 bekliyoruz)" << std::endl;
+    const char check[] = "123456789";
+    Crc32c crc32c;
+    crc32c.update(check, 4);                            // Para para: "1234" + "56789".
+    crc32c.update(check + 4, 5);
+    std::cout << "2. CRC32C = 0x" << std::hex << crc32c.finalize() << ", CRC-32 = 0x" << Crc32::compute(check, 9)
+              << ", CRC-16/X25 = 0x" << Crc16X25::compute(check, 9) << std::dec
+              << " (e3069283 cbf43926 906e bekliyoruz, ekirdek: " << crc32c_kernel_name() << ")" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 19: BT MATRS DEVR VE BT DLML PARITY ---
+    std::cout << "=== TEST 19: BT MATRS DEVR VE BT DLML PARITY ===" << std::endl;
+    const uint64_t diagonal = transpose8x8(0x00000000000000FFULL);    // Satr 0 dolu -> stun 0 dolu.
+    std::cout << "1. transpose8x8(0xFF) = 0x" << std::hex << diagonal << std::dec
+              << " (101010101010101 bekliyoruz)" << std::endl;
+    uint64_t values[64];
+    uint64_t slices[64];
+    for (int i = 0; i < 64; i++) values[i] = 0x9E3779B97F4A7C15ULL * (i + 1);
+    bit_matrix_transpose(reinterpret_cast<const uint8_t*>(values), 64, 64, reinterpret_cast<uint8_t*>(slices));
+    uint64_t sliced_parity = 0;                          // Bit i: values[i]'nin parity'si (64 deer paralel).
+    for (int j = 0; j < 64; j++) sliced_parity ^= slices[j];
+    int parity_mismatches = 0;
+    for (int i = 0; i < 64; i++) parity_mismatches += (isBitSet(sliced_parity, i) != getParity(values[i]));
+    std::cout << "2. 64 deerin bit dilimli parity'si: " << parity_mismatches
+              << " uyumsuzluk (0 bekliyoruz, ekirdek: " << bit_matrix_kernel_name() << ")" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 20: DNDRME SINIR DURUMLARI VE OK KELMEL KAYDIRMA ---
+    std::cout << "=== TEST 20: DNDRME SINIR DURUMLARI VE OK KELMEL KAYDIRMA ===" << std::endl;
+    const uint32_t rot_word = 0x80000001u;
+    std::cout << "1. RotateLeft(0x80000001, 32) = 0x" << std::hex << RotateLeft(rot_word, 32)
+              << ", RotateLeft(.., -1) = 0x" << RotateLeft(rot_word, -1) << std::dec
+              << " (80000001 c0000000 bekliyoruz)" << std::endl;
+    DynamicBitset window(130);                   // 3 kelimeye yaylan 130 bitlik pencere.
+    window.set(0);
+    window.set(129);
+    window <<= 65;                               // Bit 0 -> 65; bit 129 der.
+    std::cout << "2. (bit 0, 129) << 65: ilk bit " << window.find_first() << ", say " << window.count();
+    window.rotate_left(100);                     // 65 + 100 = 165 -> 165 % 130 = 35.
+    std::cout << "; rotate_left(100): ilk bit " << window.find_first()
+              << " (65, 1, 35 bekliyoruz, ekirdek: " << bitops_dispatch_info().bulk_shift << ")" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 21: BELLEE ELENM BITMAP DOSYASI (MMAP, OK  PARACIKLI) ---
+    std::cout << "=== TEST 21: BELLEE ELENM BITMAP DOSYASI (MMAP, OK  PARACIKLI) ===" << std::endl;
+    const char* map_path = "mapped_bitmap_demo.bin";
+    DynamicBitset occupancy(static_cast<size_t>(1) << 27);   // 16 MiB: ki tarama paras.
+    occupancy.set(100000000);
+    occupancy.set(120000000);
+    occupancy.set(130000000);
+    std::FILE* map_file = std::fopen(map_path, "wb");
+    if (map_file != nullptr) {
+        std::fwrite(occupancy.data(), sizeof(uint64_t), occupancy.word_count(), map_file);
+        std::fclose(map_file);
+    }
+    MappedBitmap mapped;
+    if (mapped.open(map_path)) {
+        std::cout << "1. " << mapped.size_bytes() / (1 << 20) << " MiB elendi: count = " << mapped.count()
+                  << ", find_first = " << mapped.find_first() << " (3, 100000000 bekliyoruz)" << std::endl;
+        std::cout << "2. rank1(125000000) = " << mapped.rank1(125000000) << ", find_next(100000000) = "
+                  << mapped.find_next(100000000) << " (2, 120000000 bekliyoruz)" << std::endl;
+        mapped.close();
+    } else {
+        std::cout << "1. Eleme alamad (POSIX d platform veya dosya yazlamad)." << std::endl;
+    }
+    std::remove(map_path);
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 22:  ALAN HAVUZ VE BELRLENMC PARALEL TOPLU LEMLER ---
+    std::cout << "=== TEST 22:  ALAN HAVUZ VE BELRLENMC PARALEL TOPLU LEMLER ===" << std::endl;
+    ThreadPool& pool = ThreadPool::shared();
+    std::vector<uint32_t> telemetry(1 << 20);                     // 4 MiB: Her ilem birden ok blok.
+    for (size_t i = 0; i < telemetry.size(); i++) telemetry[i] = static_cast<uint32_t>(i * 2654435761u) >> 20;   // 12-bit deerler.
+    const uint64_t serial_bits = count_set_bits(telemetry.data(), telemetry.size());
+    std::cout << "1. Popcount seri/paralel: " << serial_bits << " / " << count_set_bits(pool, telemetry.data(), telemetry.size())
+              << " (eit bekliyoruz, " << pool.concurrency() << " i parac)" << std::endl;
+    std::cout << "2. CRC32C seri/paralel: 0x" << std::hex << Crc32c::compute(telemetry.data(), telemetry.size() * 4)
+              << " / 0x" << Crc32c::compute(pool, telemetry.data(), telemetry.size() * 4) << std::dec
+              << " (eit bekliyoruz)" << std::endl;
+    DynamicBitset hot;
+    DynamicBitset hot_parallel;
+    predicate_evaluate(telemetry.data(), telemetry.size(), Predicate<uint32_t>::in_range(100, 199), hot);
+    predicate_evaluate(pool, telemetry.data(), telemetry.size(), Predicate<uint32_t>::in_range(100, 199), hot_parallel);
+    std::vector<uint32_t> telemetry_packed(bitpack_max_encoded_words(telemetry.size(), BitpackBlockSize::k128));
+    std::vector<uint32_t> telemetry_packed_parallel(telemetry_packed.size());
+    const size_t telemetry_words = bitpack_encode(telemetry.data(), telemetry.size(), telemetry_packed.data());
+    const size_t telemetry_words_parallel = bitpack_encode(pool, telemetry.data(), telemetry.size(), telemetry_packed_parallel.data());
+    const bool same_packed = telemetry_words == telemetry_words_parallel &&
+                             std::equal(telemetry_packed.begin(), telemetry_packed.begin() + telemetry_words, telemetry_packed_parallel.begin());
+    std::cout << "3. Yklem maskesi " << (hot == hot_parallel ? "ayn" : "FARKLI") << " (" << hot.count(pool)
+              << " eleman), paketleme " << (same_packed ? "ayn" : "FARKLI") << " (" << telemetry_words
+              << " kelime) (ayn, ayn bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 23: BITMAP NDEKSL BLOK HAVUZU ---
+    std::cout << "=== TEST 23: BITMAP NDEKSL BLOK HAVUZU (TOPLU AYIRMA, NBELLEK, ARENA SIFIRLAMA) ===" << std::endl;
+    BlockPool frame_pool;
+    frame_pool.init(48, 100, 64);                                       // 48 byte ereve, 64 byte adm.
+    void* pool_head = frame_pool.allocate();
+    void* frame_batch[200];
+    const size_t batch_got = frame_pool.allocate_bulk(frame_batch, 200);
+    std::cout << "1. Adm " << frame_pool.stride() << ", toplu ayrma " << batch_got << " blok, dolu havuzda allocate "
+              << (frame_pool.allocate() == nullptr ? "nullptr" : "blok") << " (64, 99, nullptr bekliyoruz)" << std::endl;
+    frame_pool.deallocate_bulk(frame_batch, batch_got);
+    frame_pool.deallocate(pool_head);
+    {
+        BlockPool::Cache frame_cache(frame_pool);
+        void* cached_frame = frame_cache.allocate();
+        frame_cache.deallocate(cached_frame);
+        std::cout << "2. nbellek: havuzda kullanmda " << frame_pool.in_use() << ", nbellekte " << frame_cache.cached()
+                  << ", ayn blok tekrar " << (frame_cache.allocate() == cached_frame ? "evet" : "hayr")
+                  << " (64, 64, evet bekliyoruz)" << std::endl;
+        frame_pool.reset();
+        std::cout << "3. reset sonras kullanmda " << frame_pool.in_use() << ", owns(ilk blok) = "
+                  << (frame_pool.owns(pool_head) ? "true" : "false") << " (0, true bekliyoruz)" << std::endl;
+        frame_cache.allocate();
+        frame_pool.init(32, 10, 32);                                    // nbellek yaarken havuz yeniden kurulur.
+        frame_cache.flush();
+        std::cout << "4. Yeniden init sonras flush: kullanmda " << frame_pool.in_use() << ", nbellekte "
+                  << frame_cache.cached() << " (0, 0 bekliyoruz)" << std::endl;
+        frame_cache.deallocate(frame_pool.allocate());
+    }
+    std::cout << "5. nbellek ykldktan sonra kullanmda " << frame_pool.in_use() << " (0 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 24: ATOMK BT LEMLER VE EZAMANLI BITMAP ---
+    std::cout << "=== TEST 24: ATOMK BT LEMLER VE EZAMANLI BITMAP ===" << std::endl;
+    std::atomic<uint32_t> link_status(0);
+    const bool was_up = AtomicTestAndSetBit(link_status, 5, std::memory_order_acq_rel);
+    const bool now_up = AtomicTestAndSetBit(link_status, 5, std::memory_order_acq_rel);
+    atomic_set_bit_field(link_status, 8, 4, 0xA, std::memory_order_release);
+    std::cout << "1. test-and-set: " << was_up << ", " << now_up << "; alan[8..11] = 0x" << std::hex
+              << atomic_get_bit_field(link_status, 8, 4, std::memory_order_acquire) << ", kelime = 0x"
+              << link_status.load() << std::dec << " (0, 1; 0xa, 0xa20 bekliyoruz)" << std::endl;
+    AtomicBitmap worker_slots(100);
+    std::vector<std::thread> claimers;
+    std::atomic<size_t> claim_sum(0);
+    for (int t = 0; t < 4; t++) {
+        claimers.emplace_back([&worker_slots, &claim_sum]() {
+            for (int k = 0; k < 25; k++) claim_sum.fetch_add(worker_slots.claim_first_clear(std::memory_order_acquire));
+        });
+    }
+    for (std::thread& th : claimers) th.join();
+    std::cout << "2. 4 i parac x 25 sahiplenme: count = " << worker_slots.count() << ", indeks toplam = "
+              << claim_sum.load() << ", 101. sahiplenme " << (worker_slots.claim_first_clear() == AtomicBitmap::npos ? "npos" : "bit")
+              << " (100, 4950, npos bekliyoruz)" << std::endl;
+    worker_slots.clear(42, std::memory_order_release);
+    std::cout << "3. 42 brakld, sonraki sahiplenme = " << worker_slots.claim_first_clear() << " (42 bekliyoruz)" << std::endl;
+    // clear_all ile ezamanl sahiplenme: Kuyruk bitleri (70..127) hibir anda '0' grnmemeli.
+    AtomicBitmap reset_slots(70);
+    std::atomic<bool> resetting(true);
+    std::atomic<size_t> out_of_range(0);
+    std::thread resetter([&reset_slots, &resetting]() {
+        for (int k = 0; k < 20000; k++) reset_slots.clear_all(std::memory_order_release);
+        resetting.store(false);
+    });
+    std::thread reset_claimer([&reset_slots, &resetting, &out_of_range]() {
+        while (resetting.load()) {
+            const size_t slot = reset_slots.claim_first_clear(std::memory_order_acquire);
+            if (slot != AtomicBitmap::npos && slot >= reset_slots.size()) out_of_range.fetch_add(1);
+        }
+    });
+    resetter.join();
+    reset_claimer.join();
+    std::cout << "4. clear_all ile ezamanl sahiplenmede size() tesi indeks: " << out_of_range.load()
+              << " (0 bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 25: ZET SEVYEL BITMAP (ZAMANLAYICI HAZIR KUYRUU) ---
+    std::cout << "=== TEST 25: ZET SEVYEL BITMAP (ZAMANLAYICI HAZIR KUYRUU) ===" << std::endl;
+    HierarchicalBitmap ready_tasks(1000000);
+    ready_tasks.set(999999);
+    ready_tasks.set(700000);
+    ready_tasks.set(4242);
+    std::cout << "1. " << ready_tasks.levels() << " seviye, find_first = " << ready_tasks.find_first()
+              << ", find_next(4242) = " << ready_tasks.find_next(4242) << " (4, 4242, 700000 bekliyoruz)" << std::endl;
+    ready_tasks.clear(4242);
+    ready_tasks.clear(700000);
+    std::cout << "2. ki grev alnd: find_first = " << ready_tasks.find_first() << ", count = " << ready_tasks.count()
+              << " (999999, 1 bekliyoruz)" << std::endl;
+    ready_tasks.clear(999999);
+    std::cout << "3. Bo kuyruk: none = " << (ready_tasks.none() ? "true" : "false") << ", find_first "
+              << (ready_tasks.find_first() == HierarchicalBitmap::npos ? "npos" : "bit") << " (true, npos bekliyoruz)" << std::endl;
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 26: SIKITIRILMI BITMAP (DZ / BT KMES / KOU KAPLARI) ---
+    std::cout << "=== TEST 26: SIKITIRILMI BITMAP (DZ / BT KMES / KOU KAPLARI) ===" << std::endl;
+    CompressedBitmap active_ids;
+    active_ids.add(7);
+    active_ids.add(40000);
+    active_ids.add(3000000000u);
+    active_ids.add_range(1 << 20, (1 << 20) + 100000);                 // 100000 ardk kimlik: ki kou kab.
+    std::string kinds;
+    for (size_t i = 0; i < active_ids.container_count(); i++) {
+        const CompressedBitmap::Kind kind = active_ids.container_kind(i);
+        kinds += (kind == CompressedBitmap::Kind::Array) ? 'A' : (kind == CompressedBitmap::Kind::Bitset) ? 'B' : 'R';
+    }
+    std::cout << "1. Kardinalite " << active_ids.cardinality() << ", kaplar " << kinds << ", seri boyut "
+              << active_ids.serialized_size() << " byte (100003, ARRA, 55 bekliyoruz)" << std::endl;
+    CompressedBitmap billed_ids;
+    billed_ids.add(7);
+    billed_ids.add_range((1 << 20) + 50000, (1 << 20) + 200000);
+    CompressedBitmap both_ids = active_ids;
+    both_ids &= billed_ids;
+    billed_ids |= active_ids;
+    std::cout << "2. AND kardinalite " << both_ids.cardinality() << ", OR kardinalite " << billed_ids.cardinality()
+              << " (50001, 200003 bekliyoruz)" << std::endl;
+    const char* roaring_path = "compressed_bitmap_demo.bin";
+    std::vector<uint8_t> roaring_bytes(active_ids.serialized_size());
+    active_ids.serialize(roaring_bytes.data());
+    std::FILE* roaring_file = std::fopen(roaring_path, "wb");
+    if (roaring_file != nullptr) {
+        std::fwrite(roaring_bytes.data(), 1, roaring_bytes.size(), roaring_file);
+        std::fclose(roaring_file);
+    }
+    MappedBitmap roaring_map;
+    CompressedBitmapView roaring_view;
+    if (roaring_map.open(roaring_path, MappedBitmap::Access::Random) &&
+        roaring_view.open(roaring_map.words(), roaring_map.size_bytes())) {
+        std::cout << "3. Elenmi dosyada grnm: kardinalite " << roaring_view.cardinality() << ", contains(1100000) = "
+                  << roaring_view.contains(1100000) << ", contains(1200000) = " << roaring_view.contains(1200000)
+                  << " (100003, 1, 0 bekliyoruz)" << std::endl;
+        roaring_map.close();
+    } else {
+        std::cout << "3. Eleme alamad (POSIX d platform veya dosya yazlamad)." << std::endl;
+    }
+    std::remove(roaring_path);
+    std::cout << "----------------------------------------------------" << std::endl;
+
+
+    // --- TEST 27: NBELLEK SATIRI BLOKLU BLOOM FLTRES (TOPLU SIMD SORGU) ---
+    std::cout << "=== TEST 27: NBELLEK SATIRI BLOKLU BLOOM FLTRES (TOPLU SIMD SORGU) ===" << std::endl;
+    BlockedBloomFilter seen_ids;
+    seen_ids.init(10000, 0.01);
+    std::vector<uint64_t> seen_hashes(10000);
+    for (size_t i = 0; i < seen_hashes.size(); i++) seen_hashes[i] = bloom_hash(2 * i);     // ift kimlikler.
+    seen_ids.insert_batch(seen_hashes.data(), seen_hashes.size());
+    std::cout << "1. " << seen_ids.block_count() << " blok (" << seen_ids.size_bytes() * 8 / seen_hashes.size()
+              << " bit/anahtar), ekirdek: " << bloom_kernel_name() << ", contains(4242) = " << seen_ids.contains(bloom_hash(4242))
+              << " (1 bekliyoruz)" << std::endl;
+    std::vector<uint64_t> probe_hashes(20000);
+    for (size_t i = 0; i < probe_hashes.size(); i++) probe_hashes[i] = bloom_hash(i);
+    DynamicBitset maybe_seen;
+    seen_ids.contains_batch(probe_hashes.data(), probe_hashes.size(), maybe_seen);
+    size_t true_hits = 0;
+    for (size_t i = 0; i < probe_hashes.size(); i += 2) true_hits += maybe_seen.test(i);
+    std::cout << "2. 20000 toplu sorgu: eklenenlerden bulunan " << true_hits << ", eklenmeyenlerde yanl pozitif "
+              << maybe_seen.count() - true_hits << " (10000, ~100 bekliyoruz)" << std::endl;
 }
 
 /**
@@ -142,6 +650,8 @@ void run_tests() {
  */
 int main() {
     // std::hex ve std::dec gibi formatlama fonksiyonlarnn kullanm iin not.
+    // Hangi hzl yollarn (POPCNT, TZCNT, BMI2, AVX2...) bu makinede aktif olduunu gster.
+    print_bitops_dispatch(std::cout);
     run_tests();
     return 0;
 }
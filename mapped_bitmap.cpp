@@ -0,0 +1,194 @@
+/**
+ * @file mapped_bitmap.cpp
+ * @brief Bellee Elenmi Bitmap: mmap/madvise Sarmalaycs ve Para Tabanl Paralel Taramalar.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "mapped_bitmap.h"
+#include "bitops.h"     // count_set_bits (bulk), find_first_set_bit, CreateMask
+#include <atomic>
+#include <cerrno>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MAPPED_BITMAP_POSIX 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#define MAPPED_BITMAP_POSIX 0
+#endif
+
+namespace {
+
+const size_t kChunkWords = MappedBitmap::kChunkBytes / sizeof(uint64_t);
+
+unsigned resolve_threads(unsigned threads, size_t chunks) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	return (chunks < threads) ? static_cast<unsigned>(chunks) : threads;
+}
+
+// Paralar paylalan sayatan artan srada datr. fn(c) false dnerse o i parac
+// yeni para ekmeyi brakr. aran i parac da alanlardan biridir.
+template<typename Fn>
+void for_each_chunk(size_t chunks, unsigned threads, Fn fn) {
+	std::atomic<size_t> next(0);
+	auto worker = [&]() {
+		for (;;) {
+			const size_t c = next.fetch_add(1, std::memory_order_relaxed);
+			if (c >= chunks || !fn(c)) break;
+		}
+	};
+	std::vector<std::thread> pool;
+	for (unsigned t = 1; t < threads; t++) pool.emplace_back(worker);
+	worker();
+	for (std::thread& th : pool) th.join();
+}
+
+#if MAPPED_BITMAP_POSIX
+int madvise_flag(MappedBitmap::Access access) {
+	return (access == MappedBitmap::Access::Random) ? MADV_RANDOM : MADV_SEQUENTIAL;
+}
+#endif
+
+} // namespace
+
+
+// =========================================================================
+// I. ELEME (MMAP)
+// =========================================================================
+
+bool MappedBitmap::open(const char* path, Access access) {
+	close();
+#if MAPPED_BITMAP_POSIX
+	const int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+	if (fd < 0) return false;
+	struct stat st;
+	if (fstat(fd, &st) != 0) {
+		const int err = errno;
+		::close(fd);
+		errno = err;
+		return false;
+	}
+	const size_t bytes = static_cast<size_t>(st.st_size);
+	void* data = nullptr;
+	if (bytes != 0) {
+		data = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (data == MAP_FAILED) {
+			const int err = errno;
+			::close(fd);
+			errno = err;
+			return false;
+		}
+	}
+	::close(fd);    // Eleme dosya tanmlaycsndan bamsz yaar.
+	data_ = data;
+	bytes_ = bytes;
+	open_ = true;
+	advise(access);
+	return true;
+#else
+	(void)path;
+	(void)access;
+	errno = ENOSYS;
+	return false;
+#endif
+}
+
+void MappedBitmap::close() {
+#if MAPPED_BITMAP_POSIX
+	if (data_ != nullptr) munmap(data_, bytes_);
+#endif
+	data_ = nullptr;
+	bytes_ = 0;
+	open_ = false;
+}
+
+void MappedBitmap::advise(Access access) const {
+#if MAPPED_BITMAP_POSIX
+	if (data_ != nullptr) madvise(data_, bytes_, madvise_flag(access));
+#else
+	(void)access;
+#endif
+}
+
+void MappedBitmap::prefetch() const {
+#if MAPPED_BITMAP_POSIX
+	if (data_ != nullptr) madvise(data_, bytes_, MADV_WILLNEED);
+#endif
+}
+
+
+// =========================================================================
+// II. PARALEL TARAMALAR
+// =========================================================================
+
+uint64_t MappedBitmap::count_range(size_t begin, size_t end, unsigned threads) const {
+	if (begin >= end) return 0;
+	const uint64_t* w = words();
+	const size_t first_word = begin / 64;
+	const size_t last_word = (end - 1) / 64;
+	const int head = static_cast<int>(begin % 64);
+	const int tail = static_cast<int>((end - 1) % 64) + 1;
+	if (first_word == last_word) {
+		return static_cast<uint64_t>(count_set_bits(w[first_word] & CreateMask<uint64_t>(tail - head, head)));
+	}
+
+	// Kenar kelimeler maskelenir; aradaki tam kelimeler (first_word, last_word) paralara blnr.
+	uint64_t total = static_cast<uint64_t>(count_set_bits(w[first_word] & CreateMask<uint64_t>(64 - head, head)))
+	               + static_cast<uint64_t>(count_set_bits(w[last_word] & CreateMask<uint64_t>(tail, 0)));
+	const size_t lo = first_word + 1;
+	const size_t hi = last_word;
+	if (lo >= hi) return total;
+
+	// Para snrlar dosyann bana gre hizaldr (kChunkBytes sayfa boyutunun katdr).
+	const size_t base = lo / kChunkWords;
+	const size_t chunks = (hi - 1) / kChunkWords - base + 1;
+	std::atomic<uint64_t> sum(0);
+	for_each_chunk(chunks, resolve_threads(threads, chunks), [&](size_t c) {
+		const size_t start = ((base + c) * kChunkWords > lo) ? (base + c) * kChunkWords : lo;
+		const size_t stop = ((base + c + 1) * kChunkWords < hi) ? (base + c + 1) * kChunkWords : hi;
+		sum.fetch_add(count_set_bits(w + start, stop - start), std::memory_order_relaxed);
+		return true;
+	});
+	return total + sum.load();
+}
+
+size_t MappedBitmap::find_from(size_t begin, unsigned threads) const {
+	if (begin >= size()) return npos;
+	const uint64_t* w = words();
+	const size_t nwords = word_count();
+	const size_t first_word = begin / 64;
+	const uint64_t head = w[first_word] & ReverseMask<uint64_t>(static_cast<int>(begin % 64), 0);
+	if (head != 0) return first_word * 64 + static_cast<size_t>(find_first_set_bit(head));
+
+	const size_t lo = first_word + 1;
+	if (lo >= nwords) return npos;
+	const size_t base = lo / kChunkWords;
+	const size_t chunks = (nwords - 1) / kChunkWords - base + 1;
+	std::atomic<size_t> best(npos);
+	for_each_chunk(chunks, resolve_threads(threads, chunks), [&](size_t c) {
+		const size_t start = ((base + c) * kChunkWords > lo) ? (base + c) * kChunkWords : lo;
+		const size_t stop = ((base + c + 1) * kChunkWords < nwords) ? (base + c + 1) * kChunkWords : nwords;
+		// Daha nce bulunan konumdan sonraki paralar taranmaz; paralar artan srada
+		// ekildii iin bundan nceki her para zaten bir i paracndadr.
+		if (start * 64 >= best.load(std::memory_order_relaxed)) return false;
+		for (size_t i = start; i < stop; i++) {
+			if (w[i] == 0) continue;
+			const size_t pos = i * 64 + static_cast<size_t>(find_first_set_bit(w[i]));
+			size_t current = best.load(std::memory_order_relaxed);
+			while (pos < current && !best.compare_exchange_weak(current, pos, std::memory_order_relaxed)) {
+			}
+			return false;
+		}
+		return true;
+	});
+	return best.load();
+}
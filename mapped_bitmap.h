@@ -0,0 +1,128 @@
+/**
+ * @file mapped_bitmap.h
+ * @brief Bellee Elenmi (mmap) Byk Dosya Bitmapleri: Kopyasz Eriim ve ok  Parackl Tarama.
+ *
+ * Diskteki GB boyutlu doluluk bitmaplerini read() ile heap'e kopyalamadan, dosyay salt
+ * okunur eleyerek (mmap) dorudan sorgular. Toplu popcount, find-first-set ve rank
+ * sorgular elemenin zerinde, sayfa hizal paralara (chunk) blnerek tm ekirdeklerde
+ * paralel yrr. Tekrarlanan rank/select sorgular iin RankSelectIndex dorudan
+ * words() zerine kurulabilir (indeks bitmapi kopyalamaz).
+ *
+ * Dosya dzeni: Ham little-endian uint64_t kelimeleri (DynamicBitset::data() ile ayn).
+ * Bit i, (i / 64). kelimenin (i % 64). bitidir; bitmap uzunluu dosya boyutu x 8 bittir.
+ *
+ * Yalnzca POSIX sistemlerde (Linux, macOS) desteklenir; dierlerinde open() false dner.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef MAPPED_BITMAP_H
+#define MAPPED_BITMAP_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Salt okunur, bellee elenmi bitmap dosyas.
+ *
+ * MHENDSLK NOTU (Para datm): Tarama kChunkBytes'lk (8 MiB, sayfa boyutunun kat)
+ * paralara blnr; i paracklar paralar paylalan bir atomik sayatan artan srada
+ * eker (dinamik yk dengeleme: Sayfa hatas (page fault) yaayan para dierlerini
+ * bekletmez). Her para ayr sayfalardadr; iki i parac ayn sayfay hatalandrmaz.
+ * find_next'te bulunan en kk konum atomik olarak tutulur ve ondan sonraki paralar hi
+ * ekilmez; bylece ilk '1' dosyann bandaysa tm dosya okunmaz.
+ *
+ * Sorgular const'tur ve eleme deimedii srece farkl i paracklarndan ayn anda
+ * arlabilir. Dosya elenmiken baka bir sre tarafndan ksaltlmamaldr (SIGBUS).
+ */
+class MappedBitmap {
+public:
+    static constexpr size_t npos = static_cast<size_t>(-1);
+    static constexpr size_t kChunkBytes = static_cast<size_t>(8) << 20;
+
+    /// ekirdee (kernel) verilen eriim deseni ipucu (madvise).
+    enum class Access : uint8_t {
+        Sequential = 0,   ///< MADV_SEQUENTIAL: Agresif ileri okuma, okunan sayfalar erken braklr.
+        Random = 1        ///< MADV_RANDOM: leri okuma yok (RankSelectIndex sorgular gibi).
+    };
+
+    MappedBitmap() : data_(nullptr), bytes_(0), open_(false) {}
+    ~MappedBitmap() { close(); }
+
+    MappedBitmap(const MappedBitmap&) = delete;
+    MappedBitmap& operator=(const MappedBitmap&) = delete;
+
+    /**
+     * @brief Dosyay salt okunur eler. Ak bir eleme varsa nce kapatlr.
+     * @param path Dosya yolu.
+     * @param access Eriim deseni ipucu.
+     * @return Baarlysa true; aksi halde false (errno ak/eleme hatasn tar).
+     *         Bo dosya baaryla alr (size() == 0).
+     */
+    bool open(const char* path, Access access = Access::Sequential);
+
+    /// Elemeyi kaldrr. words() geersiz olur.
+    void close();
+
+    bool is_open() const { return open_; }
+
+    /// Elenmi kelimeler (sayfa hizal). Dosya boyutu 8'in kat deilse son kelimenin
+    /// dosya sonu tesindeki byte'lar '0' okunur (elemenin son sayfas sfr doldurulur).
+    const uint64_t* words() const { return static_cast<const uint64_t*>(data_); }
+    size_t word_count() const { return (bytes_ + 7) / 8; }
+    size_t size_bytes() const { return bytes_; }
+    /// Bitmap uzunluu (bit).
+    size_t size() const { return bytes_ * 8; }
+
+    /// Eriim deseni ipucunu deitirir (rn. tam taramadan sonra rastgele sorgulara geerken).
+    void advise(Access access) const;
+
+    /// Tm dosyann arka planda nbellee okunmasn ister (MADV_WILLNEED); beklemez.
+    void prefetch() const;
+
+    /**
+     * @brief '1' bit says (dispatch edilmi bulk popcount, para bana bir i).
+     * @param threads  parac says; 0 ise donanm i parac says.
+     */
+    uint64_t count(unsigned threads = 0) const { return count_range(0, size(), threads); }
+
+    /**
+     * @brief [0, pos) aralndaki '1' bit says (tek seferlik rank; indeks gerektirmez).
+     * @param pos 0..size() (dahil).
+     * @param threads  parac says; 0 ise donanm i parac says.
+     */
+    uint64_t rank1(size_t pos, unsigned threads = 0) const { return count_range(0, pos, threads); }
+
+    /**
+     * @brief [begin, end) bit aralndaki '1' bit says.
+     * @param begin Balang biti.
+     * @param end Biti biti (hari), en fazla size().
+     * @param threads  parac says; 0 ise donanm i parac says.
+     */
+    uint64_t count_range(size_t begin, size_t end, unsigned threads = 0) const;
+
+    /// lk '1' bitin indeksi; yoksa npos.
+    size_t find_first(unsigned threads = 0) const { return find_from(0, threads); }
+
+    /**
+     * @brief pos'tan SONRAK ilk '1' bitin indeksi (DynamicBitset::find_next ile ayn anlam).
+     * @param pos Balang (hari) indeksi.
+     * @param threads  parac says; 0 ise donanm i parac says.
+     * @return Bulunan indeks veya npos.
+     */
+    size_t find_next(size_t pos, unsigned threads = 0) const {
+        return (pos + 1 >= size()) ? npos : find_from(pos + 1, threads);
+    }
+
+private:
+    size_t find_from(size_t begin, unsigned threads) const;
+
+    void* data_;        ///< Eleme balangc (bo dosyada nullptr).
+    size_t bytes_;      ///< Dosya boyutu.
+    bool open_;
+};
+
+#endif // MAPPED_BITMAP_H
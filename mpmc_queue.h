@@ -0,0 +1,202 @@
+/**
+ * @file mpmc_queue.h
+ * @brief Snrl (Bounded) ok retici / ok Tketici (MPMC) Kilitsiz Kuyruk.
+ *
+ * Birden fazla yakalama (capture) i paracnn bir veya daha fazla iiye veri
+ * aktard (fan-in) senaryolar iindir. Dmitry Vyukov'un slot bana sra numaras
+ * (per-slot sequence) tasarm kullanlr: Her hcrenin sra numaras, hcrenin hangi
+ * turda (lap) bo veya dolu olduunu belirtir; reticiler ve tketiciler yalnzca
+ * kendi konum sayalar zerinde CAS yapar, birbirlerini kilitle beklemezler.
+ *
+ * Kapasite 2'nin kuvveti olmak zorundadr (is_power_of_two); hcre indeksi modlo
+ * yerine CreateMask ile retilen AND maskesiyle hesaplanr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "bitops.h"      // is_power_of_two, CreateMask, find_first_set_bit
+#include "ring_buffer.h" // BITBUF_CACHE_LINE_SIZE
+
+/**
+ * @brief Snrl, kilitsiz MPMC kuyruk (Vyukov tasarm).
+ *
+ * Tm ilemler bloklamayan (non-blocking) try_* ilemleridir. Toplu (bulk) varyantlar,
+ * ardk birden fazla hcreyi tek bir CAS ile sahiplenir; bylece paylalan saya
+ * zerindeki ekime (contention) eleman bana deil, blok bana bir kez yaanr.
+ *
+ * @tparam T Eleman tipi. Trivially copyable olmaldr.
+ * @tparam Capacity Kuyruk kapasitesi (eleman). 2'nin kuvveti ve en az 2 olmaldr.
+ */
+template<typename T, size_t Capacity>
+class MpmcQueue {
+    static_assert(is_power_of_two(static_cast<uint64_t>(Capacity)) && Capacity >= 2,
+                  "MpmcQueue: Kapasite 2'nin kuvveti ve en az 2 olmalidir.");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "MpmcQueue: Eleman tipi trivially copyable olmalidir.");
+
+public:
+    static constexpr size_t kMask =
+        static_cast<size_t>(CreateMask<uint64_t>(find_first_set_bit(static_cast<uint64_t>(Capacity)), 0));
+
+    MpmcQueue() : enqueue_pos_(0), dequeue_pos_(0) {
+        // Balangta i. hcre, i. konumdaki reticiyi bekler (sequence == konum -> bo).
+        for (size_t i = 0; i < Capacity; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpmcQueue(const MpmcQueue&) = delete;
+    MpmcQueue& operator=(const MpmcQueue&) = delete;
+
+    /**
+     * @brief Bir eleman eklemeyi dener (herhangi bir retici).
+     * @param item Eklenecek eleman.
+     * @return Kuyruk doluysa false, aksi halde true dndrr.
+     */
+    bool try_push(const T& item) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & kMask];
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            // aretli fark: 0 -> hcre bo, < 0 -> bir tur nceki eleman henz tketilmedi (dolu).
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.data = item;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+                // CAS baarszsa pos gncel deerle yeniden yklenmitir.
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Bir eleman karmay dener (herhangi bir tketici).
+     * @param item karlan elemann yazlaca hedef.
+     * @return Kuyruk bosa false, aksi halde true dndrr.
+     */
+    bool try_pop(T& item) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Cell& cell = cells_[pos & kMask];
+            const size_t seq = cell.sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    item = cell.data;
+                    // Hcreyi bir sonraki turun reticisine devret.
+                    cell.sequence.store(pos + Capacity, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief En fazla n eleman, ardk hcreleri tek CAS ile sahiplenerek ekler.
+     *
+     * nce mevcut konumdan itibaren ka hcrenin bo olduu saylr, ardndan hepsi
+     * tek bir CAS ile ayrlr. Ayrlan hcrelere yalnzca bu retici yazabilir.
+     *
+     * @param items Eklenecek elemanlar.
+     * @param n Eklenmek istenen eleman says.
+     * @return Gerekte eklenen eleman says (0 -> kuyruk dolu).
+     */
+    size_t try_push_bulk(const T* items, size_t n) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        size_t count;
+        for (;;) {
+            count = 0;
+            while (count < n && count < Capacity) {
+                const size_t seq = cells_[(pos + count) & kMask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count) break;
+                count++;
+            }
+            if (count == 0) {
+                const size_t seq = cells_[pos & kMask].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos) < 0) return 0;  // Dolu.
+                pos = enqueue_pos_.load(std::memory_order_relaxed);                        // Geride kaldk.
+                continue;
+            }
+            if (enqueue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) break;
+        }
+        for (size_t i = 0; i < count; i++) {
+            Cell& cell = cells_[(pos + i) & kMask];
+            cell.data = items[i];
+            cell.sequence.store(pos + i + 1, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /**
+     * @brief En fazla n eleman, ardk dolu hcreleri tek CAS ile sahiplenerek karr.
+     * @param items karlan elemanlarn yazlaca hedef dizi.
+     * @param n karlmak istenen en fazla eleman says.
+     * @return Gerekte karlan eleman says (0 -> kuyruk bo).
+     */
+    size_t try_pop_bulk(T* items, size_t n) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        size_t count;
+        for (;;) {
+            count = 0;
+            while (count < n && count < Capacity) {
+                const size_t seq = cells_[(pos + count) & kMask].sequence.load(std::memory_order_acquire);
+                if (seq != pos + count + 1) break;
+                count++;
+            }
+            if (count == 0) {
+                const size_t seq = cells_[pos & kMask].sequence.load(std::memory_order_acquire);
+                if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0) return 0;  // Bo.
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+                continue;
+            }
+            if (dequeue_pos_.compare_exchange_weak(pos, pos + count, std::memory_order_relaxed)) break;
+        }
+        for (size_t i = 0; i < count; i++) {
+            Cell& cell = cells_[(pos + i) & kMask];
+            items[i] = cell.data;
+            cell.sequence.store(pos + i + Capacity, std::memory_order_release);
+        }
+        return count;
+    }
+
+    /// Anlk doluluk (yaklak; ezamanl kullanmda yalnzca bir ipucudur).
+    size_t size_approx() const {
+        const size_t head = enqueue_pos_.load(std::memory_order_relaxed);
+        const size_t tail = dequeue_pos_.load(std::memory_order_relaxed);
+        return (head >= tail) ? head - tail : 0;
+    }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T data;
+    };
+
+    // retici ve tketici konum sayalar ayr nbellek satrlarnda (false sharing yok).
+    alignas(BITBUF_CACHE_LINE_SIZE) std::atomic<size_t> enqueue_pos_;
+    alignas(BITBUF_CACHE_LINE_SIZE) std::atomic<size_t> dequeue_pos_;
+    alignas(BITBUF_CACHE_LINE_SIZE) Cell cells_[Capacity];
+};
+
+#endif // MPMC_QUEUE_H
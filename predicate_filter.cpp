@@ -0,0 +1,725 @@
+/**
+ * @file predicate_filter.cpp
+ * @brief Yklem Filtresi ekirdekleri: Karlatrma -> Maske (AVX-512 BW / AVX2 / Skaler)
+ *        ve Sktrma (VPCOMPRESS / Kartrma Tablosu / Dalsz Skaler).
+ *
+ * ablonlar uint8_t, uint16_t, uint32_t ve uint64_t iin aka rneklenir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "predicate_filter.h"
+#include "thread_pool.h" // ThreadPool::parallel_for, kParallelGrainBytes
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define PREDICATE_X86_SIMD 1
+#include <immintrin.h>
+#else
+#define PREDICATE_X86_SIMD 0
+#endif
+
+namespace {
+
+const size_t kWordBits = DynamicBitset::kWordBits;
+
+// =========================================================================
+// I. YKLEMN NDRGENMES
+// =========================================================================
+
+// Alt ile  temel karlatrmaya ve bir ters evirmeye iner; ters evirme tm
+// maske kelimesine tek XOR ile uygulanr (rn. LessEqual = !(x > v)).
+enum class CmpKind : uint8_t { Eq, Gt, Lt };
+
+CmpKind cmp_kind(PredicateOp op) {
+	switch (op) {
+	case PredicateOp::Equal:
+	case PredicateOp::NotEqual: return CmpKind::Eq;
+	case PredicateOp::Greater:
+	case PredicateOp::LessEqual: return CmpKind::Gt;
+	default: return CmpKind::Lt;
+	}
+}
+
+bool cmp_inverted(PredicateOp op) {
+	return op == PredicateOp::NotEqual || op == PredicateOp::LessEqual || op == PredicateOp::GreaterEqual;
+}
+
+// Skaler referans: 'count' (<= 64) eleman dalsz olarak tek kelimeye toplar.
+template<typename T, CmpKind K>
+uint64_t evaluate_word_scalar(const T* v, size_t count, const Predicate<T>& p) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < count; j++) {
+		const T x = static_cast<T>((v[j] & p.and_mask) - p.bias);
+		const bool hit = (K == CmpKind::Eq) ? (x == p.value) : (K == CmpKind::Gt) ? (x > p.value) : (x < p.value);
+		word |= static_cast<uint64_t>(hit) << j;
+	}
+	return word;
+}
+
+template<typename T, CmpKind K>
+void evaluate_scalar(const T* values, size_t n, const Predicate<T>& p, uint64_t* out) {
+	for (size_t i = 0; i < n; i += kWordBits) {
+		out[i / kWordBits] = evaluate_word_scalar<T, K>(values + i, (n - i < kWordBits) ? n - i : kWordBits, p);
+	}
+}
+
+
+// =========================================================================
+// II. SIKITIRMA TABLOSU (AVX2 / SSSE3)
+// =========================================================================
+
+/**
+ * MHENDSLK NOTU: 8 bitlik her seim maskesi iin, seili eritlerin indekslerini
+ * (bayt olarak, srayla) ieren 8 baytlk bir kelime. Tek tablo drt genilie de hizmet
+ * eder: 8-bit'te dorudan PSHUFB denetimi, 16-bit'te (2i, 2i+1) bayt iftlerine alr,
+ * 32-bit'te VPMOVZXBD ile VPERMD indeksine geniletilir. Boyut 256 * 8 = 2 KB (L1'de kalr).
+ */
+struct CompressLut {
+	uint64_t index[256];
+};
+
+constexpr CompressLut build_compress_lut() {
+	CompressLut lut = {};
+	for (int m = 0; m < 256; m++) {
+		uint64_t packed = 0;
+		int k = 0;
+		for (int j = 0; j < 8; j++) {
+			if ((m >> j) & 1) packed |= static_cast<uint64_t>(j) << (8 * k++);
+		}
+		lut.index[m] = packed;
+	}
+	return lut;
+}
+
+constexpr CompressLut kCompressLut = build_compress_lut();
+
+// Skaler dalsz sktrma: Her eleman yazlr, kt konumu yalnzca seiliyse ilerler.
+template<typename T>
+size_t compact_word_scalar(const T* v, uint64_t word, size_t count, T* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < count; j++) {
+		out[k] = v[j];
+		k += (word >> j) & 1;
+	}
+	return k;
+}
+
+template<typename T>
+size_t compact_scalar(const T* values, const uint64_t* words, size_t n, T* out) {
+	size_t k = 0;
+	for (size_t i = 0; i < n; i += kWordBits) {
+		const uint64_t word = words[i / kWordBits];
+		const size_t count = (n - i < kWordBits) ? n - i : kWordBits;
+		if (word == 0) continue;
+		if (word == ~0ull) {
+			std::memmove(out + k, values + i, kWordBits * sizeof(T));   // Tam dolu kelime: toplu kopya.
+			k += kWordBits;
+			continue;
+		}
+		k += compact_word_scalar(values + i, word, count, out + k);
+	}
+	return k;
+}
+
+size_t select_indices_scalar(const uint64_t* words, size_t n, uint32_t* out) {
+	size_t k = 0;
+	for (size_t w = 0; w * kWordBits < n; w++) {
+		uint64_t word = words[w];
+		const uint32_t base = static_cast<uint32_t>(w * kWordBits);
+		while (word != 0) {
+			out[k++] = base + static_cast<uint32_t>(find_first_set_bit(word));
+			word &= word - 1;
+		}
+	}
+	return k;
+}
+
+
+// =========================================================================
+// III. AVX2 EKRDEKLER
+// =========================================================================
+
+#if PREDICATE_X86_SIMD
+
+// Genilie zg erit ilemleri. AVX2'de yalnzca iaretli karlatrma vardr; iaretsiz
+// x > v, iaret biti evrilerek (x ^ 0x80..) > (v ^ 0x80..) ile elde edilir.
+struct Avx2Lanes8 {
+	typedef uint8_t T;
+	static const size_t kPerVec = 32;
+	__attribute__((target("avx2"))) static __m256i set1(T v) { return _mm256_set1_epi8(static_cast<char>(v)); }
+	__attribute__((target("avx2"))) static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi8(a, b); }
+	__attribute__((target("avx2"))) static __m256i eq(__m256i a, __m256i b) { return _mm256_cmpeq_epi8(a, b); }
+	__attribute__((target("avx2"))) static __m256i gt(__m256i a, __m256i b) { return _mm256_cmpgt_epi8(a, b); }
+};
+
+struct Avx2Lanes16 {
+	typedef uint16_t T;
+	static const size_t kPerVec = 16;
+	__attribute__((target("avx2"))) static __m256i set1(T v) { return _mm256_set1_epi16(static_cast<short>(v)); }
+	__attribute__((target("avx2"))) static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi16(a, b); }
+	__attribute__((target("avx2"))) static __m256i eq(__m256i a, __m256i b) { return _mm256_cmpeq_epi16(a, b); }
+	__attribute__((target("avx2"))) static __m256i gt(__m256i a, __m256i b) { return _mm256_cmpgt_epi16(a, b); }
+};
+
+struct Avx2Lanes32 {
+	typedef uint32_t T;
+	static const size_t kPerVec = 8;
+	__attribute__((target("avx2"))) static __m256i set1(T v) { return _mm256_set1_epi32(static_cast<int>(v)); }
+	__attribute__((target("avx2"))) static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi32(a, b); }
+	__attribute__((target("avx2"))) static __m256i eq(__m256i a, __m256i b) { return _mm256_cmpeq_epi32(a, b); }
+	__attribute__((target("avx2"))) static __m256i gt(__m256i a, __m256i b) { return _mm256_cmpgt_epi32(a, b); }
+};
+
+struct Avx2Lanes64 {
+	typedef uint64_t T;
+	static const size_t kPerVec = 4;
+	__attribute__((target("avx2"))) static __m256i set1(T v) { return _mm256_set1_epi64x(static_cast<long long>(v)); }
+	__attribute__((target("avx2"))) static __m256i sub(__m256i a, __m256i b) { return _mm256_sub_epi64(a, b); }
+	__attribute__((target("avx2"))) static __m256i eq(__m256i a, __m256i b) { return _mm256_cmpeq_epi64(a, b); }
+	__attribute__((target("avx2"))) static __m256i gt(__m256i a, __m256i b) { return _mm256_cmpgt_epi64(a, b); }
+};
+
+template<typename Lanes>
+struct Avx2Params {
+	__m256i and_mask, bias, value, sign;
+};
+
+// Bir vektrlk yklem: Seili eritler tm bitleri 1.
+template<typename Lanes, CmpKind K>
+__attribute__((target("avx2")))
+inline __m256i lanes_predicate(const typename Lanes::T* p, const Avx2Params<Lanes>& c) {
+	__m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+	x = Lanes::sub(_mm256_and_si256(x, c.and_mask), c.bias);
+	if (K == CmpKind::Eq) return Lanes::eq(x, c.value);
+	x = _mm256_xor_si256(x, c.sign);
+	return (K == CmpKind::Gt) ? Lanes::gt(x, c.value) : Lanes::gt(c.value, x);
+}
+
+// 64 eleman tek maske kelimesine toplar (genilie gre hareket maskesi).
+template<CmpKind K>
+__attribute__((target("avx2")))
+inline uint64_t mask_word_avx2(const uint8_t* p, const Avx2Params<Avx2Lanes8>& c) {
+	const uint32_t lo = static_cast<uint32_t>(_mm256_movemask_epi8(lanes_predicate<Avx2Lanes8, K>(p, c)));
+	const uint32_t hi = static_cast<uint32_t>(_mm256_movemask_epi8(lanes_predicate<Avx2Lanes8, K>(p + 32, c)));
+	return lo | (static_cast<uint64_t>(hi) << 32);
+}
+
+template<CmpKind K>
+__attribute__((target("avx2")))
+inline uint64_t mask_word_avx2(const uint16_t* p, const Avx2Params<Avx2Lanes16>& c) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < kWordBits; j += 32) {
+		// PACKSSWB 128-bit eritler iinde birletirir; VPERMQ (0xD8) eleman srasn dzeltir.
+		const __m256i packed = _mm256_packs_epi16(lanes_predicate<Avx2Lanes16, K>(p + j, c),
+		                                          lanes_predicate<Avx2Lanes16, K>(p + j + 16, c));
+		const uint32_t bits = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_permute4x64_epi64(packed, 0xD8)));
+		word |= static_cast<uint64_t>(bits) << j;
+	}
+	return word;
+}
+
+template<CmpKind K>
+__attribute__((target("avx2")))
+inline uint64_t mask_word_avx2(const uint32_t* p, const Avx2Params<Avx2Lanes32>& c) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < kWordBits; j += 8) {
+		const uint32_t bits = static_cast<uint32_t>(
+			_mm256_movemask_ps(_mm256_castsi256_ps(lanes_predicate<Avx2Lanes32, K>(p + j, c))));
+		word |= static_cast<uint64_t>(bits) << j;
+	}
+	return word;
+}
+
+template<CmpKind K>
+__attribute__((target("avx2")))
+inline uint64_t mask_word_avx2(const uint64_t* p, const Avx2Params<Avx2Lanes64>& c) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < kWordBits; j += 4) {
+		const uint32_t bits = static_cast<uint32_t>(
+			_mm256_movemask_pd(_mm256_castsi256_pd(lanes_predicate<Avx2Lanes64, K>(p + j, c))));
+		word |= static_cast<uint64_t>(bits) << j;
+	}
+	return word;
+}
+
+template<typename Lanes, CmpKind K>
+__attribute__((target("avx2")))
+void evaluate_avx2(const typename Lanes::T* values, size_t n, const Predicate<typename Lanes::T>& p, uint64_t* out) {
+	typedef typename Lanes::T T;
+	Avx2Params<Lanes> c;
+	c.and_mask = Lanes::set1(p.and_mask);
+	c.bias = Lanes::set1(p.bias);
+	c.sign = Lanes::set1(static_cast<T>(static_cast<T>(1) << (sizeof(T) * 8 - 1)));
+	c.value = (K == CmpKind::Eq) ? Lanes::set1(p.value) : _mm256_xor_si256(Lanes::set1(p.value), c.sign);
+	const size_t full = n / kWordBits;
+	for (size_t w = 0; w < full; w++) out[w] = mask_word_avx2<K>(values + w * kWordBits, c);
+	if (n % kWordBits) out[full] = evaluate_word_scalar<T, K>(values + full * kWordBits, n % kWordBits, p);
+}
+
+// 8 elemanlk paralar: Seili eritler tablo indeksleriyle baa toplanr ve tam para
+// yazlr (kt konumu k <= girdi konumu i olduundan yazma girdinin nne tamaz).
+__attribute__((target("avx2")))
+inline size_t compact8_avx2(const uint8_t* v, uint32_t m, uint8_t* out) {
+	const __m128i ctrl = _mm_cvtsi64_si128(static_cast<long long>(kCompressLut.index[m]));
+	_mm_storel_epi64(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(v)), ctrl));
+	return static_cast<size_t>(__builtin_popcount(m));
+}
+
+__attribute__((target("avx2")))
+inline size_t compact8_avx2(const uint16_t* v, uint32_t m, uint16_t* out) {
+	const __m128i idx = _mm_cvtsi64_si128(static_cast<long long>(kCompressLut.index[m]));
+	const __m128i twice = _mm_add_epi8(idx, idx);
+	const __m128i ctrl = _mm_unpacklo_epi8(twice, _mm_add_epi8(twice, _mm_set1_epi8(1)));
+	_mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(v)), ctrl));
+	return static_cast<size_t>(__builtin_popcount(m));
+}
+
+__attribute__((target("avx2")))
+inline size_t compact8_avx2(const uint32_t* v, uint32_t m, uint32_t* out) {
+	const __m256i idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(kCompressLut.index[m])));
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+	                    _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v)), idx));
+	return static_cast<size_t>(__builtin_popcount(m));
+}
+
+// 64-bit: 4 elemanlk para; her eleman iki 32-bit erittir (maske bitleri ikilenir).
+__attribute__((target("avx2")))
+inline size_t compact4_avx2(const uint64_t* v, uint32_t m, uint64_t* out) {
+	static const uint8_t kPairs[16] = { 0x00, 0x03, 0x0C, 0x0F, 0x30, 0x33, 0x3C, 0x3F,
+	                                    0xC0, 0xC3, 0xCC, 0xCF, 0xF0, 0xF3, 0xFC, 0xFF };
+	const __m256i idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(kCompressLut.index[kPairs[m]])));
+	_mm256_storeu_si256(reinterpret_cast<__m256i*>(out),
+	                    _mm256_permutevar8x32_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(v)), idx));
+	return static_cast<size_t>(__builtin_popcount(m));
+}
+
+template<typename T>
+__attribute__((target("avx2")))
+size_t compact_word_avx2(const T* v, uint64_t word, T* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < kWordBits; j += 8) k += compact8_avx2(v + j, static_cast<uint32_t>(word >> j) & 0xFF, out + k);
+	return k;
+}
+
+__attribute__((target("avx2")))
+size_t compact_word_avx2(const uint64_t* v, uint64_t word, uint64_t* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < kWordBits; j += 4) k += compact4_avx2(v + j, static_cast<uint32_t>(word >> j) & 0xF, out + k);
+	return k;
+}
+
+template<typename T>
+__attribute__((target("avx2")))
+size_t compact_avx2(const T* values, const uint64_t* words, size_t n, T* out) {
+	size_t k = 0;
+	const size_t full = n / kWordBits;
+	for (size_t w = 0; w < full; w++) {
+		const uint64_t word = words[w];
+		if (word == 0) continue;
+		k += compact_word_avx2(values + w * kWordBits, word, out + k);
+	}
+	if (n % kWordBits) k += compact_word_scalar(values + full * kWordBits, words[full], n % kWordBits, out + k);
+	return k;
+}
+
+__attribute__((target("avx2")))
+size_t select_indices_avx2(const uint64_t* words, size_t n, uint32_t* out) {
+	size_t k = 0;
+	const size_t full = n / kWordBits;
+	const __m256i step = _mm256_set1_epi32(8);
+	for (size_t w = 0; w < full; w++) {
+		const uint64_t word = words[w];
+		if (word == 0) continue;
+		__m256i base = _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(w * kWordBits)),
+		                                _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+		for (size_t j = 0; j < kWordBits; j += 8) {
+			const uint32_t m = static_cast<uint32_t>(word >> j) & 0xFF;
+			const __m256i idx = _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(kCompressLut.index[m])));
+			_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), _mm256_permutevar8x32_epi32(base, idx));
+			k += static_cast<size_t>(__builtin_popcount(m));
+			base = _mm256_add_epi32(base, step);
+		}
+	}
+	if (n % kWordBits) {
+		uint64_t word = words[full];
+		while (word != 0) {
+			out[k++] = static_cast<uint32_t>(full * kWordBits) + static_cast<uint32_t>(find_first_set_bit(word));
+			word &= word - 1;
+		}
+	}
+	return k;
+}
+
+
+// =========================================================================
+// IV. AVX-512 EKRDEKLER (BW: KARILATIRMA, F/VBMI2: VPCOMPRESS)
+// =========================================================================
+
+// VPCMPU dorudan k-maske retir; imm sabit olmaldr (EQ = 0, LT = 1, NLE = 6).
+template<CmpKind K>
+struct Avx512Imm {
+	static const int value = (K == CmpKind::Eq) ? _MM_CMPINT_EQ : (K == CmpKind::Gt) ? _MM_CMPINT_NLE : _MM_CMPINT_LT;
+};
+
+template<CmpKind K>
+__attribute__((target("avx512f,avx512bw")))
+inline uint64_t mask_word_avx512(const uint8_t* p, __m512i am, __m512i bias, __m512i val) {
+	const __m512i x = _mm512_sub_epi8(_mm512_and_si512(_mm512_loadu_si512(p), am), bias);
+	return _mm512_cmp_epu8_mask(x, val, Avx512Imm<K>::value);
+}
+
+template<CmpKind K>
+__attribute__((target("avx512f,avx512bw")))
+inline uint64_t mask_word_avx512(const uint16_t* p, __m512i am, __m512i bias, __m512i val) {
+	const __m512i lo = _mm512_sub_epi16(_mm512_and_si512(_mm512_loadu_si512(p), am), bias);
+	const __m512i hi = _mm512_sub_epi16(_mm512_and_si512(_mm512_loadu_si512(p + 32), am), bias);
+	// KUNPCKDQ: ki 32-bit k-maskesini tek 64-bit maskede birletirir (yksek yar ilk ilenen).
+	return _mm512_kunpackd(_mm512_cmp_epu16_mask(hi, val, Avx512Imm<K>::value),
+	                       _mm512_cmp_epu16_mask(lo, val, Avx512Imm<K>::value));
+}
+
+template<CmpKind K>
+__attribute__((target("avx512f,avx512bw")))
+inline uint64_t mask_word_avx512(const uint32_t* p, __m512i am, __m512i bias, __m512i val) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < kWordBits; j += 16) {
+		const __m512i x = _mm512_sub_epi32(_mm512_and_si512(_mm512_loadu_si512(p + j), am), bias);
+		word |= static_cast<uint64_t>(_mm512_cmp_epu32_mask(x, val, Avx512Imm<K>::value)) << j;
+	}
+	return word;
+}
+
+template<CmpKind K>
+__attribute__((target("avx512f,avx512bw")))
+inline uint64_t mask_word_avx512(const uint64_t* p, __m512i am, __m512i bias, __m512i val) {
+	uint64_t word = 0;
+	for (size_t j = 0; j < kWordBits; j += 8) {
+		const __m512i x = _mm512_sub_epi64(_mm512_and_si512(_mm512_loadu_si512(p + j), am), bias);
+		word |= static_cast<uint64_t>(_mm512_cmp_epu64_mask(x, val, Avx512Imm<K>::value)) << j;
+	}
+	return word;
+}
+
+__attribute__((target("avx512f,avx512bw"))) inline __m512i set1_512(uint8_t v) { return _mm512_set1_epi8(static_cast<char>(v)); }
+__attribute__((target("avx512f,avx512bw"))) inline __m512i set1_512(uint16_t v) { return _mm512_set1_epi16(static_cast<short>(v)); }
+__attribute__((target("avx512f"))) inline __m512i set1_512(uint32_t v) { return _mm512_set1_epi32(static_cast<int>(v)); }
+__attribute__((target("avx512f"))) inline __m512i set1_512(uint64_t v) { return _mm512_set1_epi64(static_cast<long long>(v)); }
+
+template<typename T, CmpKind K>
+__attribute__((target("avx512f,avx512bw")))
+void evaluate_avx512(const T* values, size_t n, const Predicate<T>& p, uint64_t* out) {
+	const __m512i am = set1_512(p.and_mask), bias = set1_512(p.bias), val = set1_512(p.value);
+	const size_t full = n / kWordBits;
+	for (size_t w = 0; w < full; w++) out[w] = mask_word_avx512<K>(values + w * kWordBits, am, bias, val);
+	if (n % kWordBits) out[full] = evaluate_word_scalar<T, K>(values + full * kWordBits, n % kWordBits, p);
+}
+
+// Maskeli depolama yalnzca seili sayda erit yazar; ktnn tesine tama olmaz.
+__attribute__((target("avx512f,avx512bw,avx512vbmi2,bmi2")))
+inline size_t compact_word_avx512(const uint8_t* v, uint64_t word, uint8_t* out) {
+	const __m512i c = _mm512_maskz_compress_epi8(word, _mm512_loadu_si512(v));
+	const size_t count = static_cast<size_t>(__builtin_popcountll(word));
+	_mm512_mask_storeu_epi8(out, _bzhi_u64(~0ull, static_cast<unsigned>(count)), c);
+	return count;
+}
+
+__attribute__((target("avx512f,avx512bw,avx512vbmi2,bmi2")))
+inline size_t compact_word_avx512(const uint16_t* v, uint64_t word, uint16_t* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < kWordBits; j += 32) {
+		const __mmask32 m = static_cast<__mmask32>(word >> j);
+		const __m512i c = _mm512_maskz_compress_epi16(m, _mm512_loadu_si512(v + j));
+		const unsigned count = static_cast<unsigned>(__builtin_popcount(m));
+		_mm512_mask_storeu_epi16(out + k, static_cast<__mmask32>(_bzhi_u32(~0u, count)), c);
+		k += count;
+	}
+	return k;
+}
+
+__attribute__((target("avx512f,bmi2")))
+inline size_t compact_word_avx512(const uint32_t* v, uint64_t word, uint32_t* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < kWordBits; j += 16) {
+		const __mmask16 m = static_cast<__mmask16>(word >> j);
+		const __m512i c = _mm512_maskz_compress_epi32(m, _mm512_loadu_si512(v + j));
+		const unsigned count = static_cast<unsigned>(__builtin_popcount(m));
+		_mm512_mask_storeu_epi32(out + k, static_cast<__mmask16>(_bzhi_u32(~0u, count)), c);
+		k += count;
+	}
+	return k;
+}
+
+__attribute__((target("avx512f,bmi2")))
+inline size_t compact_word_avx512(const uint64_t* v, uint64_t word, uint64_t* out) {
+	size_t k = 0;
+	for (size_t j = 0; j < kWordBits; j += 8) {
+		const __mmask8 m = static_cast<__mmask8>(word >> j);
+		const __m512i c = _mm512_maskz_compress_epi64(m, _mm512_loadu_si512(v + j));
+		const unsigned count = static_cast<unsigned>(__builtin_popcount(m));
+		_mm512_mask_storeu_epi64(out + k, static_cast<__mmask8>(_bzhi_u32(~0u, count)), c);
+		k += count;
+	}
+	return k;
+}
+
+template<typename T>
+__attribute__((target("avx512f,avx512bw,bmi2")))
+size_t compact_avx512(const T* values, const uint64_t* words, size_t n, T* out) {
+	size_t k = 0;
+	const size_t full = n / kWordBits;
+	for (size_t w = 0; w < full; w++) {
+		const uint64_t word = words[w];
+		if (word == 0) continue;
+		k += compact_word_avx512(values + w * kWordBits, word, out + k);
+	}
+	if (n % kWordBits) k += compact_word_scalar(values + full * kWordBits, words[full], n % kWordBits, out + k);
+	return k;
+}
+
+__attribute__((target("avx512f,bmi2")))
+size_t select_indices_avx512(const uint64_t* words, size_t n, uint32_t* out) {
+	size_t k = 0;
+	const size_t full = n / kWordBits;
+	const __m512i iota = _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+	for (size_t w = 0; w < full; w++) {
+		const uint64_t word = words[w];
+		if (word == 0) continue;
+		for (size_t j = 0; j < kWordBits; j += 16) {
+			const __mmask16 m = static_cast<__mmask16>(word >> j);
+			const __m512i idx = _mm512_add_epi32(_mm512_set1_epi32(static_cast<int>(w * kWordBits + j)), iota);
+			const unsigned count = static_cast<unsigned>(__builtin_popcount(m));
+			_mm512_mask_storeu_epi32(out + k, static_cast<__mmask16>(_bzhi_u32(~0u, count)), _mm512_maskz_compress_epi32(m, idx));
+			k += count;
+		}
+	}
+	if (n % kWordBits) {
+		uint64_t word = words[full];
+		while (word != 0) {
+			out[k++] = static_cast<uint32_t>(full * kWordBits) + static_cast<uint32_t>(find_first_set_bit(word));
+			word &= word - 1;
+		}
+	}
+	return k;
+}
+
+#endif // PREDICATE_X86_SIMD
+
+
+// =========================================================================
+// V. DISPATCH
+// =========================================================================
+
+enum class PredicateLevel : uint8_t { Scalar, Avx2, Avx512 };
+
+struct PredicateDispatch {
+	PredicateLevel level;
+	bool vbmi2;             ///< 8/16-bit VPCOMPRESS (yoksa AVX-512'de bu genilikler AVX2 tablosunu kullanr).
+	const char* name;
+};
+
+PredicateDispatch build_predicate_dispatch() {
+	PredicateDispatch d = { PredicateLevel::Scalar, false, "scalar" };
+#if PREDICATE_X86_SIMD
+	const BitopsCpuFeatures& f = bitops_cpu_features();
+	if (f.avx2) { d.level = PredicateLevel::Avx2; d.name = "avx2"; }
+	if (f.avx512bw && f.bmi2) { d.level = PredicateLevel::Avx512; d.vbmi2 = f.avx512_vbmi2; d.name = "avx512"; }
+#endif
+	return d;
+}
+
+const PredicateDispatch& predicate_dispatch() {
+	static const PredicateDispatch d = build_predicate_dispatch();
+	return d;
+}
+
+template<typename T> struct Avx2LanesFor;
+#if PREDICATE_X86_SIMD
+template<> struct Avx2LanesFor<uint8_t> { typedef Avx2Lanes8 type; };
+template<> struct Avx2LanesFor<uint16_t> { typedef Avx2Lanes16 type; };
+template<> struct Avx2LanesFor<uint32_t> { typedef Avx2Lanes32 type; };
+template<> struct Avx2LanesFor<uint64_t> { typedef Avx2Lanes64 type; };
+#endif
+
+template<typename T, CmpKind K>
+void evaluate_dispatch(const T* values, size_t n, const Predicate<T>& p, uint64_t* out) {
+#if PREDICATE_X86_SIMD
+	const PredicateDispatch& d = predicate_dispatch();
+	if (d.level == PredicateLevel::Avx512) { evaluate_avx512<T, K>(values, n, p, out); return; }
+	if (d.level == PredicateLevel::Avx2) { evaluate_avx2<typename Avx2LanesFor<T>::type, K>(values, n, p, out); return; }
+#endif
+	evaluate_scalar<T, K>(values, n, p, out);
+}
+
+// 8/16-bit sktrma VBMI2 ister; 32/64-bit iin AVX-512 F yeterlidir.
+template<typename T>
+bool compact_uses_avx512(const PredicateDispatch& d) {
+	return d.level == PredicateLevel::Avx512 && (sizeof(T) >= 4 || d.vbmi2);
+}
+
+// words'n n bitlik maskesi; tersine evrilen ilelerde kuyruk (n % 64) sfrlanr.
+template<typename T>
+void evaluate_words(const T* values, size_t n, const Predicate<T>& p, uint64_t* words) {
+	switch (cmp_kind(p.op)) {
+	case CmpKind::Eq: evaluate_dispatch<T, CmpKind::Eq>(values, n, p, words); break;
+	case CmpKind::Gt: evaluate_dispatch<T, CmpKind::Gt>(values, n, p, words); break;
+	default: evaluate_dispatch<T, CmpKind::Lt>(values, n, p, words); break;
+	}
+	if (cmp_inverted(p.op)) {
+		const size_t count = (n + kWordBits - 1) / kWordBits;
+		for (size_t w = 0; w < count; w++) words[w] = ~words[w];
+		// Deimez (invariant): size() tesindeki bitler sfr kalr.
+		if (n % kWordBits) words[count - 1] &= CreateMask<uint64_t>(static_cast<int>(n % kWordBits), 0);
+	}
+}
+
+size_t select_indices_dispatch(const uint64_t* words, size_t n, uint32_t* out) {
+#if PREDICATE_X86_SIMD
+	const PredicateDispatch& d = predicate_dispatch();
+	if (d.level == PredicateLevel::Avx512) return select_indices_avx512(words, n, out);
+	if (d.level == PredicateLevel::Avx2) return select_indices_avx2(words, n, out);
+#endif
+	return select_indices_scalar(words, n, out);
+}
+
+template<typename T>
+size_t compact_dispatch(const T* values, const uint64_t* words, size_t n, T* out) {
+#if PREDICATE_X86_SIMD
+	const PredicateDispatch& d = predicate_dispatch();
+	if (compact_uses_avx512<T>(d)) return compact_avx512(values, words, n, out);
+	if (d.level != PredicateLevel::Scalar) return compact_avx2(values, words, n, out);
+#endif
+	return compact_scalar(values, words, n, out);
+}
+
+// ekirdeklerin kt sonundan taabilecei en fazla eleman: AVX2 tam 8'li para yazar,
+// skaler yol seilmeyen son eleman da yazar (1), AVX-512 maskeli yazar (0).
+const size_t kKernelSpill = 8;
+
+/**
+ * MHENDSLK NOTU (Paralel bloklarda tama): Seri yolda kt kapasitesi mask.size()
+ * olduundan ekirdeklerin sonuna taan birka eleman zararszdr; paralel bloklarda ise
+ * komu bloun ktsna der. Blok, sondan en az kKernelSpill seim ieren en ksa
+ * kelime soneki ayrlarak yazlr: nek dorudan 'out'a yazlr (tamas sonekin alanna
+ * der ve sonra ezilir); sonek (en fazla kKernelSpill - 1 + 64 seim) yndaki kk
+ * bir tampona yazlp tam uzunlukta kopyalanr. Bylece blok, kendi aral dna
+ * yazmaz.
+ *
+ * kernel(bit_begin, bit_count, dst): Bloun [bit_begin, bit_begin + bit_count) bitlerinin
+ * seimini dst'ye yazar ve seim saysn dndrr (bit_begin 64'n katdr).
+ */
+template<typename T, typename Kernel>
+size_t write_block_exact(const uint64_t* words, size_t nbits, T* out, Kernel kernel) {
+	size_t split = (nbits + kWordBits - 1) / kWordBits;
+	uint64_t tail_selected = 0;
+	while (split > 0 && tail_selected < kKernelSpill) tail_selected += count_set_bits(words[--split]);
+	const size_t split_bits = split * kWordBits;
+	const size_t head = (split_bits != 0) ? kernel(0, split_bits, out) : 0;
+	T tail[2 * kWordBits + kKernelSpill];
+	const size_t tail_count = kernel(split_bits, nbits - split_bits, tail);
+	std::memcpy(out + head, tail, tail_count * sizeof(T));
+	return head + tail_count;
+}
+
+// Paralel seim/sktrma iin blok bana kt konumlar: offsets[b] = ilk b bloun seim
+// says (kuyruk bitleri deimez gerei sfrdr; kelimeler dorudan saylr).
+std::vector<size_t> selection_offsets(ThreadPool& pool, const DynamicBitset& mask, size_t grain) {
+	const size_t blocks = ThreadPool::block_count(mask.size(), grain);
+	std::vector<size_t> offsets(blocks + 1, 0);
+	const uint64_t* words = mask.data();
+	pool.parallel_for(0, mask.size(), grain, [&](size_t lo, size_t hi) {
+		const size_t w0 = lo / kWordBits;
+		const size_t w1 = (hi + kWordBits - 1) / kWordBits;
+		offsets[lo / grain + 1] = static_cast<size_t>(count_set_bits(words + w0, w1 - w0));
+	});
+	for (size_t b = 0; b < blocks; b++) offsets[b + 1] += offsets[b];
+	return offsets;
+}
+
+} // namespace
+
+
+// =========================================================================
+// VI. GENEL API
+// =========================================================================
+
+template<typename T>
+void predicate_evaluate(const T* values, size_t n, const Predicate<T>& p, DynamicBitset& out) {
+	out.resize(n);
+	evaluate_words(values, n, p, out.data());
+}
+
+size_t predicate_select_indices(const DynamicBitset& mask, uint32_t* out_indices) {
+	return select_indices_dispatch(mask.data(), mask.size(), out_indices);
+}
+
+template<typename T>
+size_t predicate_compact(const T* values, const DynamicBitset& mask, T* out) {
+	return compact_dispatch(values, mask.data(), mask.size(), out);
+}
+
+// Paralel srmler: Blok boyutlar 64'n katdr; her blok maskenin yalnzca kendi
+// kelimelerini okur/yazar.
+template<typename T>
+void predicate_evaluate(ThreadPool& pool, const T* values, size_t n, const Predicate<T>& p, DynamicBitset& out) {
+	out.resize(n);
+	uint64_t* words = out.data();
+	pool.parallel_for(0, n, kParallelGrainBytes / sizeof(T), [&](size_t lo, size_t hi) {
+		evaluate_words(values + lo, hi - lo, p, words + lo / kWordBits);
+	});
+}
+
+size_t predicate_select_indices(ThreadPool& pool, const DynamicBitset& mask, uint32_t* out_indices) {
+	const size_t grain = kParallelGrainBytes / sizeof(uint32_t);
+	const std::vector<size_t> offsets = selection_offsets(pool, mask, grain);
+	pool.parallel_for(0, mask.size(), grain, [&](size_t lo, size_t hi) {
+		const uint64_t* words = mask.data() + lo / kWordBits;
+		// ekirdekler indeksleri verilen kelime iaretisine gre retir; mutlak konuma tanr.
+		write_block_exact(words, hi - lo, out_indices + offsets[lo / grain], [&](size_t b, size_t nb, uint32_t* dst) {
+			const size_t count = select_indices_dispatch(words + b / kWordBits, nb, dst);
+			const uint32_t base = static_cast<uint32_t>(lo + b);
+			for (size_t i = 0; i < count; i++) dst[i] += base;
+			return count;
+		});
+	});
+	return offsets.back();
+}
+
+template<typename T>
+size_t predicate_compact(ThreadPool& pool, const T* values, const DynamicBitset& mask, T* out) {
+	const size_t grain = kParallelGrainBytes / sizeof(T);
+	const std::vector<size_t> offsets = selection_offsets(pool, mask, grain);
+	pool.parallel_for(0, mask.size(), grain, [&](size_t lo, size_t hi) {
+		const uint64_t* words = mask.data() + lo / kWordBits;
+		write_block_exact(words, hi - lo, out + offsets[lo / grain], [&](size_t b, size_t nb, T* dst) {
+			return compact_dispatch(values + lo + b, words + b / kWordBits, nb, dst);
+		});
+	});
+	return offsets.back();
+}
+
+const char* predicate_kernel_name() {
+	return predicate_dispatch().name;
+}
+
+// Ak rnekleme (explicit instantiation).
+template void predicate_evaluate<uint8_t>(const uint8_t*, size_t, const Predicate<uint8_t>&, DynamicBitset&);
+template void predicate_evaluate<uint16_t>(const uint16_t*, size_t, const Predicate<uint16_t>&, DynamicBitset&);
+template void predicate_evaluate<uint32_t>(const uint32_t*, size_t, const Predicate<uint32_t>&, DynamicBitset&);
+template void predicate_evaluate<uint64_t>(const uint64_t*, size_t, const Predicate<uint64_t>&, DynamicBitset&);
+template size_t predicate_compact<uint8_t>(const uint8_t*, const DynamicBitset&, uint8_t*);
+template size_t predicate_compact<uint16_t>(const uint16_t*, const DynamicBitset&, uint16_t*);
+template size_t predicate_compact<uint32_t>(const uint32_t*, const DynamicBitset&, uint32_t*);
+template size_t predicate_compact<uint64_t>(const uint64_t*, const DynamicBitset&, uint64_t*);
+template void predicate_evaluate<uint8_t>(ThreadPool&, const uint8_t*, size_t, const Predicate<uint8_t>&, DynamicBitset&);
+template void predicate_evaluate<uint16_t>(ThreadPool&, const uint16_t*, size_t, const Predicate<uint16_t>&, DynamicBitset&);
+template void predicate_evaluate<uint32_t>(ThreadPool&, const uint32_t*, size_t, const Predicate<uint32_t>&, DynamicBitset&);
+template void predicate_evaluate<uint64_t>(ThreadPool&, const uint64_t*, size_t, const Predicate<uint64_t>&, DynamicBitset&);
+template size_t predicate_compact<uint8_t>(ThreadPool&, const uint8_t*, const DynamicBitset&, uint8_t*);
+template size_t predicate_compact<uint16_t>(ThreadPool&, const uint16_t*, const DynamicBitset&, uint16_t*);
+template size_t predicate_compact<uint32_t>(ThreadPool&, const uint32_t*, const DynamicBitset&, uint32_t*);
+template size_t predicate_compact<uint64_t>(ThreadPool&, const uint64_t*, const DynamicBitset&, uint64_t*);
@@ -0,0 +1,142 @@
+/**
+ * @file predicate_filter.h
+ * @brief SIMD Yklem (Predicate) Filtresi: Stun -> Bit Maskesi -> Sktrlm Seim.
+ *
+ * Kayt tamponlarn aralk kontrol ve bayrak maskesi (isBitSet / get_bit_field) gibi
+ * yklemlerle szmek iin  aamal, dalsz (branchless) bir hat salar:
+ * 1. Deerlendirme: uint8/16/32/64 stunu, eleman bana bir bit olan paketlenmi bir
+ *    maskeye (DynamicBitset) evrilir (AVX-512 BW / AVX2 / skaler).
+ * 2. Birletirme: Birden ok yklemin maskeleri DynamicBitset'in &=, |=, ^=, and_not
+ *    ilemleriyle kelime dzeyinde birletirilir.
+ * 3. Sktrma: Seilen elemanlar veya indeksleri bitiik bir ktya yazlr
+ *    (AVX-512 VPCOMPRESS, AVX2'de kartrma (shuffle) tablosu, skalerde dalsz yazma).
+ *
+ * Eleman bana 'if' ieren filtre, seicilik %50 civarndayken dal tahminini srekli
+ * skalar; bu modlde hibir aama veriye bal dal iermez.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef PREDICATE_FILTER_H
+#define PREDICATE_FILTER_H
+
+#include <cstddef>
+#include <cstdint>
+#include "bitops.h"          // CreateMask
+#include "dynamic_bitset.h"
+
+/// aretsiz karlatrma ileci.
+enum class PredicateOp : uint8_t {
+    Equal = 0,
+    NotEqual = 1,
+    Less = 2,
+    LessEqual = 3,
+    Greater = 4,
+    GreaterEqual = 5
+};
+
+/**
+ * @brief Tek bir stun yklemi: ((x & and_mask) - bias) op value (iaretsiz, modulo 2^N).
+ *
+ * MHENDSLK NOTU (Tek karlatrmaya indirgeme): Tm yklem biimleri ayn ekirdee
+ * iner. Aralk lo <= x <= hi, sarma aritmetiiyle (x - lo) <= (hi - lo) olur (tek
+ * karlatrma). Bit alan, alan yerinde maskeleyerek karlatrlr: get_bit_field(x)
+ * op v, (x & maske) op (v << start) ile ayn sralamay verir; kaydrma gerekmez.
+ *
+ * @tparam T uint8_t, uint16_t, uint32_t veya uint64_t.
+ */
+template<typename T>
+struct Predicate {
+    T and_mask;
+    T bias;
+    PredicateOp op;
+    T value;
+
+    /// x op value.
+    static Predicate compare(PredicateOp op, T value) {
+        return Predicate{ static_cast<T>(~static_cast<T>(0)), 0, op, value };
+    }
+
+    /// lo <= x <= hi (lo <= hi olmaldr).
+    static Predicate in_range(T lo, T hi) {
+        return Predicate{ static_cast<T>(~static_cast<T>(0)), lo, PredicateOp::LessEqual, static_cast<T>(hi - lo) };
+    }
+
+    /// isBitSet(x, index).
+    static Predicate bit_set(int index) {
+        return Predicate{ CreateMask<T>(1, index), 0, PredicateOp::NotEqual, 0 };
+    }
+
+    /// (x & mask) == expected: Bayrak kmesi testi (rn. "A ak ve B kapal").
+    static Predicate flags(T mask, T expected) {
+        return Predicate{ mask, 0, PredicateOp::Equal, static_cast<T>(expected & mask) };
+    }
+
+    /**
+     * @brief get_bit_field(x, start_bit, length) op value.
+     *
+     * value alann en byk deerini (2^length - 1) ayorsa kesilmez: Less, LessEqual ve
+     * NotEqual her elemanda true, Greater, GreaterEqual ve Equal her elemanda false olur.
+     */
+    static Predicate bit_field(int start_bit, int length, PredicateOp op, T value) {
+        const T mask = CreateMask<T>(length, start_bit);
+        if (value > CreateMask<T>(length, 0)) {
+            // Alan deeri daima value'dan kktr: (x & mask) <= mask daima true, > mask daima false.
+            const bool always = (op == PredicateOp::Less || op == PredicateOp::LessEqual || op == PredicateOp::NotEqual);
+            return Predicate{ mask, 0, always ? PredicateOp::LessEqual : PredicateOp::Greater, mask };
+        }
+        return Predicate{ mask, 0, op, static_cast<T>(value << start_bit) };
+    }
+};
+
+/**
+ * @brief Yklemi bir stun zerinde deerlendirir: out'un i. biti = p(values[i]).
+ * @param values Stun (n eleman).
+ * @param n Eleman says.
+ * @param p Yklem.
+ * @param out Sonu maskesi; n bite yeniden boyutlandrlr.
+ */
+template<typename T>
+void predicate_evaluate(const T* values, size_t n, const Predicate<T>& p, DynamicBitset& out);
+
+/**
+ * @brief Seili bitlerin indekslerini artan srada yazar.
+ * @param mask Seim maskesi (en fazla 2^32 bit).
+ * @param out_indices En az mask.size() kapasiteli kt.
+ * @return Yazlan indeks says (= mask.count()).
+ */
+size_t predicate_select_indices(const DynamicBitset& mask, uint32_t* out_indices);
+
+/**
+ * @brief Maskede seili elemanlar sray koruyarak bitiik yazar (stream compaction).
+ * @param values Stun (mask.size() eleman).
+ * @param mask Seim maskesi.
+ * @param out En az mask.size() kapasiteli kt; 'values' ile ayn olabilir (yerinde).
+ * @return Yazlan eleman says.
+ */
+template<typename T>
+size_t predicate_compact(const T* values, const DynamicBitset& mask, T* out);
+
+/**
+ * @brief predicate_evaluate, predicate_select_indices ve predicate_compact'n paralel
+ * srmleri (thread_pool.h); sonular seri srmlerle bit bit ayndr.
+ *
+ * Stun, 64'n kat elemanlk bloklara blnr; deerlendirmede her blok maskenin kendi
+ * kelimelerini yazar. Seim ve sktrmada nce bloklarn seim saylar paralel saylr,
+ * kt konumlar srayla n ek toplamyla (prefix sum) bulunur, ardndan her blok kendi
+ * konumuna yazar. predicate_compact'n paralel srmnde 'out', 'values' ile
+ * akmamaldr (yerinde sktrma yalnzca seri srmde geerlidir).
+ */
+template<typename T>
+void predicate_evaluate(ThreadPool& pool, const T* values, size_t n, const Predicate<T>& p, DynamicBitset& out);
+size_t predicate_select_indices(ThreadPool& pool, const DynamicBitset& mask, uint32_t* out_indices);
+template<typename T>
+size_t predicate_compact(ThreadPool& pool, const T* values, const DynamicBitset& mask, T* out);
+
+/// Seilen ekirdein ad ("avx512", "avx2" veya "scalar").
+const char* predicate_kernel_name();
+
+#endif // PREDICATE_FILTER_H
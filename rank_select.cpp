@@ -0,0 +1,170 @@
+/**
+ * @file rank_select.cpp
+ * @brief Rank/Select ndeksi Kurulumu, Select Aramas ve Kelime i Select ekirdekleri.
+ *
+ * rank1 satr ii (inline) olmas iin 'rank_select.h' dosyasndadr. Bu dosya indeks
+ * kurulumunu, select1 aramasn ve alma zamannda seilen kelime ii select
+ * ekirdeklerini (BMI2 PDEP/TZCNT veya tanabilir) ierir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "rank_select.h"
+
+#if defined(__x86_64__) && defined(__GNUC__)
+#define RANK_SELECT_X86_BMI 1
+#include <immintrin.h>
+#else
+#define RANK_SELECT_X86_BMI 0
+#endif
+
+namespace {
+
+// =========================================================================
+// I. KELME  SELECT EKRDEKLER
+// =========================================================================
+
+/**
+ * MHENDSLK NOTU (Tanabilir select): nce SWAR ile byte bana popcount alnr ve
+ * 0x0101..01 ile arplarak byte'lar aras n ek toplam (prefix sum) elde edilir. Aranan
+ * byte en fazla 8 admda bulunur; byte iinde en fazla 7 kez x & (x - 1) ile alt bitler
+ * silinir ve kalan en dk bit find_first_set_bit ile okunur.
+ */
+int select64_portable(uint64_t x, int k) {
+	uint64_t counts = x - ((x >> 1) & 0x5555555555555555ULL);
+	counts = (counts & 0x3333333333333333ULL) + ((counts >> 2) & 0x3333333333333333ULL);
+	counts = (counts + (counts >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+	const uint64_t prefix = counts * 0x0101010101010101ULL;   // Byte i: 0..i byte'larnn toplam.
+
+	int byte = 0;
+	while (static_cast<int>(get_bit_field(prefix, byte * 8, 8)) <= k) byte++;
+	if (byte > 0) k -= static_cast<int>(get_bit_field(prefix, (byte - 1) * 8, 8));
+
+	uint64_t bits = get_bit_field(x, byte * 8, 8);
+	for (int i = 0; i < k; i++) bits &= bits - 1;
+	return byte * 8 + find_first_set_bit(bits);
+}
+
+#if RANK_SELECT_X86_BMI
+// PDEP, (1 << k) bitini x'in k. '1' bitinin konumuna yerletirir; TZCNT konumu okur.
+__attribute__((target("bmi,bmi2")))
+int select64_pdep(uint64_t x, int k) {
+	return static_cast<int>(_tzcnt_u64(_pdep_u64(static_cast<uint64_t>(1) << k, x)));
+}
+#endif
+
+struct SelectDispatch {
+	int (*select64)(uint64_t, int);
+	const char* name;
+};
+
+SelectDispatch build_select_dispatch() {
+	SelectDispatch d = { select64_portable, "portable" };
+#if RANK_SELECT_X86_BMI
+	// Zen1/Zen2'de PDEP mikrokodludur; orada tanabilir yol daha hzldr (bmi2_fast).
+	if (bitops_cpu_features().bmi2_fast) {
+		d.select64 = select64_pdep;
+		d.name = "bmi2-pdep";
+	}
+#endif
+	return d;
+}
+
+const SelectDispatch& select_dispatch() {
+	static const SelectDispatch d = build_select_dispatch();
+	return d;
+}
+
+const size_t kWordsPerBlock = RankSelectIndex::kBlockBits / 64;
+const size_t kWordsPerSubBlock = RankSelectIndex::kSubBlockBits / 64;
+const size_t kSubBlocksPerBlock = RankSelectIndex::kBlockBits / RankSelectIndex::kSubBlockBits;
+
+} // namespace
+
+
+// =========================================================================
+// II. KURULUM (BUILD)
+// =========================================================================
+
+RankSelectIndex::RankSelectIndex(const uint64_t* words, size_t nbits)
+	: words_(words), nbits_(nbits), ones_(0) {
+	const size_t nwords = (nbits + 63) / 64;
+	// pos == nbits sorgular iin biti gzcs (sentinel) kaytlar dahil.
+	const size_t nblocks = nbits / kBlockBits + 1;
+	l0_.assign((nbits >> kL0Shift) + 1, 0);
+	blocks_.assign(nblocks, 0);
+
+	uint64_t total = 0;
+	uint64_t next_sample = 0;
+	for (size_t block = 0; block < nblocks; block++) {
+		const size_t region = (block * kBlockBits) >> kL0Shift;
+		if (((block * kBlockBits) & CreateMask<uint64_t>(kL0Shift, 0)) == 0) l0_[region] = total;
+
+		uint64_t entry = static_cast<uint64_t>(total - l0_[region]);   // L1 (< 2^32).
+		for (size_t sub = 0; sub < kSubBlocksPerBlock; sub++) {
+			uint64_t sub_count = 0;
+			for (size_t i = 0; i < kWordsPerSubBlock; i++) {
+				const size_t w = block * kWordsPerBlock + sub * kWordsPerSubBlock + i;
+				if (w >= nwords) break;
+				uint64_t word = words_[w];
+				const int tail = static_cast<int>(nbits % 64);
+				if (w == nwords - 1 && tail != 0) word &= CreateMask<uint64_t>(tail, 0);
+				const int c = count_set_bits(word);
+				// Select rnei: Bu kelime next_sample. '1' biti ieriyorsa blou kaydet.
+				while (next_sample < total + sub_count + static_cast<uint64_t>(c)) {
+					samples_.push_back(static_cast<uint32_t>(block));
+					next_sample += kSelectSample;
+				}
+				sub_count += static_cast<uint64_t>(c);
+			}
+			if (sub + 1 < kSubBlocksPerBlock) entry = set_bit_field(entry, 32 + 10 * static_cast<int>(sub), 10, sub_count);
+			total += sub_count;
+		}
+		blocks_[block] = entry;
+	}
+	ones_ = total;
+}
+
+
+// =========================================================================
+// III. SELECT
+// =========================================================================
+
+size_t RankSelectIndex::select1(uint64_t k) const {
+	if (k >= ones_) return npos;
+
+	// 1. ki rnek arasnda, rank' k'y amayan son blou ikili arama ile bul.
+	const size_t s = static_cast<size_t>(k / kSelectSample);
+	size_t lo = samples_[s];
+	size_t hi = (s + 1 < samples_.size()) ? samples_[s + 1] : blocks_.size() - 1;
+	while (lo < hi) {
+		const size_t mid = lo + (hi - lo + 1) / 2;
+		if (block_rank(mid) <= k) lo = mid; else hi = mid - 1;
+	}
+	uint64_t rest = k - block_rank(lo);
+
+	// 2. Alt blok: L2 saylar ile en fazla  karlatrma.
+	const uint64_t entry = blocks_[lo];
+	size_t sub = 0;
+	for (; sub + 1 < kSubBlocksPerBlock; sub++) {
+		const uint64_t c = get_bit_field(entry, 32 + 10 * static_cast<int>(sub), 10);
+		if (rest < c) break;
+		rest -= c;
+	}
+
+	// 3. Alt blok iindeki kelimeler, ardndan kelime ii select.
+	size_t w = lo * kWordsPerBlock + sub * kWordsPerSubBlock;
+	for (;; w++) {
+		const uint64_t c = static_cast<uint64_t>(count_set_bits(words_[w]));
+		if (rest < c) break;
+		rest -= c;
+	}
+	return w * 64 + static_cast<size_t>(select_dispatch().select64(words_[w], static_cast<int>(rest)));
+}
+
+const char* RankSelectIndex::select_kernel_name() {
+	return select_dispatch().name;
+}
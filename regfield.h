@@ -0,0 +1,226 @@
+/**
+ * @file regfield.h
+ * @brief Derleme Zaman Tipli Register / Bit Alan Tanmlayclar (Register Descriptors).
+ *
+ * get_bit_field(reg, 4, 5) gibi "sihirli say" (magic number) ieren arlarn yerine,
+ * register yerleimi (layout) bir kez isimli alanlarla tanmlanr. Alan ofsetleri,
+ * genilikleri ve maskeleri derleme zamannda CreateMask<T> ile hesaplanr; register
+ * dna taan veya birbiriyle akan alanlar derleme hatas verir.
+ * Birden fazla alan tek bir maskeli oku-deitir-yaz (read-modify-write) ile yazlabilir.
+ *
+ * rnek:
+ * @code
+ *   using CtrlEnable = RegField<uint32_t, 0, 1>;
+ *   using CtrlMode   = RegField<uint32_t, 4, 3>;
+ *   using CtrlDiv    = RegField<uint32_t, 8, 8>;
+ *   using CtrlReg    = RegLayout<uint32_t, CtrlEnable, CtrlMode, CtrlDiv>;
+ *
+ *   reg = CtrlReg::write(reg, CtrlEnable::value(1), CtrlMode::value(5), CtrlDiv::value(div));
+ *   uint32_t mode = CtrlMode::get(reg);
+ * @endcode
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef REGFIELD_H
+#define REGFIELD_H
+
+#include <tuple>
+#include "bitops.h" // CreateMask<T>, count_set_bits ve register tipi kst iin
+
+// =========================================================================
+// I. ALAN TANIMLAYICISI (FIELD DESCRIPTOR)
+// =========================================================================
+
+template<typename Field>
+struct FieldValue;
+
+/**
+ * @brief Register iindeki isimli bir bit alannn derleme zaman tanm.
+ *
+ * Tm yeler statiktir; tip sadece bir tanmlaycdr, alma zamannda yer kaplamaz.
+ *
+ * @tparam Reg Register tipi (uint8_t, uint16_t, uint32_t, uint64_t).
+ * @tparam Start Alann balang indeksi (LSB'den, 0-tabanl).
+ * @tparam Length Alann bit uzunluu.
+ */
+template<typename Reg, int Start, int Length>
+struct RegField {
+    static_assert(bitops_detail::is_register_type<Reg>::value,
+                  "RegField: Register tipi isaretsiz tam sayi olmalidir.");
+    static_assert(Start >= 0 && Length > 0, "RegField: Gecersiz baslangic veya uzunluk.");
+    static_assert(Start + Length <= std::numeric_limits<Reg>::digits,
+                  "RegField: Alan register genisligini asiyor.");
+
+    using reg_type = Reg;
+    static constexpr int start = Start;
+    static constexpr int length = Length;
+    static constexpr Reg mask = CreateMask<Reg>(Length, Start);        ///< Alann yerindeki '1' maskesi.
+    static constexpr Reg max_value = CreateMask<Reg>(Length, 0);       ///< Alana san en byk deer.
+
+    /// Alan okur (saa hizalanm). Maske sabit olduu iin AND + SHR komutlarna iner.
+    static constexpr Reg get(Reg reg) {
+        return static_cast<Reg>((reg & mask) >> Start);
+    }
+
+    /// Alan tek bana yazar; dier bitler korunur. Taan st bitler maskelenir.
+    static constexpr Reg set(Reg reg, Reg new_value) {
+        return static_cast<Reg>((reg & static_cast<Reg>(~mask)) | ((new_value << Start) & mask));
+    }
+
+    /// oklu yazma (write/modify) iin konumlandrlm bir alan deeri retir.
+    static constexpr FieldValue<RegField> value(Reg v) {
+        return FieldValue<RegField>{ static_cast<Reg>((v << Start) & mask) };
+    }
+
+    /// Derleme zaman sabiti ile alan deeri: Deer alana smyorsa derleme hatas verir.
+    template<Reg V>
+    static constexpr FieldValue<RegField> value() {
+        static_assert(V <= max_value, "RegField: Sabit deger alana sigmiyor.");
+        return FieldValue<RegField>{ static_cast<Reg>(V << Start) };
+    }
+};
+
+/**
+ * @brief Bir alana yazlacak, nceden yerine kaydrlm (positioned) deer.
+ *
+ * @tparam Field Deerin ait olduu RegField tipi. Maske bu tipten derleme zamannda okunur.
+ */
+template<typename Field>
+struct FieldValue {
+    using field_type = Field;
+    typename Field::reg_type bits;   ///< Alann konumuna kaydrlm ve maskelenmi deer.
+};
+
+
+// =========================================================================
+// II. OKLU ALAN LEMLER (MULTI-FIELD READ-MODIFY-WRITE)
+// =========================================================================
+
+namespace regfield_detail {
+
+template<typename Reg, typename... Fields>
+constexpr Reg combined_mask() {
+    return static_cast<Reg>((static_cast<Reg>(0) | ... | Fields::mask));
+}
+
+// Alanlar akmyorsa birleik maskenin popcount'u, tek tek popcount'larn toplamna eittir.
+template<typename Reg, typename... Fields>
+constexpr bool fields_disjoint() {
+    return count_set_bits(combined_mask<Reg, Fields...>()) == (0 + ... + count_set_bits(Fields::mask));
+}
+
+template<typename T, typename... Ts>
+struct is_one_of : std::integral_constant<bool, (std::is_same<T, Ts>::value || ...)> {};
+
+} // namespace regfield_detail
+
+/**
+ * @brief Birden fazla alan tek bir maskeli oku-deitir-yaz ilemiyle yazar.
+ *
+ * Birleik maske derleme zamannda hesaplanr; alma zamannda yalnzca bir AND-NOT,
+ * deer says kadar OR ve (deerler sabitse hi) komut retilir.
+ *
+ * @param reg Deitirilecek register deeri.
+ * @param values Field::value(x) ile retilmi alan deerleri.
+ * @return Yazlan alanlar gncellenmi, dier bitleri korunmu register deeri.
+ */
+template<typename Reg, typename... Fields>
+constexpr Reg write_fields(Reg reg, FieldValue<Fields>... values) {
+    static_assert(sizeof...(Fields) > 0, "write_fields: En az bir alan gereklidir.");
+    static_assert((std::is_same<typename Fields::reg_type, Reg>::value && ...),
+                  "write_fields: Alan tipleri register tipiyle ayni olmalidir.");
+    static_assert(regfield_detail::fields_disjoint<Reg, Fields...>(),
+                  "write_fields: Ayni anda yazilan alanlar cakisiyor.");
+    constexpr Reg mask = regfield_detail::combined_mask<Reg, Fields...>();
+    return static_cast<Reg>((reg & static_cast<Reg>(~mask)) | (static_cast<Reg>(0) | ... | values.bits));
+}
+
+/**
+ * @brief Donanm register'n (volatile) tek okuma ve tek yazma ile gnceller.
+ *
+ * Alan bana ayr RMW yapmak yerine tm alanlar tek eriimde yazlr; bu hem komut
+ * saysn azaltr hem de ara (yarm gncellenmi) register durumlarn nler.
+ * NOT: Kesme (interrupt) veya oklu ekirdek eriimine kar atomik DELDR.
+ *
+ * @param hw_reg Gncellenecek donanm register'.
+ * @param values Field::value(x) ile retilmi alan deerleri.
+ */
+template<typename Reg, typename... Fields>
+inline void modify_fields(volatile Reg& hw_reg, FieldValue<Fields>... values) {
+    hw_reg = write_fields(static_cast<Reg>(hw_reg), values...);
+}
+
+/**
+ * @brief Birden fazla alan tek register okumasndan karr.
+ *
+ * @tparam Fields Okunacak RegField tipleri.
+ * @param reg Okunacak register deeri.
+ * @return Alan deerlerini (saa hizal) tanm srasyla ieren std::tuple.
+ *         C++17 yapsal balama (structured binding) ile alabilir.
+ */
+template<typename... Fields, typename Reg>
+constexpr std::tuple<typename Fields::reg_type...> read_fields(Reg reg) {
+    static_assert((std::is_same<typename Fields::reg_type, Reg>::value && ...),
+                  "read_fields: Alan tipleri register tipiyle ayni olmalidir.");
+    return std::tuple<typename Fields::reg_type...>(Fields::get(reg)...);
+}
+
+
+// =========================================================================
+// III. REGISTER YERLEM (REGISTER LAYOUT)
+// =========================================================================
+
+/**
+ * @brief Bir register'n tm isimli alanlarn gruplayan derleme zaman yerleimi.
+ *
+ * Alanlarn ayn register tipinde olmas ve birbirleriyle akmamas derleme zamannda
+ * dorulanr. write/modify yalnzca bu yerleime ait alanlar kabul eder; baka bir
+ * register'n alan yanllkla yazlamaz.
+ *
+ * @tparam Reg Register tipi.
+ * @tparam Fields Register'a ait RegField tipleri.
+ */
+template<typename Reg, typename... Fields>
+struct RegLayout {
+    static_assert(sizeof...(Fields) > 0, "RegLayout: En az bir alan gereklidir.");
+    static_assert((std::is_same<typename Fields::reg_type, Reg>::value && ...),
+                  "RegLayout: Alan tipleri register tipiyle ayni olmalidir.");
+    static_assert(regfield_detail::fields_disjoint<Reg, Fields...>(),
+                  "RegLayout: Alanlar birbiriyle cakisiyor.");
+
+    using reg_type = Reg;
+    static constexpr Reg used_mask = regfield_detail::combined_mask<Reg, Fields...>();  ///< Tanml bitler.
+    static constexpr Reg reserved_mask = static_cast<Reg>(~used_mask);                 ///< Tanmsz (rezerve) bitler.
+
+    /// Alan bu yerleime ait mi? (Derleme zaman)
+    template<typename F>
+    static constexpr bool contains() {
+        return regfield_detail::is_one_of<F, Fields...>::value;
+    }
+
+    /// Yerleime ait alanlar tek maskeli RMW ile yazar.
+    template<typename... Written>
+    static constexpr Reg write(Reg reg, FieldValue<Written>... values) {
+        static_assert((contains<Written>() && ...), "RegLayout::write: Alan bu register'a ait degil.");
+        return write_fields(reg, values...);
+    }
+
+    /// Donanm register'n tek okuma / tek yazma ile gnceller.
+    template<typename... Written>
+    static void modify(volatile Reg& hw_reg, FieldValue<Written>... values) {
+        static_assert((contains<Written>() && ...), "RegLayout::modify: Alan bu register'a ait degil.");
+        modify_fields(hw_reg, values...);
+    }
+
+    /// Sfrdan (rezerve bitler 0) yeni bir register deeri oluturur.
+    template<typename... Written>
+    static constexpr Reg make(FieldValue<Written>... values) {
+        return write(static_cast<Reg>(0), values...);
+    }
+};
+
+#endif // REGFIELD_H
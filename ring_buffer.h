@@ -0,0 +1,160 @@
+/**
+ * @file ring_buffer.h
+ * @brief Kilitsiz (Lock-Free) Tek retici / Tek Tketici (SPSC) Dairesel Tampon.
+ *
+ * Buffer Library'nin ilk bileenidir. Kapasite 2'nin kuvveti olmak zorundadr
+ * (is_power_of_two ile dorulanr); bylece indeks sarmas (wraparound) pahal
+ * modlo (%) yerine CreateMask ile retilen tek bir AND maskesiyle yaplr.
+ * retici (head) ve tketici (tail) sayalar ayr nbellek satrlarnda (cache line)
+ * tutulur; iki ekirdek birbirinin satrn geersiz klmaz (false sharing yok).
+ *
+ * Sayalar serbeste artan (monotonic) iaretsiz tam saylardr; doluluk = head - tail
+ * fark, iaretsiz tama (wraparound) aritmetii sayesinde her zaman dorudur.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <type_traits>
+#include "bitops.h" // is_power_of_two, CreateMask, find_first_set_bit
+
+// nbellek satr boyutu. std::hardware_destructive_interference_size her derleyicide
+// bulunmad (ve ABI uyars rettii) iin yaygn x86/ARM deeri sabit olarak kullanlr.
+#ifndef BITBUF_CACHE_LINE_SIZE
+#define BITBUF_CACHE_LINE_SIZE 64
+#endif
+
+/**
+ * @brief Kilitsiz SPSC dairesel tampon (ring buffer).
+ *
+ * Tam olarak bir retici i parac (thread) push* ve bir tketici i parac pop*
+ * arabilir. Tm ilemler bloklamayan (non-blocking) ilemlerdir.
+ *
+ * @tparam T Eleman tipi. Toplu (batch) kopyalama iin trivially copyable olmaldr.
+ * @tparam Capacity Tampon kapasitesi (eleman). 2'nin kuvveti olmaldr.
+ */
+template<typename T, size_t Capacity>
+class SpscRingBuffer {
+    static_assert(is_power_of_two(static_cast<uint64_t>(Capacity)),
+                  "SpscRingBuffer: Kapasite 2'nin kuvveti olmalidir.");
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SpscRingBuffer: Eleman tipi trivially copyable olmalidir.");
+
+public:
+    /// Kapasite - 1 maskesi: idx & kMask, idx % Capacity ile ayndr ancak tek AND komutudur.
+    static constexpr size_t kMask =
+        static_cast<size_t>(CreateMask<uint64_t>(find_first_set_bit(static_cast<uint64_t>(Capacity)), 0));
+
+    SpscRingBuffer() : head_(0), cached_tail_(0), tail_(0), cached_head_(0) {}
+
+    SpscRingBuffer(const SpscRingBuffer&) = delete;
+    SpscRingBuffer& operator=(const SpscRingBuffer&) = delete;
+
+    /**
+     * @brief Tek bir eleman ekler (sadece retici).
+     * @param item Eklenecek eleman.
+     * @return Tampon doluysa false, aksi halde true dndrr.
+     */
+    bool push(const T& item) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head - cached_tail_ == Capacity) {
+            // nbellekteki tail eski olabilir; yalnzca dolu grndnde paylalan sayac oku.
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            if (head - cached_tail_ == Capacity) return false;
+        }
+        buffer_[head & kMask] = item;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Tek bir eleman karr (sadece tketici).
+     * @param item karlan elemann yazlaca hedef.
+     * @return Tampon bosa false, aksi halde true dndrr.
+     */
+    bool pop(T& item) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == cached_head_) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            if (tail == cached_head_) return false;
+        }
+        item = buffer_[tail & kMask];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief En fazla n eleman tek seferde ekler (sadece retici).
+     *
+     * Saya yalnzca bir kez yaynlanr (tek release store); sarma noktasnda kopya
+     * en fazla iki bitiik paraya blnr.
+     *
+     * @param items Eklenecek elemanlar.
+     * @param n Eklenmek istenen eleman says.
+     * @return Gerekte eklenen eleman says (tampon dolarsa n'den az olabilir).
+     */
+    size_t push_batch(const T* items, size_t n) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        size_t free_slots = Capacity - (head - cached_tail_);
+        if (free_slots < n) {
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            free_slots = Capacity - (head - cached_tail_);
+        }
+        const size_t count = (n < free_slots) ? n : free_slots;
+        const size_t start = head & kMask;
+        const size_t first = (count < Capacity - start) ? count : Capacity - start;
+        for (size_t i = 0; i < first; i++) buffer_[start + i] = items[i];
+        for (size_t i = first; i < count; i++) buffer_[i - first] = items[i];
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * @brief En fazla n eleman tek seferde karr (sadece tketici).
+     * @param items karlan elemanlarn yazlaca hedef dizi.
+     * @param n karlmak istenen en fazla eleman says.
+     * @return Gerekte karlan eleman says.
+     */
+    size_t pop_batch(T* items, size_t n) {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        size_t available = cached_head_ - tail;
+        if (available < n) {
+            cached_head_ = head_.load(std::memory_order_acquire);
+            available = cached_head_ - tail;
+        }
+        const size_t count = (n < available) ? n : available;
+        const size_t start = tail & kMask;
+        const size_t first = (count < Capacity - start) ? count : Capacity - start;
+        for (size_t i = 0; i < first; i++) items[i] = buffer_[start + i];
+        for (size_t i = first; i < count; i++) items[i] = buffer_[i - first];
+        tail_.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+    /// Anlk doluluk (yaklak; ezamanl kullanmda yalnzca bir ipucudur).
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+
+    static constexpr size_t capacity() { return Capacity; }
+
+private:
+    // retici taraf: head_ yazlr, cached_tail_ tketicinin sayacnn yerel kopyasdr.
+    alignas(BITBUF_CACHE_LINE_SIZE) std::atomic<size_t> head_;
+    size_t cached_tail_;
+    // Tketici taraf: tail_ yazlr, cached_head_ reticinin sayacnn yerel kopyasdr.
+    alignas(BITBUF_CACHE_LINE_SIZE) std::atomic<size_t> tail_;
+    size_t cached_head_;
+    alignas(BITBUF_CACHE_LINE_SIZE) T buffer_[Capacity];
+};
+
+#endif // RING_BUFFER_H
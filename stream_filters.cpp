@@ -0,0 +1,272 @@
+/**
+ * @file stream_filters.cpp
+ * @brief CIC Desimatr, Kayan Ortalama ve Kayan Medyan Implementasyonu.
+ *
+ * ablonlar yalnzca int16_t (Q15) ve int32_t (Q31) iin aka rneklenir.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "stream_filters.h"
+#include "bitops.h"     // CreateMask, find_first_set_bit, is_power_of_two
+
+namespace {
+
+// 'length' deerinden kk olmayan en kk 2'nin kuvveti.
+size_t ring_capacity(size_t length) {
+	size_t capacity = 1;
+	while (capacity < length) capacity <<= 1;
+	return capacity;
+}
+
+size_t ring_mask(size_t capacity) {
+	return static_cast<size_t>(CreateMask<uint64_t>(find_first_set_bit(static_cast<uint64_t>(capacity)), 0));
+}
+
+// ceil(stages * log2(rm)): rm^stages kazancn rten en kk bit says (2^bits >= kazan).
+int cic_gain_bits(size_t stages, size_t rm) {
+	uint64_t gain = 1;
+	for (size_t s = 0; s < stages; s++) {
+		if (gain > UINT64_MAX / rm) return 64;     // n koul ihlali: Kazan 64 biti ayor.
+		gain *= rm;
+	}
+	int bits = 0;
+	while (bits < 64 && (static_cast<uint64_t>(1) << bits) < gain) bits++;
+	return bits;
+}
+
+// Integratr kaskad: Kat says derleme zamannda bilindiinde yazmalar dng boyunca
+// CPU yazmalarnda kalr (bellek zerinden store-forwarding gecikmesi olmaz).
+template<size_t Stages, typename Sample>
+void integrate_fixed(uint64_t* integ, const Sample* in, size_t n) {
+	uint64_t r[Stages];
+	for (size_t s = 0; s < Stages; s++) r[s] = integ[s];
+	for (size_t k = 0; k < n; k++) {
+		uint64_t acc = static_cast<uint64_t>(static_cast<int64_t>(in[k]));
+		for (size_t s = 0; s < Stages; s++) {
+			r[s] += acc;
+			acc = r[s];
+		}
+	}
+	for (size_t s = 0; s < Stages; s++) integ[s] = r[s];
+}
+
+template<typename Sample>
+void integrate(uint64_t* integ, size_t stages, const Sample* in, size_t n) {
+	switch (stages) {
+	case 1: integrate_fixed<1>(integ, in, n); return;
+	case 2: integrate_fixed<2>(integ, in, n); return;
+	case 3: integrate_fixed<3>(integ, in, n); return;
+	case 4: integrate_fixed<4>(integ, in, n); return;
+	case 5: integrate_fixed<5>(integ, in, n); return;
+	case 6: integrate_fixed<6>(integ, in, n); return;
+	default: break;
+	}
+	for (size_t k = 0; k < n; k++) {
+		uint64_t acc = static_cast<uint64_t>(static_cast<int64_t>(in[k]));
+		for (size_t s = 0; s < stages; s++) {
+			integ[s] += acc;
+			acc = integ[s];
+		}
+	}
+}
+
+} // namespace
+
+
+// =========================================================================
+// I. CIC DESMATR
+// =========================================================================
+
+template<typename Sample>
+CicDecimator<Sample>::CicDecimator(size_t stages, size_t factor, size_t diff_delay)
+	: stages_(stages), factor_(factor), diff_delay_(diff_delay), phase_(0),
+	  gain_bits_(cic_gain_bits(stages, factor * diff_delay)), comb_pos_(0),
+	  integrators_(stages, 0), combs_(stages * diff_delay, 0) {}
+
+template<typename Sample>
+void CicDecimator<Sample>::reset() {
+	for (uint64_t& v : integrators_) v = 0;
+	for (uint64_t& v : combs_) v = 0;
+	phase_ = 0;
+	comb_pos_ = 0;
+}
+
+template<typename Sample>
+size_t CicDecimator<Sample>::process(const Sample* in, size_t n, Sample* out) {
+	const size_t stages = stages_;
+	uint64_t* integ = integrators_.data();
+	size_t produced = 0;
+	size_t i = 0;
+	while (i < n) {
+		// Bir sonraki ka kadar yalnzca integratrler alr (girdi hznda, arpmsz).
+		const size_t run = (n - i < phase_ + 1) ? n - i : phase_ + 1;
+		integrate(integ, stages, in + i, run);
+		i += run;
+		if (run <= phase_) {
+			phase_ -= run;      // Blok, k anndan nce bitti.
+			break;
+		}
+
+		// Tarak katlar k hznda: y = x - x[-M] (mod 2^64).
+		uint64_t acc = integ[stages - 1];
+		for (size_t s = 0; s < stages; s++) {
+			uint64_t& delayed = combs_[s * diff_delay_ + comb_pos_];
+			const uint64_t diff = acc - delayed;
+			delayed = acc;
+			acc = diff;
+		}
+		comb_pos_ = (comb_pos_ + 1 == diff_delay_) ? 0 : comb_pos_ + 1;
+		out[produced++] = (gain_bits_ == 0) ? saturate<Sample>(static_cast<int64_t>(acc))
+		                                    : round_shift_saturate<Sample>(static_cast<int64_t>(acc), gain_bits_);
+		phase_ = factor_ - 1;
+	}
+	return produced;
+}
+
+
+// =========================================================================
+// II. KAYAN ORTALAMA
+// =========================================================================
+
+template<typename Sample>
+MovingAverage<Sample>::MovingAverage(size_t window)
+	: window_(window), mask_(ring_mask(ring_capacity(window))), pos_(0),
+	  shift_(is_power_of_two(static_cast<uint64_t>(window)) ? find_first_set_bit(static_cast<uint64_t>(window)) : -1),
+	  sum_(0), buffer_(ring_capacity(window), 0) {}
+
+template<typename Sample>
+void MovingAverage<Sample>::reset() {
+	for (Sample& s : buffer_) s = 0;
+	pos_ = 0;
+	sum_ = 0;
+}
+
+template<typename Sample>
+Sample MovingAverage<Sample>::average() const {
+	// round half up: floor((sum + w/2) / w). Aritmetik kaydrma zaten taban (floor) alr.
+	if (shift_ >= 0) return static_cast<Sample>((sum_ + static_cast<int64_t>(window_ >> 1)) >> shift_);
+	const int64_t w = static_cast<int64_t>(window_);
+	const int64_t q = sum_ + w / 2;
+	return static_cast<Sample>(q >= 0 ? q / w : -((-q + w - 1) / w));
+}
+
+template<typename Sample>
+void MovingAverage<Sample>::process(const Sample* in, Sample* out, size_t n) {
+	for (size_t i = 0; i < n; i++) out[i] = process_sample(in[i]);
+}
+
+
+// =========================================================================
+// III. KAYAN MEDYAN (FT YIIN)
+// =========================================================================
+
+template<typename Sample>
+SlidingMedian<Sample>::SlidingMedian(size_t window)
+	: window_(window), idx_(0), count_(0), center_(static_cast<long>(window / 2)),
+	  data_(window, Sample()), pos_(window), heap_(window) {
+	reset();
+}
+
+template<typename Sample>
+void SlidingMedian<Sample>::reset() {
+	// Yuva k srasyla 0, -1, +1, -2, +2, ... konumlarna atanr: Isnmada her yeni rnek
+	// iki yndan kk olann sonuna der ve ynlar dengeli byr.
+	for (size_t k = 0; k < window_; k++) {
+		const long p = static_cast<long>((k + 1) / 2) * ((k & 1) ? -1 : 1);
+		pos_[k] = p;
+		heap_at(p) = k;
+		data_[k] = Sample();
+	}
+	idx_ = 0;
+	count_ = 0;
+}
+
+template<typename Sample>
+void SlidingMedian<Sample>::exchange(long i, long j) {
+	const size_t t = heap_at(i);
+	heap_at(i) = heap_at(j);
+	heap_at(j) = t;
+	pos_[heap_at(i)] = i;
+	pos_[heap_at(j)] = j;
+}
+
+template<typename Sample>
+bool SlidingMedian<Sample>::compare_exchange(long i, long j) {
+	if (!less(i, j)) return false;
+	exchange(i, j);
+	return true;
+}
+
+// st yar (min-heap, pozitif konumlar): i bir ocuk konumudur; ebeveyniyle sras bozuksa
+// takas edip aa iner. Medyan (0), 1'in ebeveynidir; 1'in kardei yoktur (2, 1'in ocuudur).
+template<typename Sample>
+void SlidingMedian<Sample>::min_sort_down(long i) {
+	const long n = min_count();
+	for (; i <= n; i *= 2) {
+		if (i > 1 && i < n && less(i + 1, i)) i++;
+		if (!compare_exchange(i, i / 2)) break;
+	}
+}
+
+// Alt yar (max-heap, negatif konumlar; -1'in ocuklar -2 ve -3, ebeveyni medyan).
+template<typename Sample>
+void SlidingMedian<Sample>::max_sort_down(long i) {
+	const long n = max_count();
+	for (; i >= -n; i *= 2) {
+		if (i < -1 && i > -n && less(i, i - 1)) i--;
+		if (!compare_exchange(i / 2, i)) break;
+	}
+}
+
+// i'yi st yarda yukar tar; medyana (0) ularsa true.
+template<typename Sample>
+bool SlidingMedian<Sample>::min_sort_up(long i) {
+	while (i > 0 && compare_exchange(i, i / 2)) i /= 2;
+	return i == 0;
+}
+
+template<typename Sample>
+bool SlidingMedian<Sample>::max_sort_up(long i) {
+	while (i < 0 && compare_exchange(i / 2, i)) i /= 2;
+	return i == 0;
+}
+
+template<typename Sample>
+Sample SlidingMedian<Sample>::process_sample(Sample x) {
+	const bool is_new = count_ < window_;
+	const long p = pos_[idx_];
+	const Sample old = data_[idx_];
+	data_[idx_] = x;
+	idx_ = (idx_ + 1 == window_) ? 0 : idx_ + 1;
+	count_ += is_new;
+
+	if (p > 0) {
+		// Yeni rnek st yarda: Bydyse aa, kldyse yukar (gerekirse medyan geerek).
+		if (!is_new && old < x) min_sort_down(p * 2);
+		else if (min_sort_up(p)) max_sort_down(-1);
+	} else if (p < 0) {
+		if (!is_new && x < old) max_sort_down(p * 2);
+		else if (max_sort_up(p)) min_sort_down(1);
+	} else {
+		if (max_count() > 0) max_sort_down(-1);
+		if (min_count() > 0) min_sort_down(1);
+	}
+	return data_[heap_at(0)];
+}
+
+template<typename Sample>
+void SlidingMedian<Sample>::process(const Sample* in, Sample* out, size_t n) {
+	for (size_t i = 0; i < n; i++) out[i] = process_sample(in[i]);
+}
+
+// Ak rnekleme (explicit instantiation): Q15 ve Q31.
+template class CicDecimator<int16_t>;
+template class CicDecimator<int32_t>;
+template class MovingAverage<int16_t>;
+template class MovingAverage<int32_t>;
+template class SlidingMedian<int16_t>;
+template class SlidingMedian<int32_t>;
@@ -0,0 +1,181 @@
+/**
+ * @file stream_filters.h
+ * @brief arpmsz Ak Filtreleri: CIC Desimatr, Kayan Ortalama ve Kayan Medyan.
+ *
+ * Yksek rnekleme hzl n u (front-end) iin tasarlanmtr:
+ * - CicDecimator: Yalnzca toplama/karma kullanan N katl integratr-tarak kaskad.
+ *   Yazmalar iaretsiz sarma (wraparound) aritmetiiyle alr (bitops register
+ *   matematiiyle ayn ilke); ara tamalar son kta kendiliinden telafi edilir.
+ * - MovingAverage: rnek bana O(1) kayan ortalama (tam say toplam, srklenme yok).
+ * - SlidingMedian: rnek bana O(log w) kayan medyan (pencere ii ift yn).
+ *
+ * Hepsi blok API'sine sahiptir: Tek ar binlerce rnei sanal ar (virtual dispatch)
+ * olmadan iler. Kayan ortalamann penceresi 2'nin kuvveti kapasiteli dairesel tampondur
+ * (indeks sarmas AND maskesiyle).
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef STREAM_FILTERS_H
+#define STREAM_FILTERS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "fixed_point.h"
+
+// =========================================================================
+// I. CIC DESMATR (CASCADED INTEGRATOR-COMB)
+// =========================================================================
+
+/**
+ * @brief N katl CIC desimatr: H(z) = ((1 - z^(-R*M)) / (1 - z^(-1)))^N, ardndan R kat seyreltme.
+ *
+ * MHENDSLK NOTU (Sarma aritmetii): Kazan G = (R*M)^N'dir ve integratrler DC girdide
+ * snrsz byr. Yazmalar uint64_t modulo 2^64 altndan bu tamalar zararszdr:
+ * Tarak (comb) farklar ayn modler halkada alnr ve gerek k |y| < 2^63 olduu
+ * srece sonu kesindir. Koul: rnek bit genilii + gain_bits() <= 64.
+ * k gain_bits() kadar yuvarlanarak saa kaydrlr ve rnek tipine doyurulur; R*M
+ * 2'nin kuvveti ise birim kazantr.
+ *
+ * @tparam Sample int16_t (Q15) veya int32_t (Q31).
+ */
+template<typename Sample>
+class CicDecimator {
+public:
+    /**
+     * @param stages Kat says N (1..8 tipik).
+     * @param factor Seyreltme oran R (en az 1).
+     * @param diff_delay Tarak gecikmesi M (1 veya 2 tipik).
+     */
+    CicDecimator(size_t stages, size_t factor, size_t diff_delay = 1);
+
+    /**
+     * @brief Bir girdi blounu iler; faz bloklar arasnda korunur.
+     * @param in Girdi rnekleri.
+     * @param n Girdi says.
+     * @param out kt: en fazla n / R + 1 rnek.
+     * @return retilen kt says.
+     */
+    size_t process(const Sample* in, size_t n, Sample* out);
+
+    void reset();
+
+    /// Normalizasyon kaydrmas: ceil(N * log2(R * M)).
+    int gain_bits() const { return gain_bits_; }
+    size_t factor() const { return factor_; }
+
+private:
+    size_t stages_;
+    size_t factor_;
+    size_t diff_delay_;
+    size_t phase_;                      ///< Bir sonraki ka kalan girdi says.
+    int gain_bits_;
+    size_t comb_pos_;                   ///< Tarak gecikme hatlarnda yazma konumu (0..M-1).
+    std::vector<uint64_t> integrators_; ///< N integratr yazmac.
+    std::vector<uint64_t> combs_;       ///< [kat][M]: Her tarak katnn son M girdisi.
+};
+
+
+// =========================================================================
+// II. KAYAN ORTALAMA VE KAYAN MEDYAN
+// =========================================================================
+
+/**
+ * @brief rnek bana O(1) kayan ortalama: y[n] = round(sum(x[n-w+1..n]) / w).
+ *
+ * Toplam int64_t'de tam olarak tutulur (kayan noktadaki birikimli srklenme yoktur).
+ * w 2'nin kuvveti ise blme tek bir aritmetik kaydrmadr. Isnma sresince (ilk w-1
+ * rnek) pencerenin eksik ksm sfr kabul edilir.
+ *
+ * @tparam Sample int16_t veya int32_t.
+ */
+template<typename Sample>
+class MovingAverage {
+public:
+    /// @param window Pencere uzunluu w (en az 1).
+    explicit MovingAverage(size_t window);
+
+    /// Tek bir rnei iler.
+    Sample process_sample(Sample x) {
+        sum_ += static_cast<int64_t>(x) - buffer_[(pos_ - window_) & mask_];
+        buffer_[pos_ & mask_] = x;
+        pos_++;
+        return average();
+    }
+
+    /// Bir girdi blounu iler. 'in' ve 'out' ayn tampon olabilir.
+    void process(const Sample* in, Sample* out, size_t n);
+
+    void reset();
+
+    size_t window() const { return window_; }
+
+private:
+    Sample average() const;
+
+    size_t window_;
+    size_t mask_;
+    size_t pos_;            ///< Serbeste artan yazma sayac (indeks = pos_ & mask_).
+    int shift_;             ///< w 2'nin kuvveti ise log2(w), deilse -1.
+    int64_t sum_;
+    std::vector<Sample> buffer_;
+};
+
+/**
+ * @brief rnek bana O(log w) kayan medyan.
+ *
+ * Sral penceredeki floor(k/2). eleman (0 tabanl; k = penceredeki rnek says) dner:
+ * Tek w iin tam medyan, ift w iin st medyan. Tam say girdide ortalama alnmad
+ * iin k daima penceredeki gerek bir rnektir.
+ *
+ * MHENDSLK NOTU (ift yn): Pencere tek bir dizide iki yn olarak tutulur: Merkezin
+ * altnda alt yar iin max-heap, stnde st yar iin min-heap, merkezde medyan. Her
+ * rnek dairesel tamponda en eski rnein yerine yazlr; yndaki konumu (pos_) bilindii
+ * iin silme + ekleme tek bir yerinde gncellemeye iner ve yalnzca o dm yukar/aa
+ * elenir: O(log w), bellek ayrma yok.
+ *
+ * @tparam Sample Sralanabilir (operator<) herhangi bir tip; int16_t ve int32_t rneklenir.
+ */
+template<typename Sample>
+class SlidingMedian {
+public:
+    /// @param window Pencere uzunluu w (en az 1).
+    explicit SlidingMedian(size_t window);
+
+    /// Tek bir rnei iler ve gncel medyan dndrr.
+    Sample process_sample(Sample x);
+
+    /// Bir girdi blounu iler. 'in' ve 'out' ayn tampon olabilir.
+    void process(const Sample* in, Sample* out, size_t n);
+
+    void reset();
+
+    size_t window() const { return window_; }
+
+private:
+    bool less(long i, long j) const { return data_[heap_at(i)] < data_[heap_at(j)]; }
+    size_t& heap_at(long i) { return heap_[static_cast<size_t>(center_ + i)]; }
+    size_t heap_at(long i) const { return heap_[static_cast<size_t>(center_ + i)]; }
+    void exchange(long i, long j);
+    bool compare_exchange(long i, long j);   ///< heap(i) < heap(j) ise takas eder.
+    void min_sort_down(long i);             ///< i: Dzeltilecek ilk ocuk konumu.
+    void max_sort_down(long i);
+    bool min_sort_up(long i);
+    bool max_sort_up(long i);
+    long min_count() const { return static_cast<long>((count_ - 1) / 2); }
+    long max_count() const { return static_cast<long>(count_ / 2); }
+
+    size_t window_;
+    size_t idx_;                    ///< Dairesel tamponda bir sonraki yazma konumu.
+    size_t count_;                  ///< Penceredeki rnek says (<= w).
+    long center_;                   ///< heap_ iinde medyann (greli 0) konumu.
+    std::vector<Sample> data_;      ///< Dairesel pencere.
+    std::vector<long> pos_;         ///< data_[k] esinin greli yn konumu (<0 alt, 0 medyan, >0 st).
+    std::vector<size_t> heap_;      ///< Greli konum -> data_ indeksi.
+};
+
+#endif // STREAM_FILTERS_H
@@ -0,0 +1,158 @@
+/**
+ * @file thread_pool.cpp
+ * @brief  alan Havuz: Kuyruk lemleri, Tembel kiye Blme ve Uyku/Uyanma Protokol.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#include "thread_pool.h"
+
+namespace {
+
+// Geerli i paracnn ait olduu havuz ve kuyruk indeksi (havuz dnda nullptr / 0).
+thread_local const ThreadPool* tls_pool = nullptr;
+thread_local size_t tls_queue = 0;
+
+} // namespace
+
+
+// =========================================================================
+// I. YAAM DNGS
+// =========================================================================
+
+ThreadPool::ThreadPool(unsigned threads)
+    : queue_count_(0), queued_(0), sleeping_(0), stop_(false) {
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+	if (threads == 0) threads = 1;
+	queue_count_ = threads;
+	queues_.reset(new TaskQueue[queue_count_]);
+	workers_.reserve(threads - 1);
+	for (unsigned i = 1; i < threads; i++) workers_.emplace_back(&ThreadPool::worker_loop, this, static_cast<size_t>(i));
+}
+
+ThreadPool::~ThreadPool() {
+	stop_.store(true);
+	{
+		std::lock_guard<std::mutex> guard(sleep_lock_);
+	}
+	wake_.notify_all();
+	for (std::thread& worker : workers_) worker.join();
+}
+
+ThreadPool& ThreadPool::shared() {
+	static ThreadPool pool(0);
+	return pool;
+}
+
+
+// =========================================================================
+// II. KUYRUKLAR
+// =========================================================================
+
+size_t ThreadPool::current_queue() const {
+	return (tls_pool == this) ? tls_queue : 0;
+}
+
+void ThreadPool::push(size_t queue, const Task& task) {
+	{
+		std::lock_guard<std::mutex> guard(queues_[queue].lock);
+		queues_[queue].tasks.push_back(task);
+	}
+	queued_.fetch_add(1);
+	// Uyuyan alan karmamak iin: alan sleeping_'i artrp queued_'i okur, burada
+	// queued_ artrlp sleeping_ okunur (ikisi de seq_cst); en az biri dierini grr.
+	// Kilidi ksaca almak, alann kontrol ile wait() arasnda olmadn garanti eder.
+	if (sleeping_.load() != 0) {
+		{
+			std::lock_guard<std::mutex> guard(sleep_lock_);
+		}
+		wake_.notify_one();
+	}
+}
+
+bool ThreadPool::pop(size_t queue, Task& task) {
+	std::lock_guard<std::mutex> guard(queues_[queue].lock);
+	std::deque<Task>& tasks = queues_[queue].tasks;
+	if (tasks.empty()) return false;
+	task = tasks.back();
+	tasks.pop_back();
+	queued_.fetch_sub(1);
+	return true;
+}
+
+bool ThreadPool::steal(size_t thief, Task& task) {
+	for (size_t i = 1; i < queue_count_; i++) {
+		const size_t victim = (thief + i) % queue_count_;
+		std::lock_guard<std::mutex> guard(queues_[victim].lock);
+		std::deque<Task>& tasks = queues_[victim].tasks;
+		if (tasks.empty()) continue;
+		task = tasks.front();
+		tasks.pop_front();
+		queued_.fetch_sub(1);
+		return true;
+	}
+	return false;
+}
+
+
+// =========================================================================
+// III. YRTME
+// =========================================================================
+
+void ThreadPool::execute(Task task, size_t queue) {
+	RangeJob& job = *task.job;
+	size_t lo = task.begin;
+	size_t hi = task.end;
+	// Blme noktalar job.begin'e gre grain'in katlardr; her ar tam bir blok grr.
+	while (hi - lo > job.grain) {
+		const size_t blocks = (hi - lo + job.grain - 1) / job.grain;
+		const size_t mid = lo + (blocks / 2) * job.grain;
+		push(queue, Task{ &job, mid, hi });
+		hi = mid;
+	}
+	job.invoke(job.context, lo, hi);
+	// Son azaltmadan sonra 'job' arann ynndan kalkabilir; ona bir daha dokunulmaz.
+	job.remaining.fetch_sub(hi - lo, std::memory_order_acq_rel);
+}
+
+void ThreadPool::run(RangeJob& job) {
+	if (workers_.empty() || job.end - job.begin <= job.grain) {
+		for (size_t lo = job.begin, hi; lo < job.end; lo = hi) {
+			hi = (job.end - lo > job.grain) ? lo + job.grain : job.end;
+			job.invoke(job.context, lo, hi);
+		}
+		return;
+	}
+	const size_t queue = current_queue();
+	execute(Task{ &job, job.begin, job.end }, queue);
+	// aran beklerken bo durmaz: Kendi kuyruundan alr veya bakasndan alar. Ald
+	// grev baka bir ie ait olabilir; bu yalnzca dn geciktirir.
+	Task task;
+	while (job.remaining.load(std::memory_order_acquire) != 0) {
+		if (pop(queue, task) || steal(queue, task)) {
+			execute(task, queue);
+		} else {
+			std::this_thread::yield();
+		}
+	}
+}
+
+void ThreadPool::worker_loop(size_t index) {
+	tls_pool = this;
+	tls_queue = index;
+	Task task;
+	for (;;) {
+		if (pop(index, task) || steal(index, task)) {
+			execute(task, index);
+			continue;
+		}
+		std::unique_lock<std::mutex> lock(sleep_lock_);
+		sleeping_.fetch_add(1);
+		while (!stop_.load() && queued_.load() == 0) wake_.wait(lock);
+		sleeping_.fetch_sub(1);
+		if (stop_.load() && queued_.load() == 0) return;
+	}
+}
@@ -0,0 +1,154 @@
+/**
+ * @file thread_pool.h
+ * @brief  alan (Work-Stealing)  Parac Havuzu ve Aralk zerinde parallel_for.
+ *
+ * Toplu (bulk) bit ve filtre ekirdeklerinin (popcount, bit kmesi mantk ilemleri,
+ * paketleme/ama, yklem filtresi, CRC) paralel giri noktalar bu havuzu kullanr. Her
+ * modl kendi paralel ar yklemesini (overload) ilk parametre olarak ThreadPool& alarak
+ * sunar; rn. count_set_bits(pool, data, n).
+ *
+ * Belirlenimcilik (determinism): parallel_for aral i parac saysndan ve
+ * zamanlamadan bamsz, sabit 'grain' bloklarna bler. aranlar ksmi sonular blok
+ * indeksine gre yazar ve srayla birletirir; bylece paralel ktlar seri yolla bit bit
+ * ayndr.
+ *
+ * @author Doukan Avc
+ * @date 16 Ekim 2026
+ * @version 1.0.0
+ * @copyright Telif Hakk (c) 2025 Doukan Avc. Tm Haklar Sakldr.
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "ring_buffer.h" // BITBUF_CACHE_LINE_SIZE
+
+/**
+ * @brief Paralel toplu ekirdekler iin nerilen blok boyutu (byte).
+ *
+ * Bir blok L2 nbelleine rahata sar ve grev bana sabit maliyeti (kilit, saya)
+ * nemsiz klacak kadar byktr. Daha kk girdiler tek blok olarak seri alr.
+ */
+constexpr size_t kParallelGrainBytes = static_cast<size_t>(256) << 10;
+
+/**
+ * @brief  alan i parac havuzu.
+ *
+ * MHENDSLK NOTU ( alma): Her alann kendi grev kuyruu (deque) vardr. alan
+ * kendi kuyruunun SONUNDAN alr (LIFO: en son blnen, nbellekte scak olan yar); bota
+ * kalan alan baka bir kuyruun BAINDAN alar (en eski, en byk aralk). Aralklar
+ * tembel ikiye blme (lazy binary splitting) ile datlr: Grevi alan, aral grain'e
+ * inene kadar ikiye bler ve st yarlar kendi kuyruuna iter. Bylece alma ilemleri
+ * byk paralar tar ve log(blok says) kadar seyrek kalr.
+ *
+ * Kuyruklar kilitlidir (kuyruk bana bir mutex): Grevler en az bir grain (yzlerce KiB)
+ * ilediinden kilit maliyeti grev sresinin yannda llemez; kilitsiz Chase-Lev
+ * kuyruunun bellek sralamas karmaklna demez.
+ *
+ * parallel_for'u aran i parac da alr:  bitene kadar bo durmaz, kuyruklardan
+ * grev alr. Bu yzden havuz concurrency() - 1 arka plan i parac balatr ve
+ * parallel_for grevlerin iinden de (i ie) gvenle arlabilir.
+ *
+ * Grev fonksiyonlar istisna (exception) frlatmamaldr.
+ */
+class ThreadPool {
+public:
+    /**
+     * @param threads Toplam ezamanllk (aran dahil); 0 ise donanm i parac says.
+     *                1 ise arka plan i parac yoktur, her ey aranda seri alr.
+     */
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    /// Paylalan varsaylan havuz (donanm i parac says); ilk arda oluturulur.
+    static ThreadPool& shared();
+
+    /// Toplam ezamanllk: Arka plan i paracklar + aran.
+    unsigned concurrency() const { return static_cast<unsigned>(workers_.size()) + 1; }
+
+    /**
+     * @brief [begin, end) araln 'grain' boyutlu bloklarda paralel iler.
+     *
+     * fn(lo, hi), her k iin [begin + k * grain, min(end, begin + (k + 1) * grain))
+     * blouyla tam bir kez arlr (son blok ksa olabilir). Blok snrlar yalnzca
+     * begin, end ve grain'e baldr. arlarn sras ve hangi i paracnda
+     * yryecei belirsizdir; fonksiyon, tm bloklar bitince dner.
+     *
+     * @tparam Fn void(size_t, size_t) imzal arlabilir nesne.
+     * @param grain Blok boyutu (eleman); 0 ise 1 kabul edilir.
+     */
+    template<typename Fn>
+    void parallel_for(size_t begin, size_t end, size_t grain, Fn fn) {
+        if (begin >= end) return;
+        RangeJob job(begin, end, grain == 0 ? 1 : grain, &invoke_range<Fn>, &fn);
+        run(job);
+    }
+
+    /// Aral grain'e blnce oluan blok says (ksmi sonu dizilerini boyutlamak iin).
+    static size_t block_count(size_t n, size_t grain) {
+        return (grain == 0) ? n : (n + grain - 1) / grain;
+    }
+
+private:
+    struct RangeJob {
+        RangeJob(size_t b, size_t e, size_t g, void (*f)(void*, size_t, size_t), void* c)
+            : begin(b), end(e), grain(g), invoke(f), context(c), remaining(e - b) {}
+
+        size_t begin;
+        size_t end;
+        size_t grain;
+        void (*invoke)(void*, size_t, size_t);
+        void* context;
+        std::atomic<size_t> remaining;     ///< Henz ilenmemi eleman says.
+    };
+
+    struct Task {
+        RangeJob* job;
+        size_t begin;
+        size_t end;
+    };
+
+    // Her kuyruk ayr nbellek satrnda (sahibin kilidi hrszlarnkiyle false sharing yapmaz).
+    struct alignas(BITBUF_CACHE_LINE_SIZE) TaskQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    template<typename Fn>
+    static void invoke_range(void* context, size_t lo, size_t hi) {
+        (*static_cast<Fn*>(context))(lo, hi);
+    }
+
+    void run(RangeJob& job);
+    void execute(Task task, size_t queue);
+    void push(size_t queue, const Task& task);
+    bool pop(size_t queue, Task& task);
+    bool steal(size_t thief, Task& task);
+    void worker_loop(size_t index);
+    size_t current_queue() const;
+
+    // Kuyruk 0, havuz d aranlarn (ana i parac vb.) ortak kuyruudur;
+    // kuyruk i + 1, i. arka plan i paracnndr.
+    std::unique_ptr<TaskQueue[]> queues_;
+    size_t queue_count_;
+    std::vector<std::thread> workers_;
+
+    std::atomic<size_t> queued_;       ///< Tm kuyruklardaki grev says.
+    std::atomic<unsigned> sleeping_;   ///< Uyuyan alan says.
+    std::atomic<bool> stop_;
+    std::mutex sleep_lock_;
+    std::condition_variable wake_;
+};
+
+#endif // THREAD_POOL_H